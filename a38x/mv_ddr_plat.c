@@ -259,8 +259,27 @@ static u32 dq_bit_map_2_phy_pin[] = {
 
 void mv_ddr_mem_scrubbing(void)
 {
+#if defined(MV_DDR_SCRUB_ASYNC)
+	/* scrub in the background; see mv_ddr_mem_scrub_is_done() */
+	ddr3_new_tip_ecc_scrub_start();
+#else
 	ddr3_new_tip_ecc_scrub();
+#endif /* MV_DDR_SCRUB_ASYNC */
+}
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size)
+{
+	return ddr3_new_tip_ecc_scrub_is_done(addr, size);
+}
+
+int mv_ddr_mem_scrub_wait(void)
+{
+	ddr3_new_tip_ecc_scrub_wait();
+
+	return MV_OK;
 }
+#endif /* MV_DDR_SCRUB_ASYNC */
 
 static int ddr3_tip_a38x_set_divider(u8 dev_num, u32 if_id,
 				     enum mv_ddr_freq freq);
@@ -350,6 +369,8 @@ void mv_ddr_odpg_enable(void)
 	dunit_write(ODPG_ENABLE_REG,
 		    ODPG_EN_MASK << ODPG_EN_OFFS,
 		    ODPG_EN_ENA << ODPG_EN_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, ODPG_ENABLE_REG,
+			 ODPG_EN_ENA << ODPG_EN_OFFS, ODPG_EN_MASK << ODPG_EN_OFFS);
 }
 
 void mv_ddr_odpg_disable(void)
@@ -357,6 +378,8 @@ void mv_ddr_odpg_disable(void)
 	dunit_write(ODPG_ENABLE_REG,
 		    ODPG_DIS_MASK << ODPG_DIS_OFFS,
 		    ODPG_DIS_DIS << ODPG_DIS_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, ODPG_ENABLE_REG,
+			 ODPG_DIS_DIS << ODPG_DIS_OFFS, ODPG_DIS_MASK << ODPG_DIS_OFFS);
 }
 
 void mv_ddr_odpg_done_clr(void)
@@ -369,11 +392,14 @@ int mv_ddr_is_odpg_done(u32 count)
 	u32 i, data;
 
 	for (i = 0; i < count; i++) {
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(ODPG_ENABLE_REG, MASK_ALL_BITS, &data);
 		if (((data >> ODPG_EN_OFFS) & ODPG_EN_MASK) ==
 		     ODPG_EN_DONE)
 			break;
 	}
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_POLL, i >= count, i, ODPG_ENABLE_REG,
+			 ODPG_EN_DONE << ODPG_EN_OFFS, ODPG_EN_MASK << ODPG_EN_OFFS);
 
 	if (i >= count) {
 		printf("%s: timeout\n", __func__);
@@ -385,9 +411,16 @@ int mv_ddr_is_odpg_done(u32 count)
 
 void mv_ddr_training_enable(void)
 {
+#if defined(MV_DDR_PHY_CACHE)
+	/* training engine may write its results to the phy */
+	mv_ddr_phy_cache_invalidate();
+#endif /* MV_DDR_PHY_CACHE */
 	dunit_write(GLOB_CTRL_STATUS_REG,
 		    TRAINING_TRIGGER_MASK << TRAINING_TRIGGER_OFFS,
 		    TRAINING_TRIGGER_ENA << TRAINING_TRIGGER_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, GLOB_CTRL_STATUS_REG,
+			 TRAINING_TRIGGER_ENA << TRAINING_TRIGGER_OFFS,
+			 TRAINING_TRIGGER_MASK << TRAINING_TRIGGER_OFFS);
 }
 
 #define DRAM_INIT_CTRL_STATUS_REG	0x18488
@@ -412,11 +445,15 @@ int mv_ddr_is_training_done(u32 count, u32 *result)
 	}
 
 	for (i = 0; i < count; i++) {
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(DRAM_INIT_CTRL_STATUS_REG, MASK_ALL_BITS, &data);
 		if (((data >> TRAINING_DONE_OFFS) & TRAINING_DONE_MASK) ==
 		     TRAINING_DONE_DONE)
 			break;
 	}
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_POLL, i >= count, i, DRAM_INIT_CTRL_STATUS_REG,
+			 TRAINING_DONE_DONE << TRAINING_DONE_OFFS,
+			 TRAINING_DONE_MASK << TRAINING_DONE_OFFS);
 
 	if (i >= count) {
 		printf("%s: timeout\n", __func__);
@@ -675,6 +712,7 @@ static int is_prfa_done(void)
 			printf("error: %s: polling timeout\n", __func__);
 			return MV_FAIL;
 		}
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(PHY_REG_FILE_ACCESS_REG, MASK_ALL_BITS, &reg_val);
 		reg_val >>= PRFA_REQ_OFFS;
 		reg_val &= PRFA_REQ_MASK;
@@ -1038,6 +1076,38 @@ int mv_ddr_post_training_fixup(void)
 	return 0;
 }
 
+/*
+ * suspend to ram wakeup: restore the saved dram setup and keep the dram
+ * contents; MV_NOT_STARTED asks for the full init flow, see mv_ddr_resume()
+ */
+int mv_ddr_soc_resume(const char *ddr_type)
+{
+#if defined(MV_DDR_RESUME)
+	int status;
+
+	status = mv_ddr_resume(0);
+	if (status != MV_OK)
+		return status;
+
+	mv_ddr_post_training_soc_config(ddr_type);
+	mv_ddr_post_training_fixup();
+	printf("mv_ddr: resumed successfully\n");
+
+	return MV_OK;
+#else /* !MV_DDR_RESUME */
+	return MV_NOT_STARTED;
+#endif /* MV_DDR_RESUME */
+}
+
+/* keep the trained setup for the next suspend to ram wakeup */
+void mv_ddr_soc_resume_save(void)
+{
+#if defined(MV_DDR_RESUME)
+	if (mv_ddr_resume_image_save(0) != MV_OK)
+		printf("mv_ddr: failed to save resume image\n");
+#endif /* MV_DDR_RESUME */
+}
+
 int ddr3_post_run_alg(void)
 {
 	return MV_OK;
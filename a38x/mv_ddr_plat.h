@@ -6,9 +6,13 @@
 #define _MV_DDR_PLAT_H
 
 #include <linux/delay.h>
-#if defined(CONFIG_MC_STATIC) || defined(CONFIG_PHY_STATIC)
+#if defined(CONFIG_MC_STATIC) || defined(CONFIG_PHY_STATIC) || \
+	defined(CONFIG_MC_STATIC_PRINT) || defined(CONFIG_PHY_STATIC_PRINT)
 #include "mv_ddr_static.h"
 #endif
+#if defined(MV_DDR_RESUME)
+#include "mv_ddr_resume.h"
+#endif
 
 #define MAX_DEVICE_NUM			1
 #define MAX_INTERFACE_NUM		1
@@ -240,6 +244,10 @@ extern u16 odt_intercept[];
 int mv_ddr_pre_training_soc_config(const char *ddr_type);
 int mv_ddr_post_training_soc_config(const char *ddr_type);
 void mv_ddr_mem_scrubbing(void);
+#if defined(MV_DDR_SCRUB_ASYNC)
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size);
+int mv_ddr_mem_scrub_wait(void);
+#endif /* MV_DDR_SCRUB_ASYNC */
 u32 mv_ddr_init_freq_get(void);
 void mv_ddr_odpg_enable(void);
 void mv_ddr_odpg_disable(void);
@@ -250,6 +258,8 @@ int mv_ddr_is_training_done(u32 count, u32 *result);
 u32 mv_ddr_dm_pad_get(void);
 int mv_ddr_pre_training_fixup(void);
 int mv_ddr_post_training_fixup(void);
+int mv_ddr_soc_resume(const char *ddr_type);
+void mv_ddr_soc_resume_save(void);
 int mv_ddr_manual_cal_do(void);
 int ddr3_calc_mem_cs_size(u32 cs, uint64_t *cs_size);
 
@@ -0,0 +1,346 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_RESUME)
+
+/* suspend to ram fast resume */
+
+#include "../ddr3_init.h"
+#include "../mv_ddr_common.h"
+#include "../mv_ddr_regs.h"
+#include "../mv_ddr_training_db.h"
+#include "mv_ddr_sys_env_lib.h"
+
+#define RESUME_DPAD_REGS	3
+#define RESUME_CPAD_REGS	3
+#define RESUME_DUNIT_REGS	(sizeof(resume_dunit_regs) / sizeof(resume_dunit_regs[0]))
+
+/*
+ * dunit registers set by the controller init and by training; sdram init
+ * and operation registers are left out, they issue commands to the dram
+ */
+static const u32 resume_dunit_regs[] = {
+	SDRAM_CFG_REG,
+	DUNIT_CTRL_LOW_REG,
+	SDRAM_TIMING_LOW_REG,
+	SDRAM_TIMING_HIGH_REG,
+	SDRAM_ADDR_CTRL_REG,
+	SDRAM_OPEN_PAGES_CTRL_REG,
+	SDRAM_MODE_REG,
+	SDRAM_EXT_MODE_REG,
+	DUNIT_CTRL_HIGH_REG,
+	DDR_ODT_TIMING_LOW_REG,
+	DDR_TIMING_REG,
+	SDRAM_AUTO_PWR_SAVE_REG,
+	DDR_ODT_TIMING_HIGH_REG,
+	SDRAM_ODT_CTRL_LOW_REG,
+	SDRAM_ODT_CTRL_HIGH_REG,
+	DUNIT_ODT_CTRL_REG,
+	AXI_CTRL_REG,
+	MAIN_PADS_CAL_MACH_CTRL_REG,
+	DUNIT_CS_WIN_CTRL_REG(1),
+	DUNIT_CS_WIN_CTRL_REG(2),
+	DUNIT_CS_WIN_CTRL_REG(3),
+	DDR_IO_REG,
+	RD_DATA_SMPL_DLYS_REG,
+	RD_DATA_RDY_DLYS_REG,
+	MR0_REG,
+	MR1_REG,
+	MR2_REG,
+	MR3_REG,
+	DDR3_RANK_CTRL_REG,
+	ZQC_CFG_REG,
+	ZQC_CFG_HIGH_REG,
+	DRAM_PHY_CFG_REG
+};
+
+static const u32 resume_dpad_regs[RESUME_DPAD_REGS] = {
+	PAD_ZRI_CAL_PHY_REG,
+	PAD_ODT_CAL_PHY_REG,
+	PAD_CFG_PHY_REG
+};
+
+static const u32 resume_cpad_regs[RESUME_CPAD_REGS] = {
+	WL_PHY_REG(0),
+	PAD_ZRI_CAL_PHY_REG,
+	PAD_ODT_CAL_PHY_REG
+};
+
+struct mv_ddr_resume_image {
+	u32 magic;
+	u32 version;
+	u32 size;
+	u32 crc;		/* crc32 of the fields below */
+	u32 cfg_hash;		/* crc32 of spd or of the topology parameters */
+	u32 freq;		/* target frequency [MHz] */
+	u32 bus_act_mask;
+	u32 cs_num;
+	u32 dunit[RESUME_DUNIT_REGS];
+	u16 data_phy[MAX_CS_NUM][PHY_CS_REGS_NUM][MAX_BUS_NUM];
+	u16 data_pad[RESUME_DPAD_REGS][MAX_BUS_NUM];
+	u16 ctrl_pad[RESUME_CPAD_REGS][DDR_IF_CTRL_SUBPHYS_NUM];
+};
+
+static struct mv_ddr_resume_image resume_buf;
+static const struct mv_ddr_resume_image *resume_image;
+static u32 resume_image_size;
+static int resume_init_on_fail;
+
+/* crc32 of the image contents following the crc field */
+static u32 mv_ddr_resume_image_crc(const struct mv_ddr_resume_image *image)
+{
+	const u8 *buf = (const u8 *)&image->cfg_hash;
+
+	return mv_ddr_crc32(0, buf, sizeof(*image) - (buf - (const u8 *)image));
+}
+
+static u32 mv_ddr_resume_cfg_hash(void)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+
+	if (tm->cfg_src == MV_DDR_CFG_SPD)
+		return mv_ddr_crc32(0, tm->spd_data.all_bytes, sizeof(tm->spd_data.all_bytes));
+
+	return mv_ddr_crc32(0, (u8 *)tm->interface_params, sizeof(tm->interface_params));
+}
+
+void mv_ddr_resume_image_set(const void *image, u32 size, int init_on_fail)
+{
+	resume_image = image;
+	resume_image_size = size;
+	resume_init_on_fail = init_on_fail;
+}
+
+const void *mv_ddr_resume_image_get(u32 *size)
+{
+	*size = resume_buf.size;
+
+	return resume_buf.size ? &resume_buf : NULL;
+}
+
+/* capture the trained setup; called at the end of a cold boot init */
+int mv_ddr_resume_image_save(u32 dev_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	struct mv_ddr_resume_image *image = &resume_buf;
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 cs, idx, phy, data;
+
+	memset(image, 0, sizeof(*image));
+	image->magic = MV_DDR_RESUME_MAGIC;
+	image->version = MV_DDR_RESUME_VERSION;
+	image->cfg_hash = mv_ddr_resume_cfg_hash();
+	image->freq = mv_ddr_freq_get(tm->interface_params[0].memory_freq);
+	image->bus_act_mask = tm->bus_act_mask;
+	image->cs_num = mv_ddr_cs_num_get();
+
+	for (idx = 0; idx < RESUME_DUNIT_REGS; idx++)
+		CHECK_STATUS(ddr3_tip_if_read(dev_num, ACCESS_TYPE_UNICAST, 0,
+					      resume_dunit_regs[idx], &image->dunit[idx],
+					      MASK_ALL_BITS));
+
+	for (phy = 0; phy < octets_per_if_num; phy++) {
+		VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+		for (cs = 0; cs < image->cs_num; cs++) {
+			for (idx = 0; idx < PHY_CS_REGS_NUM; idx++) {
+				CHECK_STATUS(ddr3_tip_bus_read(dev_num, 0, ACCESS_TYPE_UNICAST,
+							       phy, DDR_PHY_DATA,
+							       mv_ddr_phy_cs_reg_get(cs, idx),
+							       &data));
+				image->data_phy[cs][idx][phy] = data;
+			}
+		}
+
+		for (idx = 0; idx < RESUME_DPAD_REGS; idx++) {
+			CHECK_STATUS(ddr3_tip_bus_read(dev_num, 0, ACCESS_TYPE_UNICAST,
+						       phy, DDR_PHY_DATA,
+						       resume_dpad_regs[idx], &data));
+			image->data_pad[idx][phy] = data;
+		}
+	}
+
+	for (idx = 0; idx < RESUME_CPAD_REGS; idx++) {
+		for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++) {
+			CHECK_STATUS(ddr3_tip_bus_read(dev_num, 0, ACCESS_TYPE_UNICAST,
+						       phy, DDR_PHY_CONTROL,
+						       resume_cpad_regs[idx], &data));
+			image->ctrl_pad[idx][phy] = data;
+		}
+	}
+
+	image->size = sizeof(*image);
+	image->crc = mv_ddr_resume_image_crc(image);
+
+	DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
+			  ("mv_ddr: resume: saved %d bytes, crc 0x%x\n", image->size, image->crc));
+
+	return MV_OK;
+}
+
+int mv_ddr_resume_is_wakeup(void)
+{
+	return mv_ddr_sys_env_suspend_wakeup_check() == SUSPEND_WAKEUP_ENABLED_GPIO_DETECTED;
+}
+
+/* check the image matches this build, dimm and frequency */
+static int mv_ddr_resume_image_validate(void)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	const struct mv_ddr_resume_image *image = resume_image;
+
+	if (image == NULL || resume_image_size < sizeof(*image)) {
+		printf("mv_ddr: resume: no image\n");
+		return MV_FAIL;
+	}
+
+	if (image->magic != MV_DDR_RESUME_MAGIC ||
+	    image->version != MV_DDR_RESUME_VERSION ||
+	    image->size != sizeof(*image)) {
+		printf("mv_ddr: resume: bad image header\n");
+		return MV_FAIL;
+	}
+
+	if (image->crc != mv_ddr_resume_image_crc(image)) {
+		printf("mv_ddr: resume: crc mismatch\n");
+		return MV_FAIL;
+	}
+
+	if (image->cfg_hash != mv_ddr_resume_cfg_hash() ||
+	    image->freq != mv_ddr_freq_get(tm->interface_params[0].memory_freq) ||
+	    image->bus_act_mask != tm->bus_act_mask ||
+	    image->cs_num != mv_ddr_cs_num_get()) {
+		printf("mv_ddr: resume: image does not match the configuration\n");
+		return MV_FAIL;
+	}
+
+	return MV_OK;
+}
+
+static int mv_ddr_resume_phy_load(u32 dev_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	const struct mv_ddr_resume_image *image = resume_image;
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 cs, idx, phy;
+
+	for (phy = 0; phy < octets_per_if_num; phy++) {
+		VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+		for (cs = 0; cs < image->cs_num; cs++) {
+			for (idx = 0; idx < PHY_CS_REGS_NUM; idx++)
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+								ACCESS_TYPE_UNICAST, phy, DDR_PHY_DATA,
+								mv_ddr_phy_cs_reg_get(cs, idx),
+								image->data_phy[cs][idx][phy]));
+		}
+
+		for (idx = 0; idx < RESUME_DPAD_REGS; idx++)
+			CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+							ACCESS_TYPE_UNICAST, phy, DDR_PHY_DATA,
+							resume_dpad_regs[idx], image->data_pad[idx][phy]));
+	}
+
+	for (idx = 0; idx < RESUME_CPAD_REGS; idx++) {
+		for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++)
+			CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+							ACCESS_TYPE_UNICAST, phy, DDR_PHY_CONTROL,
+							resume_cpad_regs[idx], image->ctrl_pad[idx][phy]));
+	}
+
+	return MV_OK;
+}
+
+/* the saved phy setup goes back in a phy batch */
+static int mv_ddr_resume_phy_restore(u32 dev_num)
+{
+	CHECK_STATUS(mv_ddr_phy_batch_start(dev_num));
+
+	return mv_ddr_phy_batch_end(dev_num, mv_ddr_resume_phy_load(dev_num));
+}
+
+/*
+ * the dram was put in self-refresh before suspend and its reset was masked
+ * on wakeup (see mv_ddr_pre_training_soc_config); bring the controller to
+ * the self-refresh state, then exit it the same way a frequency change does
+ */
+static int mv_ddr_resume_sr_exit(u32 dev_num)
+{
+	/* block dfs and mark the dram as in self-refresh */
+	CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0, DFS_REG, 0x6, 0x6));
+	if (ddr3_tip_if_polling(dev_num, ACCESS_TYPE_UNICAST, 0, 0x8, 0x8, DFS_REG,
+				MAX_POLLING_ITERATIONS) != MV_OK) {
+		printf("mv_ddr: resume: self-refresh entry ack timeout\n");
+		return MV_FAIL;
+	}
+
+	/* exit self-refresh */
+	CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0, DFS_REG, 0, 0x4));
+	if (ddr3_tip_if_polling(dev_num, ACCESS_TYPE_UNICAST, 0, 0, 0x8, DFS_REG,
+				MAX_POLLING_ITERATIONS) != MV_OK) {
+		printf("mv_ddr: resume: self-refresh exit timeout\n");
+		return MV_FAIL;
+	}
+
+	/* refresh command */
+	CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0, SDRAM_OP_REG, 0x2, 0xf1f));
+	if (ddr3_tip_if_polling(dev_num, ACCESS_TYPE_UNICAST, 0, 0, 0x1f, SDRAM_OP_REG,
+				MAX_POLLING_ITERATIONS) != MV_OK) {
+		printf("mv_ddr: resume: refresh timeout\n");
+		return MV_FAIL;
+	}
+
+	/* release dfs block and set controller to mbus retry normal */
+	CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0, DFS_REG, 0, 0x2));
+	CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0, DUNIT_MMASK_REG, 0x1, 0x1));
+
+	return MV_OK;
+}
+
+static int mv_ddr_resume_restore(u32 dev_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	const struct mv_ddr_resume_image *image;
+	u32 idx;
+
+	CHECK_STATUS(mv_ddr_resume_image_validate());
+	image = resume_image;
+
+	for (idx = 0; idx < RESUME_DUNIT_REGS; idx++)
+		CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+					       resume_dunit_regs[idx], image->dunit[idx],
+					       MASK_ALL_BITS));
+
+	CHECK_STATUS(adll_calibration(dev_num, ACCESS_TYPE_UNICAST, 0,
+				      tm->interface_params[0].memory_freq));
+	CHECK_STATUS(mv_ddr_resume_phy_restore(dev_num));
+	CHECK_STATUS(mv_ddr_resume_sr_exit(dev_num));
+
+	printf("mv_ddr: resume: dram setup restored, self-refresh exited\n");
+
+	return MV_OK;
+}
+
+/*
+ * serve a suspend to ram wakeup; returns MV_OK when the dram setup is
+ * restored with its contents, MV_NOT_STARTED when the full init has to
+ * run (no wakeup, or a failed resume with init_on_fail set), and
+ * MV_NOT_ALLOWED when a failed resume must not wipe the dram
+ */
+int mv_ddr_resume(u32 dev_num)
+{
+	if (!mv_ddr_resume_is_wakeup())
+		return MV_NOT_STARTED;
+
+	if (mv_ddr_resume_restore(dev_num) == MV_OK)
+		return MV_OK;
+
+	if (!resume_init_on_fail) {
+		printf("mv_ddr: resume failed, full init not allowed\n");
+		return MV_NOT_ALLOWED;
+	}
+
+	printf("mv_ddr: resume failed, running full init, dram contents are lost\n");
+
+	return MV_NOT_STARTED;
+}
+#endif /* MV_DDR_RESUME */
@@ -0,0 +1,33 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_RESUME_H
+#define _MV_DDR_RESUME_H
+
+#if defined(MV_DDR_RESUME)
+/*
+ * suspend to ram fast resume
+ *
+ * after a cold boot the trained dunit and phy registers are captured into
+ * a crc protected image (mv_ddr_resume_image_get) that the boot loader keeps
+ * in a location preserved over suspend; on a gpio detected wakeup the image
+ * handed over thru mv_ddr_resume_image_set() is written back, the dram is
+ * taken out of self-refresh and training, the init sequence and scrubbing
+ * are skipped, so the dram contents are kept.
+ * a failed resume may already have changed the controller setup, so the
+ * dram contents cannot be relied on anymore; the boot loader chooses with
+ * init_on_fail whether ddr3_init() then runs the full init flow, which
+ * wipes the dram, or returns MV_NOT_ALLOWED and leaves the decision to it.
+ */
+#define MV_DDR_RESUME_MAGIC		0x5244564d	/* "MVDR" */
+#define MV_DDR_RESUME_VERSION		1
+
+void mv_ddr_resume_image_set(const void *image, u32 size, int init_on_fail);
+const void *mv_ddr_resume_image_get(u32 *size);
+int mv_ddr_resume_image_save(u32 dev_num);
+int mv_ddr_resume_is_wakeup(void);
+int mv_ddr_resume(u32 dev_num);
+#endif /* MV_DDR_RESUME */
+
+#endif /* _MV_DDR_RESUME_H */
@@ -2,1123 +2,1146 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include "mv_ddr_static.h"
-#include "../ddr3_training_ip_def.h"
+#include "../ddr3_init.h"
+#include "mv_ddr_static_regs.h"
+
+#if defined(CONFIG_PHY_STATIC) || defined(CONFIG_MC_STATIC)
+/*
+ * static register images
+ *
+ * an image is a byte stream of records, terminated by STATIC_IMG_END;
+ * each record starts with a header byte holding the address delta to the
+ * previous record in bits[6:0], or STATIC_IMG_ABS when an absolute address
+ * follows the header. all fields are little-endian.
+ * mc record:	hdr, [addr (4)], data (4), [mask (4) if STATIC_IMG_MASKED]
+ *		w/o a mask, the register is written w/o read-modify-write
+ * phy image:	subphys number (1), followed by records
+ * phy record:	hdr, [addr (1)], data (2) per subphy or a single data (2)
+ *		for all subphys if STATIC_IMG_BCAST
+ * tools/static_gen emits images in this format.
+ */
+#define STATIC_IMG_END		0x00
+#define STATIC_IMG_ABS		0x7f
+#define STATIC_IMG_DELTA_MASK	0x7f
+#define STATIC_IMG_MASKED	0x80	/* mc: a mask follows the data */
+#define STATIC_IMG_BCAST	0x80	/* phy: same data on all subphys */
+#define STATIC_IMG_U16(v)	((v) & 0xff), (((v) >> 8) & 0xff)
+#define STATIC_IMG_U32(v)	STATIC_IMG_U16(v), STATIC_IMG_U16((v) >> 16)
+#endif /* CONFIG_PHY_STATIC || CONFIG_MC_STATIC */
 
 #ifdef CONFIG_MC_STATIC
-static struct reg_data a38x_mc_800[] = {
-	{0x1400, 0x7b00cc30, 0xffffffff},
-	{0x1404, 0x36301848, 0xffffffff},
-	{0x1408, 0x5315baab, 0xffffffff},
-	{0x140c, 0x76011fcf, 0xffffffff},
-	{0x1410, 0x15334400, 0xffffffff},
-	{0x1414, 0x00000700, 0xffffffff},
-	{0x1418, 0x00000000, 0xffffffff},
-	{0x141c, 0x00000000, 0xffffffff},
-	{0x1420, 0x00000000, 0xffffffff},
-	{0x1424, 0x0060f3ff, 0xffffffff},
-	{0x1428, 0x0013b940, 0xffffffff},
-	{0x142c, 0x014c5138, 0xffffffff},
-	{0x1474, 0x0000030c, 0xffffffff},
-	{0x147c, 0x0000d791, 0xffffffff},
-	{0x1494, 0x00120012, 0xffffffff},
-	{0x1498, 0x00000000, 0xffffffff},
-	{0x149c, 0x0000000f, 0xffffffff},
-	{0x14a8, 0x00000000, 0xffffffff},
-	{0x14cc, 0x8001200d, 0xffffffff},
-	{0x150c, 0x0ffffff5, 0xffffffff},
-	{0x1514, 0x0ffffff9, 0xffffffff},
-	{0x151c, 0x0ffffffd, 0xffffffff},
-	{0x1538, 0x00000d0d, 0xffffffff},
-	{0x153c, 0x00001111, 0xffffffff},
-	{0x15d0, 0x00000c70, 0xffffffff},
-	{0x15d4, 0x00000046, 0xffffffff},
-	{0x15d8, 0x00000018, 0xffffffff},
-	{0x15dc, 0x00000000, 0xffffffff},
-	{0x15e0, 0x00000023, 0xffffffff},
-	{0x15e4, 0x00203c18, 0xffffffff},
-	{0x15ec, 0xd9ff0029, 0xffffffff},
-	{0xffffffff, 0, 0}
+static const u8 a38x_mc_800[] = {
+	STATIC_IMG_ABS, STATIC_IMG_U32(0x1400), STATIC_IMG_U32(0x7b00cc30),
+	1, STATIC_IMG_U32(0x36301848),	/* 0x1404 */
+	1, STATIC_IMG_U32(0x5315baab),	/* 0x1408 */
+	1, STATIC_IMG_U32(0x76011fcf),	/* 0x140c */
+	1, STATIC_IMG_U32(0x15334400),	/* 0x1410 */
+	1, STATIC_IMG_U32(0x00000700),	/* 0x1414 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x1418 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x141c */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x1420 */
+	1, STATIC_IMG_U32(0x0060f3ff),	/* 0x1424 */
+	1, STATIC_IMG_U32(0x0013b940),	/* 0x1428 */
+	1, STATIC_IMG_U32(0x014c5138),	/* 0x142c */
+	18, STATIC_IMG_U32(0x0000030c),	/* 0x1474 */
+	2, STATIC_IMG_U32(0x0000d791),	/* 0x147c */
+	6, STATIC_IMG_U32(0x00120012),	/* 0x1494 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x1498 */
+	1, STATIC_IMG_U32(0x0000000f),	/* 0x149c */
+	3, STATIC_IMG_U32(0x00000000),	/* 0x14a8 */
+	9, STATIC_IMG_U32(0x8001200d),	/* 0x14cc */
+	16, STATIC_IMG_U32(0x0ffffff5),	/* 0x150c */
+	2, STATIC_IMG_U32(0x0ffffff9),	/* 0x1514 */
+	2, STATIC_IMG_U32(0x0ffffffd),	/* 0x151c */
+	7, STATIC_IMG_U32(0x00000d0d),	/* 0x1538 */
+	1, STATIC_IMG_U32(0x00001111),	/* 0x153c */
+	37, STATIC_IMG_U32(0x00000c70),	/* 0x15d0 */
+	1, STATIC_IMG_U32(0x00000046),	/* 0x15d4 */
+	1, STATIC_IMG_U32(0x00000018),	/* 0x15d8 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x15dc */
+	1, STATIC_IMG_U32(0x00000023),	/* 0x15e0 */
+	1, STATIC_IMG_U32(0x00203c18),	/* 0x15e4 */
+	2, STATIC_IMG_U32(0xd9ff0029),	/* 0x15ec */
+	STATIC_IMG_END
 };
 
-static struct reg_data a38x_mc_600[] = {
-	{0x1400, 0x7b00c924, 0xffffffff},
-	{0x1404, 0x36301848, 0xffffffff},
-	{0x1408, 0x43149774, 0xffffffff},
-	{0x140c, 0x76011f9c, 0xffffffff},
-	{0x1410, 0x10334400, 0xffffffff},
-	{0x1414, 0x00000700, 0xffffffff},
-	{0x1418, 0x00000000, 0xffffffff},
-	{0x141c, 0x00000000, 0xffffffff},
-	{0x1420, 0x00000000, 0xffffffff},
-	{0x1424, 0x0060f3ff, 0xffffffff},
-	{0x1428, 0x00107830, 0xffffffff},
-	{0x142c, 0x014c50e8, 0xffffffff},
-	{0x1474, 0x0000030c, 0xffffffff},
-	{0x1494, 0x00120012, 0xffffffff},
-	{0x149c, 0x0000000f, 0xffffffff},
-	{0x14a8, 0x00000000, 0xffffffff},
-	{0x14cc, 0x0001200d, 0xffffffff},
-	{0x1514, 0x0ffffff9, 0xffffffff},
-	{0x151c, 0x0ffffffd, 0xffffffff},
-	{0x1538, 0x00000909, 0xffffffff},
-	{0x153c, 0x00000f0f, 0xffffffff},
-	{0x15d0, 0x00000a50, 0xffffffff},
-	{0x15d4, 0x00000046, 0xffffffff},
-	{0x15d8, 0x00000010, 0xffffffff},
-	{0x15dc, 0x00000000, 0xffffffff},
-	{0x15e0, 0x00000023, 0xffffffff},
-	{0x15e4, 0x00203c18, 0xffffffff},
-	{0x15e8, 0x00000000, 0xffffffff},
-	{0x15ec, 0xd9ff0029, 0xffffffff},
-	{0xffffffff, 0, 0}
+static const u8 a38x_mc_600[] = {
+	STATIC_IMG_ABS, STATIC_IMG_U32(0x1400), STATIC_IMG_U32(0x7b00c924),
+	1, STATIC_IMG_U32(0x36301848),	/* 0x1404 */
+	1, STATIC_IMG_U32(0x43149774),	/* 0x1408 */
+	1, STATIC_IMG_U32(0x76011f9c),	/* 0x140c */
+	1, STATIC_IMG_U32(0x10334400),	/* 0x1410 */
+	1, STATIC_IMG_U32(0x00000700),	/* 0x1414 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x1418 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x141c */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x1420 */
+	1, STATIC_IMG_U32(0x0060f3ff),	/* 0x1424 */
+	1, STATIC_IMG_U32(0x00107830),	/* 0x1428 */
+	1, STATIC_IMG_U32(0x014c50e8),	/* 0x142c */
+	18, STATIC_IMG_U32(0x0000030c),	/* 0x1474 */
+	8, STATIC_IMG_U32(0x00120012),	/* 0x1494 */
+	2, STATIC_IMG_U32(0x0000000f),	/* 0x149c */
+	3, STATIC_IMG_U32(0x00000000),	/* 0x14a8 */
+	9, STATIC_IMG_U32(0x0001200d),	/* 0x14cc */
+	18, STATIC_IMG_U32(0x0ffffff9),	/* 0x1514 */
+	2, STATIC_IMG_U32(0x0ffffffd),	/* 0x151c */
+	7, STATIC_IMG_U32(0x00000909),	/* 0x1538 */
+	1, STATIC_IMG_U32(0x00000f0f),	/* 0x153c */
+	37, STATIC_IMG_U32(0x00000a50),	/* 0x15d0 */
+	1, STATIC_IMG_U32(0x00000046),	/* 0x15d4 */
+	1, STATIC_IMG_U32(0x00000010),	/* 0x15d8 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x15dc */
+	1, STATIC_IMG_U32(0x00000023),	/* 0x15e0 */
+	1, STATIC_IMG_U32(0x00203c18),	/* 0x15e4 */
+	1, STATIC_IMG_U32(0x00000000),	/* 0x15e8 */
+	1, STATIC_IMG_U32(0xd9ff0029),	/* 0x15ec */
+	STATIC_IMG_END
 };
 #endif /* CONFIG_MC_STATIC */
 
 #ifdef CONFIG_PHY_STATIC
-struct mv_ddr_subphys_reg_config {
-	u32 reg_addr;
-	u32 reg_data[5];
-};
-
-static struct mv_ddr_subphys_reg_config a38x_ctrl_phy_600[] = {
-	{0x0, {0x6, 0x6, 0x6} },
-	{0x1, {0x0, 0x0, 0x0} },
-	{0x2, {0x0, 0x0, 0x0} },
-	{0x3, {0x10, 0x10, 0x10} },
-	{0x4, {0x0, 0x0, 0x0} },
-	{0x5, {0x10, 0x10, 0x10} },
-	{0x6, {0x0, 0x0, 0x0} },
-	{0x7, {0x10, 0x10, 0x10} },
-	{0x8, {0x0, 0x0, 0x0} },
-	{0x9, {0x10, 0x10, 0x10} },
-	{0xa, {0x0, 0x0, 0x0} },
-	{0xb, {0x10, 0x10, 0x10} },
-	{0xc, {0x0, 0x0, 0x0} },
-	{0xd, {0x10, 0x10, 0x10} },
-	{0xe, {0x0, 0x0, 0x0} },
-	{0xf, {0x10, 0x10, 0x10} },
-	{0x10, {0x0, 0x0, 0x0} },
-	{0x11, {0x0, 0x0, 0x0} },
-	{0x12, {0x0, 0x0, 0x0} },
-	{0x13, {0x0, 0x0, 0x0} },
-	{0x14, {0x0, 0x0, 0x0} },
-	{0x15, {0x0, 0x0, 0x0} },
-	{0x16, {0x0, 0x0, 0x0} },
-	{0x17, {0x0, 0x0, 0x0} },
-	{0x18, {0x0, 0x0, 0x0} },
-	{0x19, {0x0, 0x0, 0x0} },
-	{0x1a, {0x0, 0x0, 0x0} },
-	{0x1b, {0x0, 0x0, 0x0} },
-	{0x1c, {0x0, 0x0, 0x0} },
-	{0x1d, {0x0, 0x0, 0x0} },
-	{0x1e, {0x0, 0x0, 0x0} },
-	{0x1f, {0x0, 0x0, 0x0} },
-	{0x20, {0x0, 0x0, 0x0} },
-	{0x21, {0x0, 0x0, 0x0} },
-	{0x22, {0x0, 0x0, 0x0} },
-	{0x23, {0x0, 0x0, 0x0} },
-	{0x24, {0x0, 0x0, 0x0} },
-	{0x25, {0x0, 0x0, 0x0} },
-	{0x26, {0x0, 0x0, 0x0} },
-	{0x27, {0x0, 0x0, 0x0} },
-	{0x28, {0x0, 0x0, 0x0} },
-	{0x29, {0x0, 0x0, 0x0} },
-	{0x2a, {0x0, 0x0, 0x0} },
-	{0x2b, {0x0, 0x0, 0x0} },
-	{0x2c, {0x0, 0x0, 0x0} },
-	{0x2d, {0x0, 0x0, 0x0} },
-	{0x2e, {0x0, 0x0, 0x0} },
-	{0x2f, {0x0, 0x0, 0x0} },
-	{0x30, {0x0, 0x0, 0x0} },
-	{0x31, {0x0, 0x0, 0x0} },
-	{0x32, {0x0, 0x0, 0x0} },
-	{0x33, {0x0, 0x0, 0x0} },
-	{0x34, {0x0, 0x0, 0x0} },
-	{0x35, {0x0, 0x0, 0x0} },
-	{0x36, {0x0, 0x0, 0x0} },
-	{0x37, {0x0, 0x0, 0x0} },
-	{0x38, {0x0, 0x0, 0x0} },
-	{0x39, {0x0, 0x0, 0x0} },
-	{0x3a, {0x0, 0x0, 0x0} },
-	{0x3b, {0x0, 0x0, 0x0} },
-	{0x3c, {0x0, 0x0, 0x0} },
-	{0x3d, {0x0, 0x0, 0x0} },
-	{0x3e, {0x0, 0x0, 0x0} },
-	{0x3f, {0x0, 0x0, 0x0} },
-	{0x40, {0x0, 0x0, 0x0} },
-	{0x41, {0x0, 0x0, 0x0} },
-	{0x42, {0x0, 0x0, 0x0} },
-	{0x43, {0x0, 0x0, 0x0} },
-	{0x44, {0x0, 0x0, 0x0} },
-	{0x45, {0x0, 0x0, 0x0} },
-	{0x46, {0x0, 0x0, 0x0} },
-	{0x47, {0x0, 0x0, 0x0} },
-	{0x48, {0x0, 0x0, 0x0} },
-	{0x49, {0x0, 0x0, 0x0} },
-	{0x4a, {0x0, 0x0, 0x0} },
-	{0x4b, {0x0, 0x0, 0x0} },
-	{0x4c, {0x0, 0x0, 0x0} },
-	{0x4d, {0x0, 0x0, 0x0} },
-	{0x4e, {0x0, 0x0, 0x0} },
-	{0x4f, {0x0, 0x0, 0x0} },
-	{0x50, {0x0, 0x0, 0x0} },
-	{0x51, {0x0, 0x0, 0x0} },
-	{0x52, {0x0, 0x0, 0x0} },
-	{0x53, {0x0, 0x0, 0x0} },
-	{0x54, {0x0, 0x0, 0x0} },
-	{0x55, {0x0, 0x0, 0x0} },
-	{0x56, {0x0, 0x0, 0x0} },
-	{0x57, {0x0, 0x0, 0x0} },
-	{0x58, {0x0, 0x0, 0x0} },
-	{0x59, {0x0, 0x0, 0x0} },
-	{0x5a, {0x0, 0x0, 0x0} },
-	{0x5b, {0x0, 0x0, 0x0} },
-	{0x5c, {0x0, 0x0, 0x0} },
-	{0x5d, {0x0, 0x0, 0x0} },
-	{0x5e, {0x0, 0x0, 0x0} },
-	{0x5f, {0x0, 0x0, 0x0} },
-	{0x60, {0x0, 0x0, 0x0} },
-	{0x61, {0x0, 0x0, 0x0} },
-	{0x62, {0x0, 0x0, 0x0} },
-	{0x63, {0x0, 0x0, 0x0} },
-	{0x64, {0x0, 0x0, 0x0} },
-	{0x65, {0x0, 0x0, 0x0} },
-	{0x66, {0x0, 0x0, 0x0} },
-	{0x67, {0x0, 0x0, 0x0} },
-	{0x68, {0x0, 0x0, 0x0} },
-	{0x69, {0x0, 0x0, 0x0} },
-	{0x6a, {0x0, 0x0, 0x0} },
-	{0x6b, {0x0, 0x0, 0x0} },
-	{0x6c, {0x0, 0x0, 0x0} },
-	{0x6d, {0x0, 0x0, 0x0} },
-	{0x6e, {0x0, 0x0, 0x0} },
-	{0x6f, {0x0, 0x0, 0x0} },
-	{0x70, {0x0, 0x0, 0x0} },
-	{0x71, {0x0, 0x0, 0x0} },
-	{0x72, {0x0, 0x0, 0x0} },
-	{0x73, {0x0, 0x0, 0x0} },
-	{0x74, {0x0, 0x0, 0x0} },
-	{0x75, {0x0, 0x0, 0x0} },
-	{0x76, {0x0, 0x0, 0x0} },
-	{0x77, {0x0, 0x0, 0x0} },
-	{0x78, {0x0, 0x0, 0x0} },
-	{0x79, {0x0, 0x0, 0x0} },
-	{0x7a, {0x0, 0x0, 0x0} },
-	{0x7b, {0x0, 0x0, 0x0} },
-	{0x7c, {0x0, 0x0, 0x0} },
-	{0x7d, {0x0, 0x0, 0x0} },
-	{0x7e, {0x0, 0x0, 0x0} },
-	{0x7f, {0x0, 0x0, 0x0} },
-	{0x80, {0x0, 0x0, 0x0} },
-	{0x81, {0x0, 0x0, 0x0} },
-	{0x82, {0x0, 0x0, 0x0} },
-	{0x83, {0x0, 0x0, 0x0} },
-	{0x84, {0x0, 0x0, 0x0} },
-	{0x85, {0x0, 0x0, 0x0} },
-	{0x86, {0x0, 0x0, 0x0} },
-	{0x87, {0x0, 0x0, 0x0} },
-	{0x88, {0x0, 0x0, 0x0} },
-	{0x89, {0x0, 0x0, 0x0} },
-	{0x8a, {0x0, 0x0, 0x0} },
-	{0x8b, {0x0, 0x0, 0x0} },
-	{0x8c, {0x0, 0x0, 0x0} },
-	{0x8d, {0x0, 0x0, 0x0} },
-	{0x8e, {0x0, 0x0, 0x0} },
-	{0x8f, {0x0, 0x0, 0x0} },
-	{0x90, {0x2002, 0x2002, 0x2002} },
-	{0x91, {0x0, 0x0, 0x0} },
-	{0x92, {0x1503, 0x1503, 0x1503} },
-	{0x93, {0x50, 0x50, 0x50} },
-	{0x94, {0x12, 0x12, 0x12} },
-	{0x95, {0xf, 0xf, 0xf} },
-	{0x96, {0x0, 0x0, 0x0} },
-	{0x97, {0x0, 0x0, 0x0} },
-	{0x98, {0x0, 0x0, 0x0} },
-	{0x99, {0x0, 0x0, 0x0} },
-	{0x9a, {0x1, 0x1, 0x1} },
-	{0x9b, {0x1fff, 0x1fff, 0x1fff} },
-	{0x9c, {0x1, 0x1, 0x1} },
-	{0x9d, {0x0, 0x0, 0x0} },
-	{0x9e, {0x0, 0x0, 0x0} },
-	{0x9f, {0x0, 0x0, 0x0} },
-	{0xa0, {0x0, 0x0, 0x0} },
-	{0xa1, {0x7ff, 0x7ff, 0x7ff} },
-	{0xa2, {0x0, 0x0, 0x0} },
-	{0xa3, {0x7ff, 0x7ff, 0x7ff} },
-	{0xa4, {0x254a, 0x254a, 0x254a} },
-	{0xa5, {0x34e9, 0x34e9, 0x34e9} },
-	{0xa6, {0xb6d, 0xb6d, 0xb6d} },
-	{0xa7, {0x5d1, 0x5d1, 0x5d1} },
-	{0xa8, {0x434, 0x434, 0x434} },
-	{0xa9, {0x0, 0x0, 0x0} },
-	{0xaa, {0x0, 0x0, 0x0} },
-	{0xab, {0x0, 0x0, 0x0} },
-	{0xac, {0x0, 0x0, 0x0} },
-	{0xad, {0x0, 0x0, 0x0} },
-	{0xae, {0x0, 0x0, 0x0} },
-	{0xaf, {0x0, 0x0, 0x0} },
-	{0xb0, {0x0, 0x0, 0x0} },
-	{0xb1, {0x0, 0x0, 0x0} },
-	{0xb2, {0x1, 0x1, 0x1} },
-	{0xb3, {0x0, 0x0, 0x0} },
-	{0xb4, {0x0, 0x0, 0x0} },
-	{0xb5, {0x0, 0x0, 0x0} },
-	{0xb6, {0x0, 0x0, 0x0} },
-	{0xb7, {0x0, 0x0, 0x0} },
-	{0xb8, {0x0, 0x0, 0x0} },
-	{0xb9, {0x0, 0x0, 0x0} },
-	{0xba, {0x0, 0x0, 0x0} },
-	{0xbb, {0x0, 0x0, 0x0} },
-	{0xbc, {0x0, 0x0, 0x0} },
-	{0xbd, {0x0, 0x0, 0x0} },
-	{0xbe, {0x1, 0x1, 0x1} },
-	{0xbf, {0x0, 0x0, 0x0} },
-	{0xc0, {0x0, 0x0, 0x0} },
-	{0xc1, {0x0, 0x0, 0x0} },
-	{0xc2, {0x0, 0x0, 0x0} },
-	{0xc3, {0x0, 0x0, 0x0} },
-	{0xc4, {0x0, 0x0, 0x0} },
-	{0xc5, {0x0, 0x0, 0x0} },
-	{0xc6, {0x0, 0x0, 0x0} },
-	{0xc7, {0x0, 0x0, 0x0} },
-	{0xc8, {0x0, 0x0, 0x0} },
-	{0xc9, {0x0, 0x0, 0x0} },
-	{0xca, {0x0, 0x0, 0x0} },
-	{0xcb, {0x0, 0x0, 0x0} },
-	{0xcc, {0x0, 0x0, 0x0} },
-	{0xcd, {0x0, 0x0, 0x0} },
-	{0xce, {0x0, 0x0, 0x0} },
-	{0xcf, {0x0, 0x0, 0x0} },
-	{0xd0, {0x1f, 0x1f, 0x1f} },
-	{0xd1, {0x1f, 0x1f, 0x1f} },
-	{0xd2, {0x1f, 0x1f, 0x1f} },
-	{0xd3, {0x1f, 0x1f, 0x1f} },
-	{0xd4, {0x1f, 0x1f, 0x1f} },
-	{0xd5, {0x1f, 0x1f, 0x1f} },
-	{0xd6, {0x1f, 0x1f, 0x1f} },
-	{0xd7, {0x1f, 0x1f, 0x1f} },
-	{0xd8, {0x1f, 0x1f, 0x1f} },
-	{0xd9, {0x1f, 0x1f, 0x1f} },
-	{0xda, {0x1f, 0x1f, 0x1f} },
-	{0xdb, {0x1f, 0x1f, 0x1f} },
-	{0xdc, {0x1f, 0x1f, 0x1f} },
-	{0xdd, {0x1f, 0x1f, 0x1f} },
-	{0xde, {0x1f, 0x1f, 0x1f} },
-	{0xdf, {0x1f, 0x1f, 0x1f} },
-	{0xe0, {0x1f, 0x1f, 0x1f} },
-	{0xe1, {0x1f, 0x1f, 0x1f} },
-	{0xe2, {0x1f, 0x1f, 0x1f} },
-	{0xe3, {0x1f, 0x1f, 0x1f} },
-	{0xe4, {0x1f, 0x1f, 0x1f} },
-	{0xe5, {0x1f, 0x1f, 0x1f} },
-	{0xe6, {0x1f, 0x1f, 0x1f} },
-	{0xe7, {0x1f, 0x1f, 0x1f} },
-	{0xe8, {0x1f, 0x1f, 0x1f} },
-	{0xe9, {0x1f, 0x1f, 0x1f} },
-	{0xea, {0x1f, 0x1f, 0x1f} },
-	{0xeb, {0x1f, 0x1f, 0x1f} },
-	{0xec, {0x1f, 0x1f, 0x1f} },
-	{0xed, {0x1f, 0x1f, 0x1f} },
-	{0xee, {0x1f, 0x1f, 0x1f} },
-	{0xef, {0x1f, 0x1f, 0x1f} },
-	{0xf0, {0x1f, 0x1f, 0x1f} },
-	{0xf1, {0x1f, 0x1f, 0x1f} },
-	{0xf2, {0x1f, 0x1f, 0x1f} },
-	{0xf3, {0x1f, 0x1f, 0x1f} },
-	{0xf4, {0x1f, 0x1f, 0x1f} },
-	{0xf5, {0x1f, 0x1f, 0x1f} },
-	{0xf6, {0x1f, 0x1f, 0x1f} },
-	{0xf7, {0x1f, 0x1f, 0x1f} },
-	{0xf8, {0x1f, 0x1f, 0x1f} },
-	{0xf9, {0x1f, 0x1f, 0x1f} },
-	{0xfa, {0x1f, 0x1f, 0x1f} },
-	{0xfb, {0x1f, 0x1f, 0x1f} },
-	{0xfc, {0x1f, 0x1f, 0x1f} },
-	{0xfd, {0x1f, 0x1f, 0x1f} },
-	{0xfe, {0x1f, 0x1f, 0x1f} },
-	{0xff, {0x1f, 0x1f, 0x1f} },
-	{0xffffffff, {0, 0, 0} }
+static const u8 a38x_ctrl_phy_600[] = {
+	3,	/* subphys */
+	STATIC_IMG_BCAST | STATIC_IMG_ABS, 0x0, STATIC_IMG_U16(0x6),
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x10 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x11 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x12 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x13 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x14 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x15 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x16 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x17 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x18 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x19 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x20 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x21 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x22 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x23 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x24 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x25 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x26 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x27 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x28 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x29 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x30 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x31 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x32 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x33 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x34 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x35 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x36 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x37 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x38 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x39 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x40 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x41 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x42 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x43 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x44 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x45 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x46 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x47 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x48 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x49 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x50 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x51 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x52 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x53 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x54 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x55 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x56 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x57 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x58 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x59 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x60 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x61 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x62 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x63 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x64 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x65 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x66 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x67 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x68 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x69 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x70 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x71 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x72 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x73 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x74 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x75 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x76 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x77 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x78 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x79 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x80 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x81 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x82 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x83 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x84 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x85 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x86 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x87 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x88 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x89 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x2002),	/* 0x90 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x91 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1503),	/* 0x92 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x50),	/* 0x93 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x12),	/* 0x94 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xf),	/* 0x95 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x96 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x97 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x98 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x99 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1fff),	/* 0x9b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x254a),	/* 0xa4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x34e9),	/* 0xa5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xb6d),	/* 0xa6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x5d1),	/* 0xa7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x434),	/* 0xa8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xab */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xac */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xad */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xae */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xb2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xba */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xbe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xca */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xce */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xda */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xde */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xea */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xeb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xec */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xed */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xee */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xef */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xff */
+	STATIC_IMG_END
 };
 
-static struct mv_ddr_subphys_reg_config a38x_ctrl_phy_800[] = {
-	{0x0, {0x8, 0x8, 0x8} },
-	{0x1, {0x0, 0x0, 0x0} },
-	{0x2, {0x0, 0x0, 0x0} },
-	{0x3, {0x10, 0x10, 0x10} },
-	{0x4, {0x0, 0x0, 0x0} },
-	{0x5, {0x10, 0x10, 0x10} },
-	{0x6, {0x0, 0x0, 0x0} },
-	{0x7, {0x10, 0x10, 0x10} },
-	{0x8, {0x0, 0x0, 0x0} },
-	{0x9, {0x10, 0x10, 0x10} },
-	{0xa, {0x0, 0x0, 0x0} },
-	{0xb, {0x10, 0x10, 0x10} },
-	{0xc, {0x0, 0x0, 0x0} },
-	{0xd, {0x10, 0x10, 0x10} },
-	{0xe, {0x0, 0x0, 0x0} },
-	{0xf, {0x10, 0x10, 0x10} },
-	{0x10, {0x0, 0x0, 0x0} },
-	{0x11, {0x0, 0x0, 0x0} },
-	{0x12, {0x0, 0x0, 0x0} },
-	{0x13, {0x0, 0x0, 0x0} },
-	{0x14, {0x0, 0x0, 0x0} },
-	{0x15, {0x0, 0x0, 0x0} },
-	{0x16, {0x0, 0x0, 0x0} },
-	{0x17, {0x0, 0x0, 0x0} },
-	{0x18, {0x0, 0x0, 0x0} },
-	{0x19, {0x0, 0x0, 0x0} },
-	{0x1a, {0x0, 0x0, 0x0} },
-	{0x1b, {0x0, 0x0, 0x0} },
-	{0x1c, {0x0, 0x0, 0x0} },
-	{0x1d, {0x0, 0x0, 0x0} },
-	{0x1e, {0x0, 0x0, 0x0} },
-	{0x1f, {0x0, 0x0, 0x0} },
-	{0x20, {0x0, 0x0, 0x0} },
-	{0x21, {0x0, 0x0, 0x0} },
-	{0x22, {0x0, 0x0, 0x0} },
-	{0x23, {0x0, 0x0, 0x0} },
-	{0x24, {0x0, 0x0, 0x0} },
-	{0x25, {0x0, 0x0, 0x0} },
-	{0x26, {0x0, 0x0, 0x0} },
-	{0x27, {0x0, 0x0, 0x0} },
-	{0x28, {0x0, 0x0, 0x0} },
-	{0x29, {0x0, 0x0, 0x0} },
-	{0x2a, {0x0, 0x0, 0x0} },
-	{0x2b, {0x0, 0x0, 0x0} },
-	{0x2c, {0x0, 0x0, 0x0} },
-	{0x2d, {0x0, 0x0, 0x0} },
-	{0x2e, {0x0, 0x0, 0x0} },
-	{0x2f, {0x0, 0x0, 0x0} },
-	{0x30, {0x0, 0x0, 0x0} },
-	{0x31, {0x0, 0x0, 0x0} },
-	{0x32, {0x0, 0x0, 0x0} },
-	{0x33, {0x0, 0x0, 0x0} },
-	{0x34, {0x0, 0x0, 0x0} },
-	{0x35, {0x0, 0x0, 0x0} },
-	{0x36, {0x0, 0x0, 0x0} },
-	{0x37, {0x0, 0x0, 0x0} },
-	{0x38, {0x0, 0x0, 0x0} },
-	{0x39, {0x0, 0x0, 0x0} },
-	{0x3a, {0x0, 0x0, 0x0} },
-	{0x3b, {0x0, 0x0, 0x0} },
-	{0x3c, {0x0, 0x0, 0x0} },
-	{0x3d, {0x0, 0x0, 0x0} },
-	{0x3e, {0x0, 0x0, 0x0} },
-	{0x3f, {0x0, 0x0, 0x0} },
-	{0x40, {0x0, 0x0, 0x0} },
-	{0x41, {0x0, 0x0, 0x0} },
-	{0x42, {0x0, 0x0, 0x0} },
-	{0x43, {0x0, 0x0, 0x0} },
-	{0x44, {0x0, 0x0, 0x0} },
-	{0x45, {0x0, 0x0, 0x0} },
-	{0x46, {0x0, 0x0, 0x0} },
-	{0x47, {0x0, 0x0, 0x0} },
-	{0x48, {0x0, 0x0, 0x0} },
-	{0x49, {0x0, 0x0, 0x0} },
-	{0x4a, {0x0, 0x0, 0x0} },
-	{0x4b, {0x0, 0x0, 0x0} },
-	{0x4c, {0x0, 0x0, 0x0} },
-	{0x4d, {0x0, 0x0, 0x0} },
-	{0x4e, {0x0, 0x0, 0x0} },
-	{0x4f, {0x0, 0x0, 0x0} },
-	{0x50, {0x0, 0x0, 0x0} },
-	{0x51, {0x0, 0x0, 0x0} },
-	{0x52, {0x0, 0x0, 0x0} },
-	{0x53, {0x0, 0x0, 0x0} },
-	{0x54, {0x0, 0x0, 0x0} },
-	{0x55, {0x0, 0x0, 0x0} },
-	{0x56, {0x0, 0x0, 0x0} },
-	{0x57, {0x0, 0x0, 0x0} },
-	{0x58, {0x0, 0x0, 0x0} },
-	{0x59, {0x0, 0x0, 0x0} },
-	{0x5a, {0x0, 0x0, 0x0} },
-	{0x5b, {0x0, 0x0, 0x0} },
-	{0x5c, {0x0, 0x0, 0x0} },
-	{0x5d, {0x0, 0x0, 0x0} },
-	{0x5e, {0x0, 0x0, 0x0} },
-	{0x5f, {0x0, 0x0, 0x0} },
-	{0x60, {0x0, 0x0, 0x0} },
-	{0x61, {0x0, 0x0, 0x0} },
-	{0x62, {0x0, 0x0, 0x0} },
-	{0x63, {0x0, 0x0, 0x0} },
-	{0x64, {0x0, 0x0, 0x0} },
-	{0x65, {0x0, 0x0, 0x0} },
-	{0x66, {0x0, 0x0, 0x0} },
-	{0x67, {0x0, 0x0, 0x0} },
-	{0x68, {0x0, 0x0, 0x0} },
-	{0x69, {0x0, 0x0, 0x0} },
-	{0x6a, {0x0, 0x0, 0x0} },
-	{0x6b, {0x0, 0x0, 0x0} },
-	{0x6c, {0x0, 0x0, 0x0} },
-	{0x6d, {0x0, 0x0, 0x0} },
-	{0x6e, {0x0, 0x0, 0x0} },
-	{0x6f, {0x0, 0x0, 0x0} },
-	{0x70, {0x0, 0x0, 0x0} },
-	{0x71, {0x0, 0x0, 0x0} },
-	{0x72, {0x0, 0x0, 0x0} },
-	{0x73, {0x0, 0x0, 0x0} },
-	{0x74, {0x0, 0x0, 0x0} },
-	{0x75, {0x0, 0x0, 0x0} },
-	{0x76, {0x0, 0x0, 0x0} },
-	{0x77, {0x0, 0x0, 0x0} },
-	{0x78, {0x0, 0x0, 0x0} },
-	{0x79, {0x0, 0x0, 0x0} },
-	{0x7a, {0x0, 0x0, 0x0} },
-	{0x7b, {0x0, 0x0, 0x0} },
-	{0x7c, {0x0, 0x0, 0x0} },
-	{0x7d, {0x0, 0x0, 0x0} },
-	{0x7e, {0x0, 0x0, 0x0} },
-	{0x7f, {0x0, 0x0, 0x0} },
-	{0x80, {0x0, 0x0, 0x0} },
-	{0x81, {0x0, 0x0, 0x0} },
-	{0x82, {0x0, 0x0, 0x0} },
-	{0x83, {0x0, 0x0, 0x0} },
-	{0x84, {0x0, 0x0, 0x0} },
-	{0x85, {0x0, 0x0, 0x0} },
-	{0x86, {0x0, 0x0, 0x0} },
-	{0x87, {0x0, 0x0, 0x0} },
-	{0x88, {0x0, 0x0, 0x0} },
-	{0x89, {0x0, 0x0, 0x0} },
-	{0x8a, {0x0, 0x0, 0x0} },
-	{0x8b, {0x0, 0x0, 0x0} },
-	{0x8c, {0x0, 0x0, 0x0} },
-	{0x8d, {0x0, 0x0, 0x0} },
-	{0x8e, {0x0, 0x0, 0x0} },
-	{0x8f, {0x0, 0x0, 0x0} },
-	{0x90, {0x2002, 0x2002, 0x2002} },
-	{0x91, {0x0, 0x0, 0x0} },
-	{0x92, {0x1503, 0x1503, 0x1503} },
-	{0x93, {0x50, 0x50, 0x50} },
-	{0x94, {0x12, 0x12, 0x12} },
-	{0x95, {0xf, 0xf, 0xf} },
-	{0x96, {0x0, 0x0, 0x0} },
-	{0x97, {0x0, 0x0, 0x0} },
-	{0x98, {0x0, 0x0, 0x0} },
-	{0x99, {0x0, 0x0, 0x0} },
-	{0x9a, {0x1, 0x1, 0x1} },
-	{0x9b, {0x1fff, 0x1fff, 0x1fff} },
-	{0x9c, {0x1, 0x1, 0x1} },
-	{0x9d, {0x0, 0x0, 0x0} },
-	{0x9e, {0x0, 0x0, 0x0} },
-	{0x9f, {0x0, 0x0, 0x0} },
-	{0xa0, {0x0, 0x0, 0x0} },
-	{0xa1, {0x7ff, 0x7ff, 0x7ff} },
-	{0xa2, {0x0, 0x0, 0x0} },
-	{0xa3, {0x7ff, 0x7ff, 0x7ff} },
-	{0xa4, {0x254a, 0x254a, 0x254a} },
-	{0xa5, {0x34e9, 0x34e9, 0x34e9} },
-	{0xa6, {0xb6d, 0xb6d, 0xb6d} },
-	{0xa7, {0x5d1, 0x5d1, 0x5d1} },
-	{0xa8, {0x434, 0x434, 0x434} },
-	{0xa9, {0x0, 0x0, 0x0} },
-	{0xaa, {0x0, 0x0, 0x0} },
-	{0xab, {0x0, 0x0, 0x0} },
-	{0xac, {0x0, 0x0, 0x0} },
-	{0xad, {0x0, 0x0, 0x0} },
-	{0xae, {0x0, 0x0, 0x0} },
-	{0xaf, {0x0, 0x0, 0x0} },
-	{0xb0, {0x0, 0x0, 0x0} },
-	{0xb1, {0x0, 0x0, 0x0} },
-	{0xb2, {0x1, 0x1, 0x1} },
-	{0xb3, {0x0, 0x0, 0x0} },
-	{0xb4, {0x0, 0x0, 0x0} },
-	{0xb5, {0x0, 0x0, 0x0} },
-	{0xb6, {0x0, 0x0, 0x0} },
-	{0xb7, {0x0, 0x0, 0x0} },
-	{0xb8, {0x0, 0x0, 0x0} },
-	{0xb9, {0x0, 0x0, 0x0} },
-	{0xba, {0x0, 0x0, 0x0} },
-	{0xbb, {0x0, 0x0, 0x0} },
-	{0xbc, {0x0, 0x0, 0x0} },
-	{0xbd, {0x0, 0x0, 0x0} },
-	{0xbe, {0x1, 0x1, 0x1} },
-	{0xbf, {0x0, 0x0, 0x0} },
-	{0xc0, {0x0, 0x0, 0x0} },
-	{0xc1, {0x0, 0x0, 0x0} },
-	{0xc2, {0x0, 0x0, 0x0} },
-	{0xc3, {0x0, 0x0, 0x0} },
-	{0xc4, {0x0, 0x0, 0x0} },
-	{0xc5, {0x0, 0x0, 0x0} },
-	{0xc6, {0x0, 0x0, 0x0} },
-	{0xc7, {0x0, 0x0, 0x0} },
-	{0xc8, {0x0, 0x0, 0x0} },
-	{0xc9, {0x0, 0x0, 0x0} },
-	{0xca, {0x0, 0x0, 0x0} },
-	{0xcb, {0x0, 0x0, 0x0} },
-	{0xcc, {0x0, 0x0, 0x0} },
-	{0xcd, {0x0, 0x0, 0x0} },
-	{0xce, {0x0, 0x0, 0x0} },
-	{0xcf, {0x0, 0x0, 0x0} },
-	{0xd0, {0x1f, 0x1f, 0x1f} },
-	{0xd1, {0x1f, 0x1f, 0x1f} },
-	{0xd2, {0x1f, 0x1f, 0x1f} },
-	{0xd3, {0x1f, 0x1f, 0x1f} },
-	{0xd4, {0x1f, 0x1f, 0x1f} },
-	{0xd5, {0x1f, 0x1f, 0x1f} },
-	{0xd6, {0x1f, 0x1f, 0x1f} },
-	{0xd7, {0x1f, 0x1f, 0x1f} },
-	{0xd8, {0x1f, 0x1f, 0x1f} },
-	{0xd9, {0x1f, 0x1f, 0x1f} },
-	{0xda, {0x1f, 0x1f, 0x1f} },
-	{0xdb, {0x1f, 0x1f, 0x1f} },
-	{0xdc, {0x1f, 0x1f, 0x1f} },
-	{0xdd, {0x1f, 0x1f, 0x1f} },
-	{0xde, {0x1f, 0x1f, 0x1f} },
-	{0xdf, {0x1f, 0x1f, 0x1f} },
-	{0xe0, {0x1f, 0x1f, 0x1f} },
-	{0xe1, {0x1f, 0x1f, 0x1f} },
-	{0xe2, {0x1f, 0x1f, 0x1f} },
-	{0xe3, {0x1f, 0x1f, 0x1f} },
-	{0xe4, {0x1f, 0x1f, 0x1f} },
-	{0xe5, {0x1f, 0x1f, 0x1f} },
-	{0xe6, {0x1f, 0x1f, 0x1f} },
-	{0xe7, {0x1f, 0x1f, 0x1f} },
-	{0xe8, {0x1f, 0x1f, 0x1f} },
-	{0xe9, {0x1f, 0x1f, 0x1f} },
-	{0xea, {0x1f, 0x1f, 0x1f} },
-	{0xeb, {0x1f, 0x1f, 0x1f} },
-	{0xec, {0x1f, 0x1f, 0x1f} },
-	{0xed, {0x1f, 0x1f, 0x1f} },
-	{0xee, {0x1f, 0x1f, 0x1f} },
-	{0xef, {0x1f, 0x1f, 0x1f} },
-	{0xf0, {0x1f, 0x1f, 0x1f} },
-	{0xf1, {0x1f, 0x1f, 0x1f} },
-	{0xf2, {0x1f, 0x1f, 0x1f} },
-	{0xf3, {0x1f, 0x1f, 0x1f} },
-	{0xf4, {0x1f, 0x1f, 0x1f} },
-	{0xf5, {0x1f, 0x1f, 0x1f} },
-	{0xf6, {0x1f, 0x1f, 0x1f} },
-	{0xf7, {0x1f, 0x1f, 0x1f} },
-	{0xf8, {0x1f, 0x1f, 0x1f} },
-	{0xf9, {0x1f, 0x1f, 0x1f} },
-	{0xfa, {0x1f, 0x1f, 0x1f} },
-	{0xfb, {0x1f, 0x1f, 0x1f} },
-	{0xfc, {0x1f, 0x1f, 0x1f} },
-	{0xfd, {0x1f, 0x1f, 0x1f} },
-	{0xfe, {0x1f, 0x1f, 0x1f} },
-	{0xff, {0x1f, 0x1f, 0x1f} },
-	{0xffffffff, {0, 0, 0} }
+static const u8 a38x_ctrl_phy_800[] = {
+	3,	/* subphys */
+	STATIC_IMG_BCAST | STATIC_IMG_ABS, 0x0, STATIC_IMG_U16(0x8),
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x10 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x11 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x12 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x13 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x14 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x15 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x16 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x17 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x18 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x19 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x20 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x21 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x22 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x23 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x24 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x25 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x26 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x27 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x28 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x29 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x30 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x31 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x32 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x33 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x34 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x35 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x36 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x37 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x38 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x39 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x40 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x41 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x42 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x43 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x44 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x45 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x46 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x47 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x48 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x49 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x50 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x51 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x52 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x53 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x54 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x55 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x56 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x57 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x58 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x59 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x60 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x61 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x62 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x63 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x64 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x65 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x66 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x67 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x68 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x69 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x70 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x71 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x72 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x73 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x74 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x75 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x76 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x77 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x78 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x79 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x80 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x81 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x82 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x83 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x84 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x85 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x86 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x87 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x88 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x89 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x2002),	/* 0x90 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x91 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1503),	/* 0x92 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x50),	/* 0x93 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x12),	/* 0x94 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xf),	/* 0x95 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x96 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x97 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x98 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x99 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1fff),	/* 0x9b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x254a),	/* 0xa4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x34e9),	/* 0xa5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xb6d),	/* 0xa6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x5d1),	/* 0xa7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x434),	/* 0xa8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xab */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xac */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xad */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xae */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xb2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xba */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xbe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xca */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xce */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xda */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xde */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xdf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xea */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xeb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xec */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xed */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xee */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xef */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xfe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xff */
+	STATIC_IMG_END
 };
 
-static struct mv_ddr_subphys_reg_config a38x_data_phy_600[] = {
-	{0x0, {0x4c0b, 0x2441, 0x6812, 0x4c0b} },
-	{0x1, {0x15, 0xc, 0x1c, 0x14} },
-	{0x2, {0xca, 0x107, 0x109, 0xd2} },
-	{0x3, {0xd, 0xc, 0xc, 0xf} },
-	{0x4, {0x4c0b, 0x2842, 0x6c13, 0x540d} },
-	{0x5, {0x16, 0xc, 0x1c, 0x16} },
-	{0x6, {0xca, 0x105, 0x10a, 0xd3} },
-	{0x7, {0xd, 0xc, 0xe, 0x10} },
-	{0x8, {0x0, 0x0, 0x0, 0x0} },
-	{0x9, {0x10, 0x10, 0x10, 0x10} },
-	{0xa, {0x0, 0x0, 0x0, 0x0} },
-	{0xb, {0x10, 0x10, 0x10, 0x10} },
-	{0xc, {0x0, 0x0, 0x0, 0x0} },
-	{0xd, {0x10, 0x10, 0x10, 0x10} },
-	{0xe, {0x0, 0x0, 0x0, 0x0} },
-	{0xf, {0x10, 0x10, 0x10, 0x10} },
-	{0x10, {0x6, 0x2, 0x3, 0x1} },
-	{0x11, {0x5, 0x5, 0x0, 0x1} },
-	{0x12, {0x2, 0x3, 0x6, 0x1} },
-	{0x13, {0x3, 0x1, 0x5, 0x1} },
-	{0x14, {0x3, 0x2, 0x6, 0x1} },
-	{0x15, {0x3, 0x2, 0x6, 0x1} },
-	{0x16, {0x4, 0x1, 0x7, 0x3} },
-	{0x17, {0x5, 0x4, 0x4, 0x2} },
-	{0x18, {0x3, 0x0, 0xd, 0x0} },
-	{0x19, {0x0, 0x1, 0x7, 0x0} },
-	{0x1a, {0x0, 0x0, 0x0, 0x0} },
-	{0x1b, {0x0, 0x0, 0x0, 0x0} },
-	{0x1c, {0x0, 0x0, 0x0, 0x0} },
-	{0x1d, {0x0, 0x0, 0x0, 0x0} },
-	{0x1e, {0x0, 0x0, 0x0, 0x0} },
-	{0x1f, {0x10, 0x10, 0x10, 0x10} },
-	{0x20, {0x2, 0x2, 0x6, 0x5} },
-	{0x21, {0x3, 0x4, 0x0, 0x3} },
-	{0x22, {0x3, 0x3, 0x7, 0x4} },
-	{0x23, {0x1, 0x4, 0x5, 0x7} },
-	{0x24, {0x3, 0x2, 0x4, 0x3} },
-	{0x25, {0x3, 0x2, 0x4, 0x3} },
-	{0x26, {0x4, 0x5, 0x7, 0x5} },
-	{0x27, {0x6, 0x4, 0x4, 0x7} },
-	{0x28, {0x1, 0x0, 0x9, 0x0} },
-	{0x29, {0x0, 0x4, 0x9, 0x5} },
-	{0x2a, {0x0, 0x0, 0x0, 0x0} },
-	{0x2b, {0x0, 0x0, 0x0, 0x0} },
-	{0x2c, {0x0, 0x0, 0x0, 0x0} },
-	{0x2d, {0x0, 0x0, 0x0, 0x0} },
-	{0x2e, {0x0, 0x0, 0x0, 0x0} },
-	{0x2f, {0xc, 0xc, 0xc, 0xc} },
-	{0x30, {0x0, 0x0, 0x0, 0x0} },
-	{0x31, {0x0, 0x0, 0x0, 0x0} },
-	{0x32, {0x0, 0x0, 0x0, 0x0} },
-	{0x33, {0x0, 0x0, 0x0, 0x0} },
-	{0x34, {0x0, 0x0, 0x0, 0x0} },
-	{0x35, {0x0, 0x0, 0x0, 0x0} },
-	{0x36, {0x0, 0x0, 0x0, 0x0} },
-	{0x37, {0x0, 0x0, 0x0, 0x0} },
-	{0x38, {0x0, 0x0, 0x0, 0x0} },
-	{0x39, {0x0, 0x0, 0x0, 0x0} },
-	{0x3a, {0x0, 0x0, 0x0, 0x0} },
-	{0x3b, {0x0, 0x0, 0x0, 0x0} },
-	{0x3c, {0x0, 0x0, 0x0, 0x0} },
-	{0x3d, {0x0, 0x0, 0x0, 0x0} },
-	{0x3e, {0x0, 0x0, 0x0, 0x0} },
-	{0x3f, {0x0, 0x0, 0x0, 0x0} },
-	{0x40, {0x0, 0x0, 0x0, 0x0} },
-	{0x41, {0x0, 0x0, 0x0, 0x0} },
-	{0x42, {0x0, 0x0, 0x0, 0x0} },
-	{0x43, {0x0, 0x0, 0x0, 0x0} },
-	{0x44, {0x0, 0x0, 0x0, 0x0} },
-	{0x45, {0x0, 0x0, 0x0, 0x0} },
-	{0x46, {0x0, 0x0, 0x0, 0x0} },
-	{0x47, {0x0, 0x0, 0x0, 0x0} },
-	{0x48, {0x0, 0x0, 0x0, 0x0} },
-	{0x49, {0x0, 0x0, 0x0, 0x0} },
-	{0x4a, {0x0, 0x0, 0x0, 0x0} },
-	{0x4b, {0x0, 0x0, 0x0, 0x0} },
-	{0x4c, {0x0, 0x0, 0x0, 0x0} },
-	{0x4d, {0x0, 0x0, 0x0, 0x0} },
-	{0x4e, {0x0, 0x0, 0x0, 0x0} },
-	{0x4f, {0x0, 0x0, 0x0, 0x0} },
-	{0x50, {0xc, 0xe, 0xc, 0xb} },
-	{0x51, {0xc, 0x12, 0xa, 0xb} },
-	{0x52, {0xb, 0xe, 0x10, 0xb} },
-	{0x53, {0xc, 0xe, 0xc, 0xb} },
-	{0x54, {0x4, 0x4, 0x4, 0x1} },
-	{0x55, {0x4, 0x4, 0x4, 0x1} },
-	{0x56, {0xc, 0xd, 0xd, 0xa} },
-	{0x57, {0xc, 0xd, 0xb, 0xd} },
-	{0x58, {0x12, 0xa, 0x12, 0xa} },
-	{0x59, {0xa, 0xf, 0x10, 0xd} },
-	{0x5a, {0x0, 0x0, 0x0, 0x0} },
-	{0x5b, {0x0, 0x0, 0x0, 0x0} },
-	{0x5c, {0x0, 0x0, 0x0, 0x0} },
-	{0x5d, {0x0, 0x0, 0x0, 0x0} },
-	{0x5e, {0x0, 0x0, 0x0, 0x0} },
-	{0x5f, {0xc, 0xc, 0xc, 0xc} },
-	{0x60, {0xb, 0xe, 0x10, 0x13} },
-	{0x61, {0xc, 0xe, 0xa, 0xd} },
-	{0x62, {0xc, 0xc, 0x10, 0x10} },
-	{0x63, {0xd, 0xf, 0xe, 0xf} },
-	{0x64, {0x2, 0x3, 0x9, 0x4} },
-	{0x65, {0x2, 0x3, 0x9, 0x4} },
-	{0x66, {0xe, 0xd, 0x10, 0xc} },
-	{0x67, {0xc, 0x11, 0xe, 0x12} },
-	{0x68, {0xc, 0xa, 0x14, 0xa} },
-	{0x69, {0xa, 0xc, 0x1c, 0xc} },
-	{0x6a, {0x0, 0x0, 0x0, 0x0} },
-	{0x6b, {0x0, 0x0, 0x0, 0x0} },
-	{0x6c, {0x0, 0x0, 0x0, 0x0} },
-	{0x6d, {0x0, 0x0, 0x0, 0x0} },
-	{0x6e, {0x0, 0x0, 0x0, 0x0} },
-	{0x6f, {0x17, 0x17, 0x17, 0x17} },
-	{0x70, {0x0, 0x0, 0x0, 0x0} },
-	{0x71, {0x0, 0x0, 0x0, 0x0} },
-	{0x72, {0x0, 0x0, 0x0, 0x0} },
-	{0x73, {0x0, 0x0, 0x0, 0x0} },
-	{0x74, {0x0, 0x0, 0x0, 0x0} },
-	{0x75, {0x0, 0x0, 0x0, 0x0} },
-	{0x76, {0x0, 0x0, 0x0, 0x0} },
-	{0x77, {0x0, 0x0, 0x0, 0x0} },
-	{0x78, {0x0, 0x0, 0x0, 0x0} },
-	{0x79, {0x0, 0x0, 0x0, 0x0} },
-	{0x7a, {0x0, 0x0, 0x0, 0x0} },
-	{0x7b, {0x0, 0x0, 0x0, 0x0} },
-	{0x7c, {0x0, 0x0, 0x0, 0x0} },
-	{0x7d, {0x0, 0x0, 0x0, 0x0} },
-	{0x7e, {0x0, 0x0, 0x0, 0x0} },
-	{0x7f, {0x0, 0x0, 0x0, 0x0} },
-	{0x80, {0x0, 0x0, 0x0, 0x0} },
-	{0x81, {0x0, 0x0, 0x0, 0x0} },
-	{0x82, {0x0, 0x0, 0x0, 0x0} },
-	{0x83, {0x0, 0x0, 0x0, 0x0} },
-	{0x84, {0x0, 0x0, 0x0, 0x0} },
-	{0x85, {0x0, 0x0, 0x0, 0x0} },
-	{0x86, {0x0, 0x0, 0x0, 0x0} },
-	{0x87, {0x0, 0x0, 0x0, 0x0} },
-	{0x88, {0x0, 0x0, 0x0, 0x0} },
-	{0x89, {0x0, 0x0, 0x0, 0x0} },
-	{0x8a, {0x0, 0x0, 0x0, 0x0} },
-	{0x8b, {0x0, 0x0, 0x0, 0x0} },
-	{0x8c, {0x0, 0x0, 0x0, 0x0} },
-	{0x8d, {0x0, 0x0, 0x0, 0x0} },
-	{0x8e, {0x0, 0x0, 0x0, 0x0} },
-	{0x8f, {0x0, 0x0, 0x0, 0x0} },
-	{0x90, {0x6002, 0x6002, 0x6002, 0x6002} },
-	{0x91, {0x0, 0x0, 0x0, 0x0} },
-	{0x92, {0x1503, 0x1503, 0x1503, 0x1503} },
-	{0x93, {0x50, 0x50, 0x50, 0x50} },
-	{0x94, {0x12, 0x12, 0x12, 0x12} },
-	{0x95, {0xf, 0xf, 0xf, 0xf} },
-	{0x96, {0x0, 0x0, 0x0, 0x0} },
-	{0x97, {0x0, 0x0, 0x0, 0x0} },
-	{0x98, {0x0, 0x0, 0x0, 0x0} },
-	{0x99, {0x0, 0x0, 0x0, 0x0} },
-	{0x9a, {0x1, 0x1, 0x1, 0x1} },
-	{0x9b, {0x1fff, 0x1fff, 0x1fff, 0x1fff} },
-	{0x9c, {0x1, 0x1, 0x1, 0x1} },
-	{0x9d, {0x0, 0x0, 0x0, 0x0} },
-	{0x9e, {0x0, 0x0, 0x0, 0x0} },
-	{0x9f, {0x0, 0x0, 0x0, 0x0} },
-	{0xa0, {0x0, 0x0, 0x0, 0x0} },
-	{0xa1, {0x7ff, 0x7ff, 0x7ff, 0x7ff} },
-	{0xa2, {0x0, 0x0, 0x0, 0x0} },
-	{0xa3, {0x7ff, 0x7ff, 0x7ff, 0x7ff} },
-	{0xa4, {0x3dfb, 0x3dfb, 0x3dfb, 0x3dfb} },
-	{0xa5, {0x34e9, 0x34e9, 0x34e9, 0x34e9} },
-	{0xa6, {0xb6d, 0xb6d, 0xb6d, 0xb6d} },
-	{0xa7, {0x5d1, 0x5d1, 0x5d1, 0x5d1} },
-	{0xa8, {0x434, 0x434, 0x434, 0x434} },
-	{0xa9, {0x0, 0x0, 0x0, 0x0} },
-	{0xaa, {0x0, 0x0, 0x0, 0x0} },
-	{0xab, {0x0, 0x0, 0x0, 0x0} },
-	{0xac, {0x0, 0x0, 0x0, 0x0} },
-	{0xad, {0x0, 0x0, 0x0, 0x0} },
-	{0xae, {0x0, 0x0, 0x0, 0x0} },
-	{0xaf, {0x0, 0x0, 0x0, 0x0} },
-	{0xb0, {0x0, 0x0, 0x0, 0x0} },
-	{0xb1, {0x0, 0x0, 0x0, 0x0} },
-	{0xb2, {0x1, 0x1, 0x1, 0x1} },
-	{0xb3, {0x0, 0x0, 0x0, 0x0} },
-	{0xb4, {0x0, 0x0, 0x0, 0x0} },
-	{0xb5, {0x0, 0x0, 0x0, 0x0} },
-	{0xb6, {0x0, 0x0, 0x0, 0x0} },
-	{0xb7, {0x0, 0x0, 0x0, 0x0} },
-	{0xb8, {0x0, 0x0, 0x0, 0x0} },
-	{0xb9, {0x0, 0x0, 0x0, 0x0} },
-	{0xba, {0x0, 0x0, 0x0, 0x0} },
-	{0xbb, {0x0, 0x0, 0x0, 0x0} },
-	{0xbc, {0x0, 0x0, 0x0, 0x0} },
-	{0xbd, {0x0, 0x0, 0x0, 0x0} },
-	{0xbe, {0x1, 0x1, 0x1, 0x1} },
-	{0xbf, {0x0, 0x0, 0x0, 0x0} },
-	{0xc0, {0x39c, 0x33a, 0x33c, 0x35b} },
-	{0xc1, {0x39b, 0x33a, 0x2fc, 0x35b} },
-	{0xc2, {0x0, 0x0, 0x0, 0x0} },
-	{0xc3, {0x0, 0x0, 0x0, 0x0} },
-	{0xc4, {0x0, 0x0, 0x0, 0x0} },
-	{0xc5, {0x0, 0x0, 0x0, 0x0} },
-	{0xc6, {0x0, 0x0, 0x0, 0x0} },
-	{0xc7, {0x0, 0x0, 0x0, 0x0} },
-	{0xc8, {0x0, 0x0, 0x0, 0x0} },
-	{0xc9, {0x0, 0x0, 0x0, 0x0} },
-	{0xca, {0x0, 0x0, 0x0, 0x0} },
-	{0xcb, {0x0, 0x0, 0x0, 0x0} },
-	{0xcc, {0x0, 0x0, 0x0, 0x0} },
-	{0xcd, {0x0, 0x0, 0x0, 0x0} },
-	{0xce, {0x0, 0x0, 0x0, 0x0} },
-	{0xcf, {0x0, 0x0, 0x0, 0x0} },
-	{0xd0, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd1, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd4, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xd5, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xd6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd8, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd9, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xda, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdc, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdd, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xde, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdf, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe0, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xe1, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xe2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe4, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe5, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe8, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe9, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xea, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xeb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xec, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xed, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xee, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xef, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf0, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf1, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf4, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf5, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf8, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xf9, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xfa, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfc, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfd, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfe, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xff, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xffffffff, {0, 0, 0, 0} }
+static const u8 a38x_data_phy_600[] = {
+	4,	/* subphys */
+	STATIC_IMG_ABS, 0x0, STATIC_IMG_U16(0x4c0b), STATIC_IMG_U16(0x2441), STATIC_IMG_U16(0x6812), STATIC_IMG_U16(0x4c0b),
+	1, STATIC_IMG_U16(0x15), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x1c), STATIC_IMG_U16(0x14),	/* 0x1 */
+	1, STATIC_IMG_U16(0xca), STATIC_IMG_U16(0x107), STATIC_IMG_U16(0x109), STATIC_IMG_U16(0xd2),	/* 0x2 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xf),	/* 0x3 */
+	1, STATIC_IMG_U16(0x4c0b), STATIC_IMG_U16(0x2842), STATIC_IMG_U16(0x6c13), STATIC_IMG_U16(0x540d),	/* 0x4 */
+	1, STATIC_IMG_U16(0x16), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x1c), STATIC_IMG_U16(0x16),	/* 0x5 */
+	1, STATIC_IMG_U16(0xca), STATIC_IMG_U16(0x105), STATIC_IMG_U16(0x10a), STATIC_IMG_U16(0xd3),	/* 0x6 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0x10),	/* 0x7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xf */
+	1, STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x1),	/* 0x10 */
+	1, STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x1),	/* 0x11 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x1),	/* 0x12 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x1),	/* 0x13 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x1),	/* 0x14 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x1),	/* 0x15 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x3),	/* 0x16 */
+	1, STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x2),	/* 0x17 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0x0),	/* 0x18 */
+	1, STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x0),	/* 0x19 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x1f */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x5),	/* 0x20 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x3),	/* 0x21 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x4),	/* 0x22 */
+	1, STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x7),	/* 0x23 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x3),	/* 0x24 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x3),	/* 0x25 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x5),	/* 0x26 */
+	1, STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x7),	/* 0x27 */
+	1, STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x9), STATIC_IMG_U16(0x0),	/* 0x28 */
+	1, STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x9), STATIC_IMG_U16(0x5),	/* 0x29 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xc),	/* 0x2f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x30 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x31 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x32 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x33 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x34 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x35 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x36 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x37 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x38 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x39 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x40 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x41 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x42 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x43 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x44 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x45 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x46 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x47 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x48 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x49 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4f */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xb),	/* 0x50 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x12), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xb),	/* 0x51 */
+	1, STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xb),	/* 0x52 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xb),	/* 0x53 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x1),	/* 0x54 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x1),	/* 0x55 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xa),	/* 0x56 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xd),	/* 0x57 */
+	1, STATIC_IMG_U16(0x12), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x12), STATIC_IMG_U16(0xa),	/* 0x58 */
+	1, STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xd),	/* 0x59 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xc),	/* 0x5f */
+	1, STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0x13),	/* 0x60 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xd),	/* 0x61 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0x10),	/* 0x62 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xf),	/* 0x63 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x9), STATIC_IMG_U16(0x4),	/* 0x64 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x9), STATIC_IMG_U16(0x4),	/* 0x65 */
+	1, STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xc),	/* 0x66 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x11), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0x12),	/* 0x67 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x14), STATIC_IMG_U16(0xa),	/* 0x68 */
+	1, STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x1c), STATIC_IMG_U16(0xc),	/* 0x69 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x17),	/* 0x6f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x70 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x71 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x72 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x73 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x74 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x75 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x76 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x77 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x78 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x79 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x80 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x81 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x82 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x83 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x84 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x85 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x86 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x87 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x88 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x89 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x6002),	/* 0x90 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x91 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1503),	/* 0x92 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x50),	/* 0x93 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x12),	/* 0x94 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xf),	/* 0x95 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x96 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x97 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x98 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x99 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1fff),	/* 0x9b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3dfb),	/* 0xa4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x34e9),	/* 0xa5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xb6d),	/* 0xa6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x5d1),	/* 0xa7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x434),	/* 0xa8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xab */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xac */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xad */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xae */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xb2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xba */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xbe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbf */
+	1, STATIC_IMG_U16(0x39c), STATIC_IMG_U16(0x33a), STATIC_IMG_U16(0x33c), STATIC_IMG_U16(0x35b),	/* 0xc0 */
+	1, STATIC_IMG_U16(0x39b), STATIC_IMG_U16(0x33a), STATIC_IMG_U16(0x2fc), STATIC_IMG_U16(0x35b),	/* 0xc1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xca */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xce */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xda */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xde */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xea */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xeb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xec */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xed */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xee */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xef */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xff */
+	STATIC_IMG_END
 };
 
-static struct mv_ddr_subphys_reg_config a38x_data_phy_800[] = {
-	{0x0, {0x6411, 0x544d, 0x7c17, 0x6010} },
-	{0x1, {0x19, 0x16, 0x1f, 0x17} },
-	{0x2, {0xc, 0x51, 0x57, 0x1d} },
-	{0x3, {0xf, 0xc, 0xa, 0xd} },
-	{0x4, {0x6010, 0x544d, 0x8018, 0x6010} },
-	{0x5, {0x18, 0x15, 0x1f, 0x17} },
-	{0x6, {0xd, 0x52, 0x58, 0x1d} },
-	{0x7, {0x10, 0xb, 0xb, 0xe} },
-	{0x8, {0x0, 0x0, 0x0, 0x0} },
-	{0x9, {0x10, 0x10, 0x10, 0x10} },
-	{0xa, {0x0, 0x0, 0x0, 0x0} },
-	{0xb, {0x10, 0x10, 0x10, 0x10} },
-	{0xc, {0x0, 0x0, 0x0, 0x0} },
-	{0xd, {0x10, 0x10, 0x10, 0x10} },
-	{0xe, {0x0, 0x0, 0x0, 0x0} },
-	{0xf, {0x10, 0x10, 0x10, 0x10} },
-	{0x10, {0x6, 0x1, 0x3, 0x2} },
-	{0x11, {0x4, 0x4, 0x0, 0x1} },
-	{0x12, {0x2, 0x2, 0x7, 0x2} },
-	{0x13, {0x3, 0x0, 0x5, 0x2} },
-	{0x14, {0x3, 0x2, 0x6, 0x2} },
-	{0x15, {0x3, 0x2, 0x6, 0x2} },
-	{0x16, {0x4, 0x1, 0x7, 0x4} },
-	{0x17, {0x4, 0x3, 0x5, 0x3} },
-	{0x18, {0x2, 0x1, 0xd, 0x1} },
-	{0x19, {0x0, 0x0, 0x8, 0x0} },
-	{0x1a, {0x0, 0x0, 0x0, 0x0} },
-	{0x1b, {0x0, 0x0, 0x0, 0x0} },
-	{0x1c, {0x0, 0x0, 0x0, 0x0} },
-	{0x1d, {0x0, 0x0, 0x0, 0x0} },
-	{0x1e, {0x0, 0x0, 0x0, 0x0} },
-	{0x1f, {0xe, 0xe, 0xe, 0xe} },
-	{0x20, {0x2, 0x1, 0x7, 0x6} },
-	{0x21, {0x3, 0x3, 0x0, 0x2} },
-	{0x22, {0x4, 0x2, 0x8, 0x4} },
-	{0x23, {0x2, 0x3, 0x5, 0x7} },
-	{0x24, {0x3, 0x2, 0x5, 0x3} },
-	{0x25, {0x3, 0x2, 0x5, 0x3} },
-	{0x26, {0x5, 0x4, 0x8, 0x5} },
-	{0x27, {0x6, 0x3, 0x5, 0x7} },
-	{0x28, {0x2, 0x0, 0xa, 0x0} },
-	{0x29, {0x0, 0x3, 0xa, 0x5} },
-	{0x2a, {0x0, 0x0, 0x0, 0x0} },
-	{0x2b, {0x0, 0x0, 0x0, 0x0} },
-	{0x2c, {0x0, 0x0, 0x0, 0x0} },
-	{0x2d, {0x0, 0x0, 0x0, 0x0} },
-	{0x2e, {0x0, 0x0, 0x0, 0x0} },
-	{0x2f, {0xf, 0xf, 0xf, 0xf} },
-	{0x30, {0x0, 0x0, 0x0, 0x0} },
-	{0x31, {0x0, 0x0, 0x0, 0x0} },
-	{0x32, {0x0, 0x0, 0x0, 0x0} },
-	{0x33, {0x0, 0x0, 0x0, 0x0} },
-	{0x34, {0x0, 0x0, 0x0, 0x0} },
-	{0x35, {0x0, 0x0, 0x0, 0x0} },
-	{0x36, {0x0, 0x0, 0x0, 0x0} },
-	{0x37, {0x0, 0x0, 0x0, 0x0} },
-	{0x38, {0x0, 0x0, 0x0, 0x0} },
-	{0x39, {0x0, 0x0, 0x0, 0x0} },
-	{0x3a, {0x0, 0x0, 0x0, 0x0} },
-	{0x3b, {0x0, 0x0, 0x0, 0x0} },
-	{0x3c, {0x0, 0x0, 0x0, 0x0} },
-	{0x3d, {0x0, 0x0, 0x0, 0x0} },
-	{0x3e, {0x0, 0x0, 0x0, 0x0} },
-	{0x3f, {0x0, 0x0, 0x0, 0x0} },
-	{0x40, {0x0, 0x0, 0x0, 0x0} },
-	{0x41, {0x0, 0x0, 0x0, 0x0} },
-	{0x42, {0x0, 0x0, 0x0, 0x0} },
-	{0x43, {0x0, 0x0, 0x0, 0x0} },
-	{0x44, {0x0, 0x0, 0x0, 0x0} },
-	{0x45, {0x0, 0x0, 0x0, 0x0} },
-	{0x46, {0x0, 0x0, 0x0, 0x0} },
-	{0x47, {0x0, 0x0, 0x0, 0x0} },
-	{0x48, {0x0, 0x0, 0x0, 0x0} },
-	{0x49, {0x0, 0x0, 0x0, 0x0} },
-	{0x4a, {0x0, 0x0, 0x0, 0x0} },
-	{0x4b, {0x0, 0x0, 0x0, 0x0} },
-	{0x4c, {0x0, 0x0, 0x0, 0x0} },
-	{0x4d, {0x0, 0x0, 0x0, 0x0} },
-	{0x4e, {0x0, 0x0, 0x0, 0x0} },
-	{0x4f, {0x0, 0x0, 0x0, 0x0} },
-	{0x50, {0xd, 0xf, 0xc, 0xe} },
-	{0x51, {0xd, 0xf, 0xa, 0xe} },
-	{0x52, {0xb, 0xd, 0xd, 0xe} },
-	{0x53, {0xc, 0x11, 0xc, 0xe} },
-	{0x54, {0x2, 0x3, 0x3, 0x2} },
-	{0x55, {0x2, 0x3, 0x3, 0x2} },
-	{0x56, {0xc, 0xd, 0xd, 0xb} },
-	{0x57, {0xd, 0xf, 0xb, 0xf} },
-	{0x58, {0xe, 0xa, 0x10, 0xa} },
-	{0x59, {0xa, 0xf, 0x10, 0xe} },
-	{0x5a, {0x0, 0x0, 0x0, 0x0} },
-	{0x5b, {0x0, 0x0, 0x0, 0x0} },
-	{0x5c, {0x0, 0x0, 0x0, 0x0} },
-	{0x5d, {0x0, 0x0, 0x0, 0x0} },
-	{0x5e, {0x0, 0x0, 0x0, 0x0} },
-	{0x5f, {0x9, 0x9, 0x9, 0x9} },
-	{0x60, {0xd, 0xb, 0xf, 0x13} },
-	{0x61, {0xe, 0xb, 0xa, 0xf} },
-	{0x62, {0xe, 0xc, 0xf, 0x10} },
-	{0x63, {0x10, 0xd, 0xd, 0x10} },
-	{0x64, {0x3, 0x2, 0x6, 0x4} },
-	{0x65, {0x3, 0x2, 0x6, 0x4} },
-	{0x66, {0x10, 0xb, 0xf, 0xe} },
-	{0x67, {0x10, 0xe, 0xe, 0x11} },
-	{0x68, {0xe, 0xa, 0x12, 0xa} },
-	{0x69, {0xa, 0xb, 0x17, 0xe} },
-	{0x6a, {0x0, 0x0, 0x0, 0x0} },
-	{0x6b, {0x0, 0x0, 0x0, 0x0} },
-	{0x6c, {0x0, 0x0, 0x0, 0x0} },
-	{0x6d, {0x0, 0x0, 0x0, 0x0} },
-	{0x6e, {0x0, 0x0, 0x0, 0x0} },
-	{0x6f, {0xe, 0xe, 0xe, 0xe} },
-	{0x70, {0x0, 0x0, 0x0, 0x0} },
-	{0x71, {0x0, 0x0, 0x0, 0x0} },
-	{0x72, {0x0, 0x0, 0x0, 0x0} },
-	{0x73, {0x0, 0x0, 0x0, 0x0} },
-	{0x74, {0x0, 0x0, 0x0, 0x0} },
-	{0x75, {0x0, 0x0, 0x0, 0x0} },
-	{0x76, {0x0, 0x0, 0x0, 0x0} },
-	{0x77, {0x0, 0x0, 0x0, 0x0} },
-	{0x78, {0x0, 0x0, 0x0, 0x0} },
-	{0x79, {0x0, 0x0, 0x0, 0x0} },
-	{0x7a, {0x0, 0x0, 0x0, 0x0} },
-	{0x7b, {0x0, 0x0, 0x0, 0x0} },
-	{0x7c, {0x0, 0x0, 0x0, 0x0} },
-	{0x7d, {0x0, 0x0, 0x0, 0x0} },
-	{0x7e, {0x0, 0x0, 0x0, 0x0} },
-	{0x7f, {0x0, 0x0, 0x0, 0x0} },
-	{0x80, {0x0, 0x0, 0x0, 0x0} },
-	{0x81, {0x0, 0x0, 0x0, 0x0} },
-	{0x82, {0x0, 0x0, 0x0, 0x0} },
-	{0x83, {0x0, 0x0, 0x0, 0x0} },
-	{0x84, {0x0, 0x0, 0x0, 0x0} },
-	{0x85, {0x0, 0x0, 0x0, 0x0} },
-	{0x86, {0x0, 0x0, 0x0, 0x0} },
-	{0x87, {0x0, 0x0, 0x0, 0x0} },
-	{0x88, {0x0, 0x0, 0x0, 0x0} },
-	{0x89, {0x0, 0x0, 0x0, 0x0} },
-	{0x8a, {0x0, 0x0, 0x0, 0x0} },
-	{0x8b, {0x0, 0x0, 0x0, 0x0} },
-	{0x8c, {0x0, 0x0, 0x0, 0x0} },
-	{0x8d, {0x0, 0x0, 0x0, 0x0} },
-	{0x8e, {0x0, 0x0, 0x0, 0x0} },
-	{0x8f, {0x0, 0x0, 0x0, 0x0} },
-	{0x90, {0x6002, 0x6002, 0x6002, 0x6002} },
-	{0x91, {0x0, 0x0, 0x0, 0x0} },
-	{0x92, {0x1503, 0x1503, 0x1503, 0x1503} },
-	{0x93, {0x50, 0x50, 0x50, 0x50} },
-	{0x94, {0x12, 0x12, 0x12, 0x12} },
-	{0x95, {0xf, 0xf, 0xf, 0xf} },
-	{0x96, {0x0, 0x0, 0x0, 0x0} },
-	{0x97, {0x0, 0x0, 0x0, 0x0} },
-	{0x98, {0x0, 0x0, 0x0, 0x0} },
-	{0x99, {0x0, 0x0, 0x0, 0x0} },
-	{0x9a, {0x1, 0x1, 0x1, 0x1} },
-	{0x9b, {0x1fff, 0x1fff, 0x1fff, 0x1fff} },
-	{0x9c, {0x1, 0x1, 0x1, 0x1} },
-	{0x9d, {0x0, 0x0, 0x0, 0x0} },
-	{0x9e, {0x0, 0x0, 0x0, 0x0} },
-	{0x9f, {0x0, 0x0, 0x0, 0x0} },
-	{0xa0, {0x0, 0x0, 0x0, 0x0} },
-	{0xa1, {0x7ff, 0x7ff, 0x7ff, 0x7ff} },
-	{0xa2, {0x0, 0x0, 0x0, 0x0} },
-	{0xa3, {0x7ff, 0x7ff, 0x7ff, 0x7ff} },
-	{0xa4, {0x3dfb, 0x3dfb, 0x3dfb, 0x3dfb} },
-	{0xa5, {0x34e9, 0x34e9, 0x34e9, 0x34e9} },
-	{0xa6, {0xb6d, 0xb6d, 0xb6d, 0xb6d} },
-	{0xa7, {0x5d1, 0x5d1, 0x5d1, 0x5d1} },
-	{0xa8, {0x434, 0x434, 0x434, 0x434} },
-	{0xa9, {0x0, 0x0, 0x0, 0x0} },
-	{0xaa, {0x0, 0x0, 0x0, 0x0} },
-	{0xab, {0x0, 0x0, 0x0, 0x0} },
-	{0xac, {0x0, 0x0, 0x0, 0x0} },
-	{0xad, {0x0, 0x0, 0x0, 0x0} },
-	{0xae, {0x0, 0x0, 0x0, 0x0} },
-	{0xaf, {0x0, 0x0, 0x0, 0x0} },
-	{0xb0, {0x0, 0x0, 0x0, 0x0} },
-	{0xb1, {0x0, 0x0, 0x0, 0x0} },
-	{0xb2, {0x1, 0x1, 0x1, 0x1} },
-	{0xb3, {0x0, 0x0, 0x0, 0x0} },
-	{0xb4, {0x0, 0x0, 0x0, 0x0} },
-	{0xb5, {0x0, 0x0, 0x0, 0x0} },
-	{0xb6, {0x0, 0x0, 0x0, 0x0} },
-	{0xb7, {0x0, 0x0, 0x0, 0x0} },
-	{0xb8, {0x0, 0x0, 0x0, 0x0} },
-	{0xb9, {0x0, 0x0, 0x0, 0x0} },
-	{0xba, {0x0, 0x0, 0x0, 0x0} },
-	{0xbb, {0x0, 0x0, 0x0, 0x0} },
-	{0xbc, {0x0, 0x0, 0x0, 0x0} },
-	{0xbd, {0x0, 0x0, 0x0, 0x0} },
-	{0xbe, {0x1, 0x1, 0x1, 0x1} },
-	{0xbf, {0x0, 0x0, 0x0, 0x0} },
-	{0xc0, {0x33a, 0x2ba, 0x2ba, 0x339} },
-	{0xc1, {0x2f8, 0x2bb, 0x2db, 0x339} },
-	{0xc2, {0x0, 0x0, 0x0, 0x0} },
-	{0xc3, {0x0, 0x0, 0x0, 0x0} },
-	{0xc4, {0x0, 0x0, 0x0, 0x0} },
-	{0xc5, {0x0, 0x0, 0x0, 0x0} },
-	{0xc6, {0x0, 0x0, 0x0, 0x0} },
-	{0xc7, {0x0, 0x0, 0x0, 0x0} },
-	{0xc8, {0x0, 0x0, 0x0, 0x0} },
-	{0xc9, {0x0, 0x0, 0x0, 0x0} },
-	{0xca, {0x0, 0x0, 0x0, 0x0} },
-	{0xcb, {0x0, 0x0, 0x0, 0x0} },
-	{0xcc, {0x0, 0x0, 0x0, 0x0} },
-	{0xcd, {0x0, 0x0, 0x0, 0x0} },
-	{0xce, {0x0, 0x0, 0x0, 0x0} },
-	{0xcf, {0x0, 0x0, 0x0, 0x0} },
-	{0xd0, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd1, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd4, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xd5, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xd6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd8, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xd9, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xda, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdc, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdd, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xde, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xdf, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe0, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xe1, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xe2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe4, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe5, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe8, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xe9, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xea, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xeb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xec, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xed, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xee, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xef, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf0, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf1, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf2, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf3, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf4, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf5, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf6, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf7, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xf8, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xf9, {0x1f, 0x1f, 0x1f, 0x1f} },
-	{0xfa, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfb, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfc, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfd, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xfe, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xff, {0x3f, 0x3f, 0x3f, 0x3f} },
-	{0xffffffff, {0, 0, 0, 0} }
+static const u8 a38x_data_phy_800[] = {
+	4,	/* subphys */
+	STATIC_IMG_ABS, 0x0, STATIC_IMG_U16(0x6411), STATIC_IMG_U16(0x544d), STATIC_IMG_U16(0x7c17), STATIC_IMG_U16(0x6010),
+	1, STATIC_IMG_U16(0x19), STATIC_IMG_U16(0x16), STATIC_IMG_U16(0x1f), STATIC_IMG_U16(0x17),	/* 0x1 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x51), STATIC_IMG_U16(0x57), STATIC_IMG_U16(0x1d),	/* 0x2 */
+	1, STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xd),	/* 0x3 */
+	1, STATIC_IMG_U16(0x6010), STATIC_IMG_U16(0x544d), STATIC_IMG_U16(0x8018), STATIC_IMG_U16(0x6010),	/* 0x4 */
+	1, STATIC_IMG_U16(0x18), STATIC_IMG_U16(0x15), STATIC_IMG_U16(0x1f), STATIC_IMG_U16(0x17),	/* 0x5 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0x52), STATIC_IMG_U16(0x58), STATIC_IMG_U16(0x1d),	/* 0x6 */
+	1, STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xe),	/* 0x7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0x9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x10),	/* 0xf */
+	1, STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2),	/* 0x10 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x1),	/* 0x11 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x2),	/* 0x12 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x2),	/* 0x13 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x2),	/* 0x14 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x2),	/* 0x15 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x4),	/* 0x16 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x3),	/* 0x17 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0x1),	/* 0x18 */
+	1, STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x8), STATIC_IMG_U16(0x0),	/* 0x19 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x1e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xe),	/* 0x1f */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x1), STATIC_IMG_U16(0x7), STATIC_IMG_U16(0x6),	/* 0x20 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x2),	/* 0x21 */
+	1, STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x8), STATIC_IMG_U16(0x4),	/* 0x22 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x7),	/* 0x23 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x3),	/* 0x24 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x3),	/* 0x25 */
+	1, STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x4), STATIC_IMG_U16(0x8), STATIC_IMG_U16(0x5),	/* 0x26 */
+	1, STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x5), STATIC_IMG_U16(0x7),	/* 0x27 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x0), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x0),	/* 0x28 */
+	1, STATIC_IMG_U16(0x0), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x5),	/* 0x29 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x2e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xf),	/* 0x2f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x30 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x31 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x32 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x33 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x34 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x35 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x36 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x37 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x38 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x39 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x3f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x40 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x41 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x42 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x43 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x44 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x45 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x46 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x47 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x48 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x49 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x4f */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe),	/* 0x50 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xe),	/* 0x51 */
+	1, STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xe),	/* 0x52 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0x11), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xe),	/* 0x53 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2),	/* 0x54 */
+	1, STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2),	/* 0x55 */
+	1, STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xb),	/* 0x56 */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xf),	/* 0x57 */
+	1, STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xa),	/* 0x58 */
+	1, STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xe),	/* 0x59 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x5e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x9),	/* 0x5f */
+	1, STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0x13),	/* 0x60 */
+	1, STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xf),	/* 0x61 */
+	1, STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xc), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0x10),	/* 0x62 */
+	1, STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0xd), STATIC_IMG_U16(0x10),	/* 0x63 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x4),	/* 0x64 */
+	1, STATIC_IMG_U16(0x3), STATIC_IMG_U16(0x2), STATIC_IMG_U16(0x6), STATIC_IMG_U16(0x4),	/* 0x65 */
+	1, STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0xf), STATIC_IMG_U16(0xe),	/* 0x66 */
+	1, STATIC_IMG_U16(0x10), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xe), STATIC_IMG_U16(0x11),	/* 0x67 */
+	1, STATIC_IMG_U16(0xe), STATIC_IMG_U16(0xa), STATIC_IMG_U16(0x12), STATIC_IMG_U16(0xa),	/* 0x68 */
+	1, STATIC_IMG_U16(0xa), STATIC_IMG_U16(0xb), STATIC_IMG_U16(0x17), STATIC_IMG_U16(0xe),	/* 0x69 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x6e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xe),	/* 0x6f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x70 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x71 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x72 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x73 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x74 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x75 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x76 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x77 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x78 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x79 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x7f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x80 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x81 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x82 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x83 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x84 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x85 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x86 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x87 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x88 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x89 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x8f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x6002),	/* 0x90 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x91 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1503),	/* 0x92 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x50),	/* 0x93 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x12),	/* 0x94 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xf),	/* 0x95 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x96 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x97 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x98 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x99 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9a */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1fff),	/* 0x9b */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0x9c */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9d */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9e */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0x9f */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x7ff),	/* 0xa3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3dfb),	/* 0xa4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x34e9),	/* 0xa5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0xb6d),	/* 0xa6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x5d1),	/* 0xa7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x434),	/* 0xa8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xa9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xab */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xac */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xad */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xae */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xaf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xb2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xb9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xba */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1),	/* 0xbe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xbf */
+	1, STATIC_IMG_U16(0x33a), STATIC_IMG_U16(0x2ba), STATIC_IMG_U16(0x2ba), STATIC_IMG_U16(0x339),	/* 0xc0 */
+	1, STATIC_IMG_U16(0x2f8), STATIC_IMG_U16(0x2bb), STATIC_IMG_U16(0x2db), STATIC_IMG_U16(0x339),	/* 0xc1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xc9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xca */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xce */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x0),	/* 0xcf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xd5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xd9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xda */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xde */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xdf */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xe1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xe9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xea */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xeb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xec */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xed */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xee */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xef */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf0 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf1 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf2 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf3 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf4 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf5 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf6 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xf7 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf8 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x1f),	/* 0xf9 */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfa */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfb */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfc */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfd */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xfe */
+	STATIC_IMG_BCAST | 1, STATIC_IMG_U16(0x3f),	/* 0xff */
+	STATIC_IMG_END
 };
 #endif /* CONFIG_PHY_STATIC */
 
@@ -1126,9 +1149,9 @@ static struct mv_ddr_subphys_reg_config a38x_data_phy_800[] = {
 struct dram_modes {
 	char *mode_name;
 	u8 cpu_freq;
-	struct reg_data *mc_regs;
-	struct mv_ddr_subphys_reg_config *ctrl_phy_regs;
-	struct mv_ddr_subphys_reg_config *data_phy_regs;
+	const u8 *mc_img;
+	const u8 *ctrl_phy_img;
+	const u8 *data_phy_img;
 };
 
 static struct dram_modes ddr_modes[] = {
@@ -1140,6 +1163,18 @@ static struct dram_modes ddr_modes[] = {
 	{"", MV_DDR_FREQ_LAST, NULL, NULL, NULL}
 };
 
+static u32 static_img_get(const u8 **img, u32 size)
+{
+	u32 val = 0;
+	u32 i;
+
+	for (i = 0; i < size; i++)
+		val |= (*img)[i] << (8 * i);
+	*img += size;
+
+	return val;
+}
+
 /*
  * init memory controller with static parameters
  * with no hw training procedure by providing with
@@ -1149,7 +1184,7 @@ u32 ddr3_get_static_ddr_mode(void)
 {
 	u32 i;
 
-	for (i = 0; ddr_modes[i].mc_regs != NULL; i++) {
+	for (i = 0; ddr_modes[i].mc_img != NULL; i++) {
 		if (mv_ddr_init_freq_get() == ddr_modes[i].cpu_freq)
 			return i;
 	}
@@ -1163,15 +1198,19 @@ u32 ddr3_get_static_ddr_mode(void)
 #ifdef CONFIG_MC_STATIC
 int mv_ddr_mc_static_config(void)
 {
-	u32 mode, i = 0;
+	const u8 *img = ddr_modes[ddr3_get_static_ddr_mode()].mc_img;
+	u32 addr = 0, data, mask;
+	u8 hdr;
 
-	mode = ddr3_get_static_ddr_mode();
-	while (ddr_modes[mode].mc_regs[i].reg_addr != 0xffffffff) {
-		ddr3_tip_if_write(0, ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE,
-				  ddr_modes[mode].mc_regs[i].reg_addr,
-				  ddr_modes[mode].mc_regs[i].reg_data,
-				  ddr_modes[mode].mc_regs[i].reg_mask);
-		i++;
+	for (hdr = *img++; hdr != STATIC_IMG_END; hdr = *img++) {
+		if ((hdr & STATIC_IMG_DELTA_MASK) == STATIC_IMG_ABS)
+			addr = static_img_get(&img, 4);
+		else
+			addr += (hdr & STATIC_IMG_DELTA_MASK) * 4;
+		data = static_img_get(&img, 4);
+		mask = (hdr & STATIC_IMG_MASKED) ? static_img_get(&img, 4) : MASK_ALL_BITS;
+		CHECK_STATUS(ddr3_tip_if_write(0, ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE,
+					       addr, data, mask));
 	}
 
 	return MV_OK;
@@ -1179,42 +1218,145 @@ int mv_ddr_mc_static_config(void)
 #endif /* CONFIG_MC_STATIC */
 
 #ifdef CONFIG_PHY_STATIC
-static int mv_ddr_a38x_phy_static_config(u32 if_id, u32 subphys_num, enum hws_ddr_phy subphy_type)
+/* program the records of a phy image; is_mcast when it covers all active subphys */
+static int mv_ddr_a38x_phy_static_img_apply(u32 if_id, const u8 *img, enum hws_ddr_phy subphy_type,
+					    u32 subphys_num, int is_mcast)
 {
-	u32 i, mode, subphy_id, dev_num = 0;
+	u32 subphy_id, addr = 0, data = 0, dev_num = 0;
+	u8 hdr;
 
-	mode = ddr3_get_static_ddr_mode();
-	if (subphy_type == DDR_PHY_DATA) {
-		for (subphy_id = 0; subphy_id < subphys_num; subphy_id++) {
-			i = 0;
-			while (ddr_modes[mode].data_phy_regs[i].reg_addr != 0xffffffff) {
-				ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id, ACCESS_TYPE_UNICAST,
-							subphy_id, subphy_type,
-							ddr_modes[mode].data_phy_regs[i].reg_addr,
-							ddr_modes[mode].data_phy_regs[i].reg_data[subphy_id]);
-				i++;
+	for (hdr = *img++; hdr != STATIC_IMG_END; hdr = *img++) {
+		if ((hdr & STATIC_IMG_DELTA_MASK) == STATIC_IMG_ABS)
+			addr = *img++;
+		else
+			addr += hdr & STATIC_IMG_DELTA_MASK;
+
+		if (hdr & STATIC_IMG_BCAST) {
+			data = static_img_get(&img, 2);
+			if (is_mcast) {
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE,
+								subphy_type, addr, data));
+				continue;
 			}
 		}
-	} else {
+
 		for (subphy_id = 0; subphy_id < subphys_num; subphy_id++) {
-			i = 0;
-			while (ddr_modes[mode].ctrl_phy_regs[i].reg_addr != 0xffffffff) {
-				ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id, ACCESS_TYPE_UNICAST,
-							subphy_id, subphy_type,
-							ddr_modes[mode].ctrl_phy_regs[i].reg_addr,
-							ddr_modes[mode].ctrl_phy_regs[i].reg_data[subphy_id]);
-				i++;
-			}
+			if (!(hdr & STATIC_IMG_BCAST))
+				data = static_img_get(&img, 2);
+			CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+							ACCESS_TYPE_UNICAST, subphy_id,
+							subphy_type, addr, data));
 		}
 	}
 
 	return MV_OK;
 }
 
+/*
+ * broadcast records go out as a single multicast write when the image
+ * covers all active subphys; the rest is queued into a phy batch
+ */
+static int mv_ddr_a38x_phy_static_config(u32 if_id, const u8 *img, enum hws_ddr_phy subphy_type)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 subphys_num, subphy_id;
+	int is_mcast = 1;
+
+	subphys_num = *img++;
+	if (subphy_type == DDR_PHY_DATA) {
+		for (subphy_id = subphys_num; subphy_id < octets_per_if_num; subphy_id++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy_id);
+			is_mcast = 0;
+		}
+	}
+
+	CHECK_STATUS(mv_ddr_phy_batch_start(0));
+
+	return mv_ddr_phy_batch_end(0, mv_ddr_a38x_phy_static_img_apply(if_id, img, subphy_type,
+									 subphys_num, is_mcast));
+}
+
 void mv_ddr_phy_static_config(void)
 {
-	/* TODO: use variable for subphys number */
-	mv_ddr_a38x_phy_static_config(0, 4, DDR_PHY_DATA);
-	mv_ddr_a38x_phy_static_config(0, 3, DDR_PHY_CONTROL);
+	u32 mode = ddr3_get_static_ddr_mode();
+
+	mv_ddr_a38x_phy_static_config(0, ddr_modes[mode].data_phy_img, DDR_PHY_DATA);
+	mv_ddr_a38x_phy_static_config(0, ddr_modes[mode].ctrl_phy_img, DDR_PHY_CONTROL);
 }
 #endif /* CONFIG_PHY_STATIC */
+
+#if defined(CONFIG_MC_STATIC_PRINT) || defined(CONFIG_PHY_STATIC_PRINT)
+/*
+ * the print options dump the trained register state in the text format of
+ * tools/static_gen, which turns a boot log into the tables above:
+ *	dunit <addr> <value>
+ *	phy data|ctrl <subphy> <addr> <value>
+ */
+#define PHY_REGS_NUM		0x100
+
+static const u32 mc_regs_list[] = {
+	MV_DDR_STATIC_MC_REGS
+};
+
+static int mc_regs_print(void)
+{
+	u32 i, data[MAX_INTERFACE_NUM];
+
+	for (i = 0; i < ARRAY_SIZE(mc_regs_list); i++) {
+		CHECK_STATUS(ddr3_tip_if_read(0, ACCESS_TYPE_UNICAST, 0, mc_regs_list[i],
+					      data, MASK_ALL_BITS));
+		printf("dunit 0x%x 0x%08x\n", mc_regs_list[i], data[0]);
+	}
+
+	return MV_OK;
+}
+#endif /* CONFIG_MC_STATIC_PRINT || CONFIG_PHY_STATIC_PRINT */
+
+#if defined(CONFIG_MC_STATIC_PRINT)
+int mv_ddr_mc_static_print(void)
+{
+	printf("mv_ddr: mc static configuration:\n");
+
+	return mc_regs_print();
+}
+#endif /* CONFIG_MC_STATIC_PRINT */
+
+#if defined(CONFIG_PHY_STATIC_PRINT)
+static int phy_regs_print(u32 subphy_id, enum hws_ddr_phy subphy_type)
+{
+	u32 addr, data[MAX_INTERFACE_NUM];
+
+	for (addr = 0; addr < PHY_REGS_NUM; addr++) {
+		CHECK_STATUS(ddr3_tip_bus_read(0, 0, ACCESS_TYPE_UNICAST, subphy_id,
+					       subphy_type, addr, data));
+		printf("phy %s %d 0x%x 0x%x\n", (subphy_type == DDR_PHY_DATA) ? "data" : "ctrl",
+		       subphy_id, addr, data[0]);
+	}
+
+	return MV_OK;
+}
+
+int mv_ddr_phy_static_print(void)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 subphy_id;
+
+	printf("mv_ddr: phy static configuration:\n");
+
+	/* training updates some of the mc registers as well */
+	CHECK_STATUS(mc_regs_print());
+
+	for (subphy_id = 0; subphy_id < octets_per_if_num; subphy_id++) {
+		VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy_id);
+		CHECK_STATUS(phy_regs_print(subphy_id, DDR_PHY_DATA));
+	}
+
+	for (subphy_id = 0; subphy_id < DDR_IF_CTRL_SUBPHYS_NUM; subphy_id++)
+		CHECK_STATUS(phy_regs_print(subphy_id, DDR_PHY_CONTROL));
+
+	return MV_OK;
+}
+#endif /* CONFIG_PHY_STATIC_PRINT */
@@ -13,4 +13,12 @@ int mv_ddr_mc_static_config(void);
 void mv_ddr_phy_static_config(void);
 #endif /* CONFIG_PHY_STATIC */
 
+#ifdef CONFIG_MC_STATIC_PRINT
+int mv_ddr_mc_static_print(void);
+#endif /* CONFIG_MC_STATIC_PRINT */
+
+#ifdef CONFIG_PHY_STATIC_PRINT
+int mv_ddr_phy_static_print(void);
+#endif /* CONFIG_PHY_STATIC_PRINT */
+
 #endif /* _MV_DDR_STATIC_H */
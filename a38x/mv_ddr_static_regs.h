@@ -0,0 +1,19 @@
+/* Copyright (c) 2017 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_STATIC_REGS_H
+#define _MV_DDR_STATIC_REGS_H
+
+/*
+ * dunit registers of the a38x mc static image; shared by the static print
+ * in mv_ddr_static.c and by tools/static_gen, so keep this header free of
+ * other includes
+ */
+#define MV_DDR_STATIC_MC_REGS							\
+	0x1400, 0x1404, 0x1408, 0x140c, 0x1410, 0x1414, 0x1418, 0x141c,		\
+	0x1420, 0x1424, 0x1428, 0x142c, 0x1474, 0x147c, 0x1494, 0x1498,		\
+	0x149c, 0x14a8, 0x14cc, 0x150c, 0x1514, 0x151c, 0x1538, 0x153c,		\
+	0x15d0, 0x15d4, 0x15d8, 0x15dc, 0x15e0, 0x15e4, 0x15e8, 0x15ec
+
+#endif /* _MV_DDR_STATIC_REGS_H */
@@ -7,6 +7,7 @@
 #include "mv_ddr_mc6.h"
 #include "mv_ddr_xor_v2.h"
 #include "mv_ddr_validate.h"
+#include "mv_ddr_mem_test.h"
 #include "mv_ddr_common.h"
 #include "mv_ddr_regs.h"
 
@@ -234,24 +235,40 @@ int mv_ddr_mc_remap(void)
 
 void mv_ddr_mem_scrubbing(void)
 {
-	uint64_t val = 0;
 	uint64_t tot_mem_sz;
+	uint64_t start[MV_DDR_DMA_MEMSET_RGN_MAX], size[MV_DDR_DMA_MEMSET_RGN_MAX];
+	u32 rgn_num = 1;
 
 	tot_mem_sz = mv_ddr_mem_sz_get();
 
-	printf("mv_ddr: scrubbing memory...\n");
-
 	/* scrub memory up to non-dram memory region */
+	start[0] = 0;
 	if (tot_mem_sz < NON_DRAM_MEM_RGN_START_ADDR)
-		mv_ddr_dma_memset(0, tot_mem_sz, val);
+		size[0] = tot_mem_sz;
 	else
-		mv_ddr_dma_memset(0, NON_DRAM_MEM_RGN_START_ADDR, val);
+		size[0] = NON_DRAM_MEM_RGN_START_ADDR;
 
 	/* scrub memory up to the end */
-	if (tot_mem_sz >= NON_DRAM_MEM_RGN_END_ADDR)
-		mv_ddr_dma_memset(NON_DRAM_MEM_RGN_END_ADDR,
-				  tot_mem_sz - NON_DRAM_MEM_RGN_START_ADDR, val);
+	if (tot_mem_sz >= NON_DRAM_MEM_RGN_END_ADDR) {
+		start[1] = NON_DRAM_MEM_RGN_END_ADDR;
+		size[1] = tot_mem_sz - NON_DRAM_MEM_RGN_START_ADDR;
+		rgn_num = 2;
+	}
+
+	mv_ddr_dma_scrub(start, size, rgn_num);
+}
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size)
+{
+	return mv_ddr_dma_memset_is_done(addr, size);
+}
+
+int mv_ddr_mem_scrub_wait(void)
+{
+	return mv_ddr_dma_scrub_wait() ? MV_FAIL : MV_OK;
 }
+#endif /* MV_DDR_SCRUB_ASYNC */
 
 static u8 mv_ddr_tip_clk_ratio_get(u32 freq)
 {
@@ -298,6 +315,8 @@ void mv_ddr_odpg_enable(void)
 	dunit_write(ODPG_DATA_CTRL_REG,
 		    ODPG_ENABLE_MASK << ODPG_ENABLE_OFFS,
 		    ODPG_ENABLE_ENA << ODPG_ENABLE_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, ODPG_DATA_CTRL_REG,
+			 ODPG_ENABLE_ENA << ODPG_ENABLE_OFFS, ODPG_ENABLE_MASK << ODPG_ENABLE_OFFS);
 }
 
 void mv_ddr_odpg_disable(void)
@@ -305,6 +324,8 @@ void mv_ddr_odpg_disable(void)
 	dunit_write(ODPG_DATA_CTRL_REG,
 		    ODPG_DISABLE_MASK << ODPG_DISABLE_OFFS,
 		    ODPG_DISABLE_DIS << ODPG_DISABLE_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, ODPG_DATA_CTRL_REG,
+			 ODPG_DISABLE_DIS << ODPG_DISABLE_OFFS, ODPG_DISABLE_MASK << ODPG_DISABLE_OFFS);
 }
 
 void mv_ddr_odpg_done_clr(void)
@@ -312,6 +333,9 @@ void mv_ddr_odpg_done_clr(void)
 	dunit_write(ODPG_DONE_STATUS_REG,
 		    ODPG_DONE_STATUS_BIT_MASK << ODPG_DONE_STATUS_BIT_OFFS,
 		    ODPG_DONE_STATUS_BIT_CLR << ODPG_DONE_STATUS_BIT_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, ODPG_DONE_STATUS_REG,
+			 ODPG_DONE_STATUS_BIT_CLR << ODPG_DONE_STATUS_BIT_OFFS,
+			 ODPG_DONE_STATUS_BIT_MASK << ODPG_DONE_STATUS_BIT_OFFS);
 }
 
 int mv_ddr_is_odpg_done(u32 count)
@@ -319,11 +343,15 @@ int mv_ddr_is_odpg_done(u32 count)
 	u32 i, data;
 
 	for (i = 0; i < count; i++) {
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(ODPG_DONE_STATUS_REG, MASK_ALL_BITS, &data);
 		if (((data >> ODPG_DONE_STATUS_BIT_OFFS) & ODPG_DONE_STATUS_BIT_MASK) ==
 		     ODPG_DONE_STATUS_BIT_SET)
 			break;
 	}
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_POLL, i >= count, i, ODPG_DONE_STATUS_REG,
+			 ODPG_DONE_STATUS_BIT_SET << ODPG_DONE_STATUS_BIT_OFFS,
+			 ODPG_DONE_STATUS_BIT_MASK << ODPG_DONE_STATUS_BIT_OFFS);
 
 	if (i >= count) {
 		printf("%s: timeout\n", __func__);
@@ -337,9 +365,16 @@ int mv_ddr_is_odpg_done(u32 count)
 
 void mv_ddr_training_enable(void)
 {
+#if defined(MV_DDR_PHY_CACHE)
+	/* training engine may write its results to the phy */
+	mv_ddr_phy_cache_invalidate();
+#endif /* MV_DDR_PHY_CACHE */
 	dunit_write(GLOB_CTRL_STATUS_REG,
 		    TRAINING_TRIGGER_MASK << TRAINING_TRIGGER_OFFS,
 		    TRAINING_TRIGGER_ENA << TRAINING_TRIGGER_OFFS);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, GLOB_CTRL_STATUS_REG,
+			 TRAINING_TRIGGER_ENA << TRAINING_TRIGGER_OFFS,
+			 TRAINING_TRIGGER_MASK << TRAINING_TRIGGER_OFFS);
 }
 
 int mv_ddr_is_training_done(u32 count, u32 *result)
@@ -352,11 +387,15 @@ int mv_ddr_is_training_done(u32 count, u32 *result)
 	}
 
 	for (i = 0; i < count; i++) {
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(GLOB_CTRL_STATUS_REG, MASK_ALL_BITS, &data);
 		if (((data >> TRAINING_DONE_OFFS) & TRAINING_DONE_MASK) ==
 		     TRAINING_DONE_DONE)
 			break;
 	}
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_POLL, i >= count, i, GLOB_CTRL_STATUS_REG,
+			 TRAINING_DONE_DONE << TRAINING_DONE_OFFS,
+			 TRAINING_DONE_MASK << TRAINING_DONE_OFFS);
 
 	if (i >= count) {
 		printf("%s: timeout\n", __func__);
@@ -615,6 +654,7 @@ static int is_prfa_done(void)
 			printf("error: %s: polling timeout\n", __func__);
 			return -1;
 		}
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 		dunit_read(PHY_REG_FILE_ACCESS_REG, MASK_ALL_BITS, &reg_val);
 		reg_val >>= PRFA_REQ_OFFS;
 		reg_val &= PRFA_REQ_MASK;
@@ -914,14 +954,31 @@ int mv_ddr_pre_training_fixup(void)
 int mv_ddr_post_training_fixup(void)
 {
 	int soc_ver_id;
+	int ret = MV_OK;
 	soc_ver_id = mv_ddr_get_soc_revision_id();
 
 	mv_ddr_validate();
 
+#if defined(MV_DDR_MEM_TEST)
+	/* ecc scrubbing follows and clears the tested memory */
+	if (mv_ddr_mem_test(MV_DDR_MEM_TEST_PROFILE) != MV_OK)
+		ret = MV_FAIL;
+#endif /* MV_DDR_MEM_TEST */
+
 	if (soc_ver_id != CHIP_VER_7K_B0 && soc_ver_id != CHIP_VER_8K_B0)
 		reg_write(AVS_ENABLED_CTRL_REG, nominal_avs);
 
-	return 0;
+	return ret;
+}
+
+/* no suspend to ram support; always run the full init flow */
+int mv_ddr_soc_resume(const char *ddr_type)
+{
+	return MV_NOT_STARTED;
+}
+
+void mv_ddr_soc_resume_save(void)
+{
 }
 
 /* convert read ready and read sample from tip to mc6 */
@@ -265,6 +265,16 @@ int mv_ddr_dq_mapping_detect(u32 dev_num);
 #endif
 u32 mv_ddr_init_freq_get(void);
 void mv_ddr_mem_scrubbing(void);
+#if defined(MV_DDR_SCRUB_ASYNC)
+/*
+ * background scrubbing may still run when ddr3_init() returns: the caller must
+ * keep the sram that holds the dma descriptors queues (qmem in mv_ddr_xor_v2.c)
+ * in place, and must not use memory that mv_ddr_mem_scrub_is_done() doesn't
+ * report as scrubbed, until mv_ddr_mem_scrub_wait() returns
+ */
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size);
+int mv_ddr_mem_scrub_wait(void);
+#endif /* MV_DDR_SCRUB_ASYNC */
 void mv_ddr_odpg_enable(void);
 void mv_ddr_odpg_disable(void);
 void mv_ddr_odpg_done_clr(void);
@@ -274,6 +284,8 @@ int mv_ddr_is_training_done(u32 count, u32 *result);
 u32 mv_ddr_dm_pad_get(void);
 int mv_ddr_pre_training_fixup(void);
 int mv_ddr_post_training_fixup(void);
+int mv_ddr_soc_resume(const char *ddr_type);
+void mv_ddr_soc_resume_save(void);
 int mv_ddr_manual_cal_do(void);
 
 #endif /* _MV_DDR_PLAT_H */
@@ -555,6 +555,7 @@ static int phy_regs_set(void)
 	u32 i, addr, data;
 	int phy;
 
+	CHECK_STATUS(mv_ddr_phy_batch_start(0));
 	for (i = 0; i < phy_regs_cfg.dnum; i++) {
 		addr = phy_regs_cfg.dphy_regs_data[i].addr;
 		for (phy = 0; phy < MAX_DATA_PHY_NUM; phy++) {
@@ -576,7 +577,7 @@ static int phy_regs_set(void)
 
 	}
 
-	return MV_OK;
+	return mv_ddr_phy_batch_end(0, MV_OK);
 }
 
 static struct mc_reg_data mc4phy_regs_data[DUNIT_4PHY_REGS_NUM + MC6_4PHY_REGS_NUM] = {
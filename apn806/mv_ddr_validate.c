@@ -38,6 +38,10 @@
 #endif
 
 static uint64_t dma_src[DBG_MAX_CS_NUM][DBG_DMA_ENG_NUM], dma_dst[DBG_MAX_CS_NUM][DBG_DMA_ENG_NUM];
+/* dma data unit, as built by the cpu, written to src regions per cs; see dma_unit_write() */
+static uint64_t dma_unit[DBG_MAX_CS_NUM][DBG_DMA_DATA_SIZE / sizeof(uint64_t)];
+/* golden dma data unit held by dst regions; see dma_pattern_load() */
+static struct mv_ddr_dma_golden dma_golden[DBG_MAX_CS_NUM];
 extern u8 dq_vref_vec[MAX_BUS_NUM];	/* stability support */
 extern u8 rx_eye_hi_lvl[MAX_BUS_NUM];	/* vertical adjustment support */
 extern u8 rx_eye_lo_lvl[MAX_BUS_NUM];	/* vertical adjustment support */
@@ -294,8 +298,13 @@ static int dma_test(uint64_t dma_src[][DBG_DMA_ENG_NUM],
 {
 	int res = 0;
 
-	mv_ddr_dma_memcpy(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
-	res = mv_ddr_dma_memcmp(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
+	/* dma session is open for the whole validation */
+	mv_ddr_dma_session_memcpy(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
+	mv_ddr_dma_session_wait();
+	mv_ddr_dma_session_memcmp(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
+	res = mv_ddr_dma_session_wait();
+	if (res)
+		dma_golden[cs].dirty = 1;
 
 #ifdef DBG_PRINT
 	if (res)
@@ -307,6 +316,124 @@ static int dma_test(uint64_t dma_src[][DBG_DMA_ENG_NUM],
 	return res;
 }
 
+/* build dma data unit from dma pattern with xor_byte_mask bits set and write it to src regions */
+static void dma_unit_write(uint64_t dma_src[][DBG_DMA_ENG_NUM], u32 cs, uint64_t xor_byte_mask)
+{
+	u32 pattern_num = sizeof(dma_pattern) / sizeof(dma_pattern[0]);
+	u32 unit_num = sizeof(dma_unit[cs]) / sizeof(dma_unit[cs][0]);
+	uint64_t curr_dst;
+	u32 i, j;
+
+	for (i = 0; i < unit_num; i++)
+		dma_unit[cs][i] = dma_pattern[i % pattern_num] | xor_byte_mask;
+
+	for (j = 0; j < DBG_DMA_ENG_NUM; j++) {
+		for (i = 0, curr_dst = dma_src[cs][j]; i < unit_num;
+		     i++, curr_dst += sizeof(dma_unit[cs][0]))
+			writeq(curr_dst, dma_unit[cs][i]);
+	}
+}
+
+/*
+ * write dma data unit to dst regions by the cpu and take its golden crc32 on
+ * the cpu, for dma_rd_test(); no dram read is involved, so the golden data is
+ * right whatever the rx setup being swept; to be called after dma_unit_write()
+ */
+static int dma_pattern_load(uint64_t dma_dst[][DBG_DMA_ENG_NUM], u32 cs)
+{
+	return mv_ddr_dma_golden_load(dma_unit[cs], dma_dst[cs], DBG_DMA_DATA_SIZE,
+				      DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM, &dma_golden[cs]);
+}
+
+/*
+ * read-only variant of dma_test() for rx sweeps: dst regions are only read
+ * back and their crc32 compared with the golden one, which halves dram traffic
+ */
+static int dma_rd_test(uint64_t dma_src[][DBG_DMA_ENG_NUM],
+		       uint64_t dma_dst[][DBG_DMA_ENG_NUM],
+		       u32 cs)
+{
+	int res = 0;
+
+	/* dst regions are reloaded first after a failed dma_test() overwrote them */
+	res = mv_ddr_dma_session_golden_check(dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM,
+					      DBG_DMA_DESC_NUM, &dma_golden[cs]);
+
+#ifdef DBG_PRINT
+	if (res)
+		printf("dma crc fail(%d)\n", res);
+	else
+		printf("dma crc pass\n");
+#endif
+
+	return res;
+}
+
+/*
+ * per byte lane variant of dma_test() and dma_rd_test(): the dma compare only
+ * tells the failed descriptors, so just their regions are read back by the cpu
+ * and xor-reduced against the cpu copy of the data unit, as src may be
+ * corrupted too; returns the mask of lanes in lane_mask with errors,
+ * or lane_mask if a dma engine timed out or no lane is found; data lanes only
+ */
+static u32 dma_lane_test(uint64_t dma_src[][DBG_DMA_ENG_NUM],
+			 uint64_t dma_dst[][DBG_DMA_ENG_NUM],
+			 u32 cs, enum search_element element, u32 lane_mask)
+{
+	u32 fail_map[DBG_DMA_ENG_NUM][MV_DDR_DMA_FAIL_MAP_WORDS];
+	u32 bus_bytes = mv_ddr_if_bus_width_get() / 8;
+	u32 dma_id, desc_id, byte, fail_mask = 0;
+	uint64_t offs, dst, diff = 0;
+	int res;
+
+	if (element == CTX) {
+		mv_ddr_dma_session_memcpy(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM,
+					  DBG_DMA_DESC_NUM);
+		mv_ddr_dma_session_wait();
+		mv_ddr_dma_session_memcmp(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM,
+					  DBG_DMA_DESC_NUM);
+	} else {
+		/* reload dst regions after a failed dma_test() overwrote them */
+		if (dma_golden[cs].dirty)
+			dma_pattern_load(dma_dst, cs);
+		mv_ddr_dma_session_crccmp(dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM,
+					  dma_golden[cs].crc);
+	}
+	res = mv_ddr_dma_session_wait_map(fail_map);
+	if (res < 0 || bus_bytes == 0)
+		return lane_mask;
+	if (res == 0)
+		return 0;
+	if (element == CTX)
+		dma_golden[cs].dirty = 1;
+
+	for (dma_id = 0; dma_id < DBG_DMA_ENG_NUM; dma_id++) {
+		for (desc_id = 0; desc_id < DBG_DMA_DESC_NUM; desc_id++) {
+			if (!(fail_map[dma_id][desc_id / 32] & (1u << (desc_id % 32))))
+				continue;
+
+			dst = dma_dst[cs][dma_id] + desc_id * DBG_DMA_DATA_SIZE;
+			for (offs = 0; offs < DBG_DMA_DATA_SIZE; offs += sizeof(diff))
+				diff |= dma_unit[cs][offs / sizeof(diff)] ^ readq(dst + offs);
+
+			/* byte n of a bus width word is on byte lane n */
+			for (byte = 0; byte < sizeof(diff); byte++)
+				if ((diff >> (byte * 8)) & 0xff)
+					fail_mask |= 1 << (byte % bus_bytes);
+
+			/* no need to read further, once all lanes failed */
+			if ((fail_mask & lane_mask) == lane_mask)
+				return lane_mask;
+		}
+	}
+
+	/* the failure is not attributed to a lane, e.g. the data read back is fine */
+	if ((fail_mask & lane_mask) == 0)
+		return lane_mask;
+
+	return fail_mask & lane_mask;
+}
+
 static int xor_search_1d_1e(enum hws_edge_compare edge, enum hws_search_dir search_dir,
 			    u32 step, u32 init_val, u32 end_val,
 			    u16 byte_num, enum search_element element)
@@ -342,7 +469,11 @@ static int xor_search_1d_1e(enum hws_edge_compare edge, enum hws_search_dir sear
 			if (byte_num == 8)
 				reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-			result = dma_test(dma_src, dma_dst, effective_cs);
+			/* rx elements only need the data to be read back */
+			if (element == CTX)
+				result = dma_test(dma_src, dma_dst, effective_cs);
+			else
+				result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 			if (byte_num == 8)
 				result = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -387,7 +518,11 @@ static int xor_search_1d_1e(enum hws_edge_compare edge, enum hws_search_dir sear
 			if (byte_num == 8)
 				reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-			result = dma_test(dma_src, dma_dst, effective_cs);
+			/* rx elements only need the data to be read back */
+			if (element == CTX)
+				result = dma_test(dma_src, dma_dst, effective_cs);
+			else
+				result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 			if (byte_num == 8)
 				result = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -526,6 +661,119 @@ static int xor_search_1d_2e(enum hws_edge_compare search_concept, u32 step, u32
 	return 0;
 }
 
+static void xor_search_element_set(enum search_element element, u32 byte_num, u32 val)
+{
+	if (element == REC_CAL) {
+		ddr3_tip_bus_write(0, ACCESS_TYPE_UNICAST, 0, ACCESS_TYPE_UNICAST, byte_num,
+				   DDR_PHY_DATA, VREF_BCAST_PHY_REG(effective_cs), val);
+		ddr3_tip_bus_write(0, ACCESS_TYPE_UNICAST, 0, ACCESS_TYPE_UNICAST, byte_num,
+				   DDR_PHY_DATA, VREF_PHY_REG(effective_cs, 4), val);
+		ddr3_tip_bus_write(0, ACCESS_TYPE_UNICAST, 0, ACCESS_TYPE_UNICAST, byte_num,
+				   DDR_PHY_DATA, VREF_PHY_REG(effective_cs, 5), val);
+	} else {
+		ddr3_tip_bus_write(0, ACCESS_TYPE_UNICAST, 0, ACCESS_TYPE_UNICAST, byte_num, DDR_PHY_DATA,
+				   (element == CRX) ? CRX_PHY_REG(effective_cs) : CTX_PHY_REG(effective_cs), val);
+	}
+}
+
+/*
+ * lock-step variant of xor_search_1d_1e() in pass-to-fail concept: the byte lanes
+ * in lane_mask are binary-searched together from their passing init values with
+ * a single dma_lane_test() per probe; a lane is set back to its init value once its
+ * search is over, so it doesn't fail the probes of the other lanes
+ */
+static void xor_search_1d_1e_lanes(enum hws_search_dir search_dir, u32 *init_val, u32 *end_val,
+				   u32 lane_mask, enum search_element element, u8 *result)
+{
+	int bs_left[MAX_BUS_NUM], bs_middle[MAX_BUS_NUM], bs_right[MAX_BUS_NUM], bs_found[MAX_BUS_NUM];
+	int dir = (search_dir == HWS_LOW2HIGH) ? 1 : -1;
+	u32 byte, fail_mask, active = 0;
+
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		if (!(lane_mask & (1 << byte)))
+			continue;
+		bs_left[byte] = (int)init_val[byte];
+		bs_right[byte] = (int)end_val[byte];
+		bs_found[byte] = -1;
+		active |= 1 << byte;
+	}
+
+	while (active) {
+		for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+			if (!(active & (1 << byte)))
+				continue;
+
+			if (dir * (bs_right[byte] - bs_left[byte]) < 0) {
+				/* save recently found fail, or the range end if none */
+				result[byte] = (bs_found[byte] >= 0) ? bs_found[byte] : bs_right[byte];
+				xor_search_element_set(element, byte, init_val[byte]);
+				active &= ~(1 << byte);
+				continue;
+			}
+
+			bs_middle[byte] = (bs_left[byte] + bs_right[byte]) / 2;
+			xor_search_element_set(element, byte, bs_middle[byte]);
+		}
+		if (!active)
+			break;
+
+		/* reset phy fifo pointer after rx adll or rx cal change */
+		ddr3_tip_reset_fifo_ptr(0);
+
+		fail_mask = dma_lane_test(dma_src, dma_dst, effective_cs, element, active);
+
+		for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+			if (!(active & (1 << byte)))
+				continue;
+
+			if (fail_mask & (1 << byte)) {
+				bs_found[byte] = bs_middle[byte];
+				bs_right[byte] = bs_middle[byte] - dir;
+			} else {
+				bs_left[byte] = bs_middle[byte] + dir;
+			}
+		}
+	}
+}
+
+/*
+ * lock-step variant of xor_search_1d_2e() in pass-to-fail concept for the byte
+ * lanes in lane_mask, which pass at their nominal values; the window of lane n
+ * is returned in vw[2 * n] and vw[2 * n + 1]; returns a mask of lanes w/o lock
+ */
+static u32 xor_search_1d_2e_lanes(u32 *init_val, u32 *end_val, u32 lane_mask,
+				  enum search_element element, u8 *vw)
+{
+	u32 nominal[MAX_BUS_NUM];
+	u8 vw_lo[MAX_BUS_NUM], vw_hi[MAX_BUS_NUM];
+	u32 byte, reg_addr, no_lock = 0;
+
+	if (element == REC_CAL)
+		reg_addr = VREF_BCAST_PHY_REG(effective_cs);
+	else if (element == CRX)
+		reg_addr = CRX_PHY_REG(effective_cs);
+	else
+		reg_addr = CTX_PHY_REG(effective_cs);
+
+	for (byte = 0; byte < MAX_BUS_NUM; byte++)
+		if (lane_mask & (1 << byte))
+			ddr3_tip_bus_read(0, 0, ACCESS_TYPE_UNICAST, byte, DDR_PHY_DATA, reg_addr, &nominal[byte]);
+
+	xor_search_1d_1e_lanes(HWS_LOW2HIGH, nominal, end_val, lane_mask, element, vw_hi);
+	xor_search_1d_1e_lanes(HWS_HIGH2LOW, nominal, init_val, lane_mask, element, vw_lo);
+
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		if (!(lane_mask & (1 << byte)))
+			continue;
+		vw[2 * byte] = vw_lo[byte];
+		vw[2 * byte + 1] = vw_hi[byte];
+		if ((vw_hi[byte] == nominal[byte]) && (vw_lo[byte] == nominal[byte]))
+			no_lock |= 1 << byte;
+	}
+
+	return no_lock;
+}
+
 static int xor_search_2d_1e(enum hws_edge_compare edge,
 			    enum search_element element1, enum hws_search_dir search_dir1,
 			    u32 step1, u32 init_val1, u32 end_val1,
@@ -566,7 +814,7 @@ static int xor_search_2d_1e(enum hws_edge_compare edge,
 		if (byte_num == 8)
 			reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-		result = dma_test(dma_src, dma_dst, effective_cs);
+		result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 		if (byte_num == 8)
 			result = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -745,7 +993,10 @@ static int cpu_sweep_test(u32 repeat, u32 dir, u32 mode)
 				if (sphy == 8)
 					reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-				res = dma_test(dma_src, dma_dst, effective_cs);
+				if (dir == 0)
+					res = dma_test(dma_src, dma_dst, effective_cs);
+				else
+					res = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 				if (sphy == 8)
 					res = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -823,9 +1074,6 @@ static int vertical_adjust(int ena_mask, u8 byte_num)
 	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
 	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
 	uint64_t xor_byte_mask = 0;
-	uint64_t curr_dst;
-	uint64_t val;
-	int i, j;
 
 
 	if (byte_num == 0xf) { /* 0xf - all bytes */
@@ -864,21 +1112,14 @@ static int vertical_adjust(int ena_mask, u8 byte_num)
 		}
 
 
-		for (j = 0; j < DBG_DMA_ENG_NUM; j++) {
-			/* build dma data unit from dma pattern and write to dram */
-			for (i = 0, curr_dst = dma_src[effective_cs][j];
-				 i < DBG_DMA_DATA_SIZE / sizeof(dma_pattern[0]);
-				 i++, curr_dst += sizeof(dma_pattern[0])) {
-				val = dma_pattern[i % (sizeof(dma_pattern) / sizeof(dma_pattern[0]))];
-				writeq(curr_dst, (val | xor_byte_mask));
-			}
-		}
-
+		dma_unit_write(dma_src, effective_cs, xor_byte_mask);
+		/* spread the new dma data unit to dst regions and take its golden crc32 */
+		dma_pattern_load(dma_dst, effective_cs);
 
 		if (byte_num == 8)
 			reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-		result = dma_test(dma_src, dma_dst, effective_cs);
+		result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 		if (byte_num == 8)
 			result = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -942,9 +1183,6 @@ static int horizontal_adjust(int ena_mask, u8 byte_num, u8 *valid_crx_matrix)
 	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
 	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
 	uint64_t xor_byte_mask = 0;
-	uint64_t curr_dst;
-	uint64_t val;
-	int i, j;
 
 	if (byte_num == 0xf) { /* 0xf - all bytes */
 		start_sphy = 0;
@@ -981,20 +1219,14 @@ static int horizontal_adjust(int ena_mask, u8 byte_num, u8 *valid_crx_matrix)
 			xor_byte_mask = ~xor_byte_mask;
 		}
 
-		for (j = 0; j < DBG_DMA_ENG_NUM; j++) {
-			/* build dma data unit from dma pattern and write to dram */
-			for (i = 0, curr_dst = dma_src[effective_cs][j];
-				 i < DBG_DMA_DATA_SIZE / sizeof(dma_pattern[0]);
-				 i++, curr_dst += sizeof(dma_pattern[0])) {
-				val = dma_pattern[i % (sizeof(dma_pattern) / sizeof(dma_pattern[0]))];
-				writeq(curr_dst, (val | xor_byte_mask));
-			}
-		}
+		dma_unit_write(dma_src, effective_cs, xor_byte_mask);
+		/* spread the new dma data unit to dst regions and take its golden crc32 */
+		dma_pattern_load(dma_dst, effective_cs);
 
 		if (sphy == 8)
 			reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
 
-		result = dma_test(dma_src, dma_dst, effective_cs);
+		result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 		if (sphy == 8)
 			result = reg_read(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG);
@@ -1194,6 +1426,73 @@ static int diagonal_adjust(int ena_mask, u8 byte_num)
 	return 0;
 }
 
+/*
+ * second level horizontal and vertical adjust of the data lanes in lane_mask,
+ * in lock-step, since the per interface pattern is shared by all of them;
+ * lanes failing at their nominal values need the fail-to-pass per byte search
+ * and are left out; returns a mask of lanes adjusted
+ */
+static u32 hv_adjust_lanes(u32 lane_mask, u8 *valid_crx_matrix)
+{
+	u32 init_val[MAX_BUS_NUM], end_val[MAX_BUS_NUM];
+	u8 vw[MAX_BUS_NUM * 2];
+	u32 byte, no_lock, opt;
+
+	ddr3_tip_if_write(0, ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE, ODPG_DATA_CTRL_REG,
+			  effective_cs << ODPG_DATA_CS_OFFS, ODPG_DATA_CS_MASK << ODPG_DATA_CS_OFFS);
+
+	dma_unit_write(dma_src, effective_cs, 0);
+	/* spread the new dma data unit to dst regions and take its golden crc32 */
+	dma_pattern_load(dma_dst, effective_cs);
+
+	/* horizontal */
+	lane_mask &= ~dma_lane_test(dma_src, dma_dst, effective_cs, CRX, lane_mask);
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		init_val[byte] = 0;
+		end_val[byte] = 31;
+	}
+	no_lock = xor_search_1d_2e_lanes(init_val, end_val, lane_mask, CRX, vw);
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		if (!(lane_mask & (1 << byte)))
+			continue;
+		if (no_lock & (1 << byte)) {
+#ifdef DBG_PRINT
+			printf("%s: byte %d - no crx lock\n", __func__, byte);
+#endif
+			continue;
+		}
+		opt = (vw[2 * byte] + vw[2 * byte + 1]) / 2;
+		valid_crx_matrix[effective_cs * MAX_BUS_NUM * 2 + 2 * byte] = vw[2 * byte];
+		valid_crx_matrix[effective_cs * MAX_BUS_NUM * 2 + 2 * byte + 1] = vw[2 * byte + 1];
+		xor_search_element_set(CRX, byte, opt);
+	}
+
+	/* vertical */
+	ddr3_tip_reset_fifo_ptr(0);
+	lane_mask &= ~dma_lane_test(dma_src, dma_dst, effective_cs, REC_CAL, lane_mask);
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		init_val[byte] = rx_eye_lo_lvl[byte];
+		end_val[byte] = rx_eye_hi_lvl[byte];
+	}
+	no_lock = xor_search_1d_2e_lanes(init_val, end_val, lane_mask, REC_CAL, vw);
+	for (byte = 0; byte < MAX_BUS_NUM; byte++) {
+		if (!(lane_mask & (1 << byte)))
+			continue;
+		if (no_lock & (1 << byte)) {
+#ifdef DBG_PRINT
+			printf("%s: byte %d - no rc lock\n", __func__, byte);
+#endif
+			continue;
+		}
+		opt = (vw[2 * byte] + vw[2 * byte + 1]) / 2;
+		xor_search_element_set(REC_CAL, byte, opt);
+	}
+
+	ddr3_tip_reset_fifo_ptr(0);
+
+	return lane_mask;
+}
+
 static int rx_adjust(u8 *valid_crx_matrix)
 {
 	int dbg_flag = 1;
@@ -1205,10 +1504,12 @@ static int rx_adjust(u8 *valid_crx_matrix)
 	int start_byte = 0;
 	int end_byte = octets_per_if_num;
 	int byte;
+	u32 lane_mask = 0;
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
 
 	reg_bit_clrset(MC6_BASE + MC6_RAS_CTRL_REG, 0x0 << ECC_EN_OFFS, ECC_EN_MASK << ECC_EN_OFFS);
 	reg_write(MC6_BASE + MC6_CH0_ECC_1BIT_ERR_COUNTER_REG, 0x0);
-	result = dma_test(dma_src, dma_dst, effective_cs);
+	result = dma_rd_test(dma_src, dma_dst, effective_cs);
 
 
 #ifdef DBG_PRINT
@@ -1314,7 +1615,19 @@ static int rx_adjust(u8 *valid_crx_matrix)
 	printf("%s: going to v-h second level search\n", __func__);
 #endif
 
+	/* one dma test per probe serves all data lanes; ecc lane 8 is checked by its counter */
+	for (byte = start_byte; byte < end_byte; byte++)
+		if (byte != 8 && IS_BUS_ACTIVE(tm->bus_act_mask, byte))
+			lane_mask |= 1 << byte;
+	if (mv_ddr_is_ecc_ena())
+		reg_bit_clrset(MC6_BASE + MC6_RAS_CTRL_REG, 0x0 << ECC_EN_OFFS, ECC_EN_MASK << ECC_EN_OFFS);
+	lane_mask = hv_adjust_lanes(lane_mask, valid_crx_matrix);
+	if (mv_ddr_is_ecc_ena())
+		reg_bit_clrset(MC6_BASE + MC6_RAS_CTRL_REG, 0x1 << ECC_EN_OFFS, ECC_EN_MASK << ECC_EN_OFFS);
+
 	for (byte = start_byte; byte < end_byte; byte++) {
+		if (lane_mask & (1 << byte))
+			continue;
 
 		if (mv_ddr_is_ecc_ena() && (byte != 8))
 			reg_bit_clrset(MC6_BASE + MC6_RAS_CTRL_REG, 0x0 << ECC_EN_OFFS, ECC_EN_MASK << ECC_EN_OFFS);
@@ -1364,9 +1677,6 @@ static int rx_adjust(u8 *valid_crx_matrix)
 
 int mv_ddr_validate(void)
 {
-	uint64_t curr_dst;
-	uint64_t val;
-	int i, j;
 	u32 cs, sphy;
 	unsigned int max_cs = mv_ddr_cs_num_get();
 	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
@@ -1389,20 +1699,16 @@ int mv_ddr_validate(void)
 		return 1; /* fail */
 	}
 
+	/* keep dma engines initialized for the sweeps below */
+	if (mv_ddr_dma_session_open(DBG_DMA_ENG_NUM))
+		return 1; /* fail */
+
 	for (cs = 0; cs < max_cs; cs++) {
 		dma_offs_config(dma_src, dma_dst, cs);
 
-		for (j = 0; j < DBG_DMA_ENG_NUM; j++) {
-			/* build dma data unit from dma pattern and write to dram */
-			for (i = 0, curr_dst = dma_src[cs][j];
-				 i < DBG_DMA_DATA_SIZE / sizeof(dma_pattern[0]);
-				 i++, curr_dst += sizeof(dma_pattern[0])) {
-				val = dma_pattern[i % (sizeof(dma_pattern) / sizeof(dma_pattern[0]))];
-				writeq(curr_dst, val);
-			}
-		}
-		/* copy dma data unit from src to dst */
-		mv_ddr_dma_memcpy(dma_src[cs], dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
+		dma_unit_write(dma_src, cs, 0);
+		/* write dma data unit to dst and take its golden crc32 */
+		dma_pattern_load(dma_dst, cs);
 	}
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
@@ -1411,6 +1717,7 @@ int mv_ddr_validate(void)
 			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, sphy);
 			if (new_vref_calc(rx_eye_lo_lvl[sphy], rx_eye_hi_lvl[sphy], &new_vref)) {
 				printf("new vref value calculation failed\n");
+				mv_ddr_dma_session_close();
 				return 1; /* fail */
 			}
 			ddr3_tip_bus_write(0, ACCESS_TYPE_UNICAST, 0, ACCESS_TYPE_UNICAST, sphy,
@@ -1430,6 +1737,7 @@ int mv_ddr_validate(void)
 
 			if (marvell_thermal_read(tsen, &cdeg)) {
 				printf("temperature read failed\n");
+				mv_ddr_dma_session_close();
 				return 1; /* fail */
 			}
 
@@ -1495,5 +1803,7 @@ int mv_ddr_validate(void)
 			printf("dma memcmp pass\n");
 	}
 #endif /* DBG_DMA_TEST */
+	mv_ddr_dma_session_close();
+
 	return 0;
 }
@@ -13,6 +13,7 @@
 /* TODO: remove this include when removing attribute mechanism */
 #include "ddr3_training_ip_db.h"
 #include "mv_ddr_validate.h"
+#include "mv_ddr_mem_test.h"
 
 /*
  * SNPS address lines' PHY to IO mapping configuration.
@@ -159,25 +160,41 @@ void reg_bit_clrset(u32 addr, u32 val, u32 mask)
 
 static void mv_ddr_mem_scrubbing(void)
 {
-	uint64_t val = 0;
 	uint64_t tot_mem_sz;
+	uint64_t start[MV_DDR_DMA_MEMSET_RGN_MAX], size[MV_DDR_DMA_MEMSET_RGN_MAX];
+	u32 rgn_num = 1;
 
 	tot_mem_sz = mv_ddr_mem_sz_get();
 
-	printf("mv_ddr: scrubbing memory...\n");
-
 	/* scrub memory up to non-dram memory region */
+	start[0] = 0;
 	if (tot_mem_sz < NON_DRAM_MEM_RGN_START_ADDR)
-		mv_ddr_dma_memset(0, tot_mem_sz, val);
+		size[0] = tot_mem_sz;
 	else
-		mv_ddr_dma_memset(0, NON_DRAM_MEM_RGN_START_ADDR, val);
+		size[0] = NON_DRAM_MEM_RGN_START_ADDR;
 
 	/* scrub memory up to the end */
-	if (tot_mem_sz >= NON_DRAM_MEM_RGN_END_ADDR)
-		mv_ddr_dma_memset(NON_DRAM_MEM_RGN_END_ADDR,
-				  tot_mem_sz - NON_DRAM_MEM_RGN_START_ADDR, val);
+	if (tot_mem_sz >= NON_DRAM_MEM_RGN_END_ADDR) {
+		start[1] = NON_DRAM_MEM_RGN_END_ADDR;
+		size[1] = tot_mem_sz - NON_DRAM_MEM_RGN_START_ADDR;
+		rgn_num = 2;
+	}
+
+	mv_ddr_dma_scrub(start, size, rgn_num);
+}
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size)
+{
+	return mv_ddr_dma_memset_is_done(addr, size);
 }
 
+int mv_ddr_mem_scrub_wait(void)
+{
+	return mv_ddr_dma_scrub_wait() ? MV_FAIL : MV_OK;
+}
+#endif /* MV_DDR_SCRUB_ASYNC */
+
 int mv_ddr_pre_config(void)
 {
 	struct mv_ddr_iface *curr_iface = mv_ddr_iface_get();
@@ -204,6 +221,14 @@ int mv_ddr_pre_config(void)
 int mv_ddr_post_config(void)
 {
 	struct mv_ddr_iface *iface = mv_ddr_iface_get();
+	int ret = 0;
+
+#if defined(MV_DDR_MEM_TEST)
+	/* test memory before scrubbing, which clears it */
+	if (mv_ddr_mem_test((iface->validation == MV_DDR_MEMORY_CHECK) ?
+			    MV_DDR_MEM_TEST_FULL : MV_DDR_MEM_TEST_PROFILE) != MV_OK)
+		ret = -1;
+#endif /* MV_DDR_MEM_TEST */
 
 	if (mv_ddr_is_ecc_ena())
 		mv_ddr_mem_scrubbing();
@@ -212,12 +237,16 @@ int mv_ddr_post_config(void)
 	iface->iface_byte_size = mv_ddr_mem_sz_get();
 
 	if (iface->validation != MV_DDR_VAL_DIS) {
+#if defined(MV_DDR_SCRUB_ASYNC)
+		/* validation needs the dma engines and scrubbed memory */
+		mv_ddr_mem_scrub_wait();
+#endif /* MV_DDR_SCRUB_ASYNC */
 		if (mv_ddr_validate())
 			printf("DRAM validation interface %d start address 0x%llx\n",
 				iface->id, iface->iface_base_addr);
 	}
 
-	return 0;
+	return ret;
 }
 
 /* return ddr frequency from sar */
@@ -30,6 +30,16 @@
 /* functions declaration */
 int mv_ddr_pre_config(void);
 int mv_ddr_post_config(void);
+#if defined(MV_DDR_SCRUB_ASYNC)
+/*
+ * background scrubbing may still run when ddr3_init() returns: the caller must
+ * keep the sram that holds the dma descriptors queues (qmem in mv_ddr_xor_v2.c)
+ * in place, and must not use memory that mv_ddr_mem_scrub_is_done() doesn't
+ * report as scrubbed, until mv_ddr_mem_scrub_wait() returns
+ */
+int mv_ddr_mem_scrub_is_done(uint64_t addr, uint64_t size);
+int mv_ddr_mem_scrub_wait(void);
+#endif /* MV_DDR_SCRUB_ASYNC */
 int mv_ddr_mc_config(void);
 int mv_ddr_mc_ena(void);
 int mv_ddr_phy_config(void);
@@ -30,6 +30,10 @@
 #endif
 
 static uint64_t dma_src[DBG_MAX_CS_NUM][DBG_DMA_ENG_NUM], dma_dst[DBG_MAX_CS_NUM][DBG_DMA_ENG_NUM];
+/* dma data unit, as built by the cpu, written to src regions per cs */
+static uint64_t dma_unit[DBG_MAX_CS_NUM][DBG_DMA_DATA_SIZE / sizeof(uint64_t)];
+/* golden dma data unit held by dst regions; see dma_pattern_load() */
+static struct mv_ddr_dma_golden dma_golden[DBG_MAX_CS_NUM];
 
 static uint64_t dma_gap_calc(uint64_t size)
 {
@@ -64,6 +68,30 @@ static int dma_offs_config(uint64_t dma_src[][DBG_DMA_ENG_NUM],
 	return 0;
 }
 
+/*
+ * write dma data unit to dst regions by the cpu and take its golden crc32 on
+ * the cpu, for dma_rd_test(); no dram read is involved, so the golden data is
+ * right whatever the rx setup being swept; to be called after dma_unit is built
+ */
+static int dma_pattern_load(uint64_t dma_dst[][DBG_DMA_ENG_NUM], u32 cs)
+{
+	return mv_ddr_dma_golden_load(dma_unit[cs], dma_dst[cs], DBG_DMA_DATA_SIZE,
+				      DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM, &dma_golden[cs]);
+}
+
+/*
+ * read-only dma test for rx sweeps: dst regions are only read back and
+ * their crc32 compared with the golden one, instead of a copy and a compare
+ */
+static int dma_rd_test(uint64_t dma_src[][DBG_DMA_ENG_NUM],
+		       uint64_t dma_dst[][DBG_DMA_ENG_NUM],
+		       u32 cs)
+{
+	/* dst regions are reloaded first after a failed tx point overwrote them */
+	return mv_ddr_dma_session_golden_check(dma_dst[cs], DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM,
+					       DBG_DMA_DESC_NUM, &dma_golden[cs]);
+}
+
 /* dma pattern */
 static uint64_t dma_pattern[] = {
 	0xf7f7f7f7f7f7f7f7,
@@ -160,18 +188,8 @@ static void rx_validate_per_adll(u32 bit,
 				      REG_1018D_RX_CLK_DLY_TG1_NIBBLE1_BASE) +
 				      (dbyte << DBYTE_INSTANCE_OFFSET)), rx_adll);
 
-		/* copy from src to dst */
-		mv_ddr_dma_memcpy(dma_src[cs],
-				  dma_dst[cs],
-				  DBG_DMA_DATA_SIZE,
-				  DBG_DMA_ENG_NUM,
-				  DBG_DMA_DESC_NUM);
-		/* compare src to dst */
-		res = mv_ddr_dma_memcmp(dma_src[cs],
-					dma_dst[cs],
-					DBG_DMA_DATA_SIZE,
-					DBG_DMA_ENG_NUM,
-					DBG_DMA_DESC_NUM);
+		/* read back the dma data unit spread over dst */
+		res = dma_rd_test(dma_src, dma_dst, cs);
 		if (bit < NIBBLE) {
 			if ((current_adll_val_nibble0 == rx_adll) &&
 			    ((current_vref <= vref) &&
@@ -330,17 +348,21 @@ static void tx_validate_per_adll(u32 bit,
 			      (coarse << TX_COARSE_DELAY_OFFS) | tx_adll);
 
 		/* copy from src to dst */
-		mv_ddr_dma_memcpy(dma_src[cs],
-				  dma_dst[cs],
-				  DBG_DMA_DATA_SIZE,
-				  DBG_DMA_ENG_NUM,
-				  DBG_DMA_DESC_NUM);
+		mv_ddr_dma_session_memcpy(dma_src[cs],
+					  dma_dst[cs],
+					  DBG_DMA_DATA_SIZE,
+					  DBG_DMA_ENG_NUM,
+					  DBG_DMA_DESC_NUM);
+		mv_ddr_dma_session_wait();
 		/* compare src to dst */
-		res = mv_ddr_dma_memcmp(dma_src[cs],
-					dma_dst[cs],
-					DBG_DMA_DATA_SIZE,
-					DBG_DMA_ENG_NUM,
-					DBG_DMA_DESC_NUM);
+		mv_ddr_dma_session_memcmp(dma_src[cs],
+					  dma_dst[cs],
+					  DBG_DMA_DATA_SIZE,
+					  DBG_DMA_ENG_NUM,
+					  DBG_DMA_DESC_NUM);
+		res = mv_ddr_dma_session_wait();
+		if (res)
+			dma_golden[cs].dirty = 1;
 
 		if ((range == current_range) &&
 		    (abs_current_adll_val == tx_adll) &&
@@ -515,7 +537,6 @@ static void tx_validate_per_cs(u32 max_bit_in_byte, u32 iface_id)
 int mv_ddr_validate(void)
 {
 	uint64_t curr_dst;
-	uint64_t val;
 	int i, j;
 	u32 cs;
 	struct mv_ddr_iface *iface = mv_ddr_iface_get();
@@ -528,21 +549,24 @@ int mv_ddr_validate(void)
 		return 1; /* fail */
 	}
 
+	/* keep dma engines initialized for the sweeps below */
+	if (mv_ddr_dma_session_open(DBG_DMA_ENG_NUM))
+		return 1; /* fail */
+
 	for (cs = 0; cs < max_cs; cs++) {
 		dma_offs_config(dma_src, dma_dst, cs, iface->id);
+		/* build dma data unit from dma pattern and write to dram */
+		for (i = 0; i < DBG_DMA_DATA_SIZE / sizeof(dma_pattern[0]); i++)
+			dma_unit[cs][i] = dma_pattern[i % (sizeof(dma_pattern) / sizeof(dma_pattern[0]))];
 		for (j = 0; j < DBG_DMA_ENG_NUM; j++) {
-			/* build dma data unit from dma pattern and write to dram */
 			for (i = 0, curr_dst = dma_src[cs][j];
 				i < DBG_DMA_DATA_SIZE / sizeof(dma_pattern[0]);
-				i++, curr_dst += sizeof(dma_pattern[0])) {
-				val = dma_pattern[i % (sizeof(dma_pattern) / sizeof(dma_pattern[0]))];
-				writeq(curr_dst, val);
-			}
+				i++, curr_dst += sizeof(dma_pattern[0]))
+				writeq(curr_dst, dma_unit[cs][i]);
 		}
 
-		/* copy dma data unit from src to dst */
-		mv_ddr_dma_memcpy(dma_src[cs], dma_dst[cs],
-				  DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM);
+		/* write dma data unit to dst and take its golden crc32 */
+		dma_pattern_load(dma_dst, cs);
 		/* compare src to dst */
 		if (mv_ddr_dma_memcmp(dma_src[cs], dma_dst[cs],
 				      DBG_DMA_DATA_SIZE, DBG_DMA_ENG_NUM, DBG_DMA_DESC_NUM))
@@ -594,5 +618,7 @@ int mv_ddr_validate(void)
 			       (CMD2_CH0_MASK << CMD2_CH0_OFFS));
 	}
 
+	mv_ddr_dma_session_close();
+
 	return 0;
 }
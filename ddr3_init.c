@@ -18,6 +18,9 @@ static char *ddr_type = "DDR3";
 u8 generic_init_controller = 1;
 
 static int mv_ddr_training_params_set(u8 dev_num);
+#if !defined(CONFIG_PHY_STATIC) || defined(MV_DDR_RETRAIN)
+static int mv_ddr_phy_train(void);
+#endif
 
 /*
  * Name:     ddr3_init - Main DDR3 Init function
@@ -34,6 +37,10 @@ int ddr3_init(void)
 	/* Print mv_ddr version */
 	mv_ddr_ver_print();
 
+#if defined(MV_DDR_TRACE)
+	mv_ddr_trace_reset();
+#endif /* MV_DDR_TRACE */
+
 	mv_ddr_pre_training_fixup();
 
 	/* SoC/Board special initializations */
@@ -57,6 +64,15 @@ int ddr3_init(void)
 	if (MV_OK != status)
 		return status;
 
+	/*
+	 * on a suspend to ram wakeup the platform restores the saved setup;
+	 * training, init sequence and scrubbing would all destroy the dram
+	 * contents. anything but MV_NOT_STARTED ends the init here.
+	 */
+	status = mv_ddr_soc_resume(ddr_type);
+	if (status != MV_NOT_STARTED)
+		return status;
+
 #if defined(CONFIG_MC_STATIC)
 	mv_ddr_mc_static_config();
 #else
@@ -91,13 +107,23 @@ int ddr3_init(void)
 
 #if defined(CONFIG_PHY_STATIC)
 	mv_ddr_phy_static_config();
-#else
-	/* PHY initialization (Training) */
-	status = hws_ddr3_tip_run_alg(0, ALGO_TYPE_DYNAMIC);
+#if defined(MV_DDR_RETRAIN)
+	/*
+	 * check the static setup per byte lane and retrain the failing lanes;
+	 * a setup that cannot be fixed that way falls back to the full training
+	 */
+	status = mv_ddr_retrain(0, mv_ddr_cs_num_get());
 	if (MV_OK != status) {
-		printf("%s Training Sequence - FAILED\n", ddr_type);
-		return status;
+		printf("%s Static PHY Configuration - FAILED, running training\n", ddr_type);
+		status = mv_ddr_phy_train();
+		if (MV_OK != status)
+			return status;
 	}
+#endif /* MV_DDR_RETRAIN */
+#else
+	status = mv_ddr_phy_train();
+	if (MV_OK != status)
+		return status;
 #endif
 
 #if defined(CONFIG_PHY_STATIC_PRINT)
@@ -107,16 +133,72 @@ int ddr3_init(void)
 	/* Post MC/PHY initializations */
 	mv_ddr_post_training_soc_config(ddr_type);
 
-	mv_ddr_post_training_fixup();
+	status = mv_ddr_post_training_fixup();
+	if (MV_OK != status) {
+		printf("%s Post Training Fixup - FAILED 0x%x\n", ddr_type, status);
+		return status;
+	}
+
+	mv_ddr_soc_resume_save();
 
 	if (mv_ddr_is_ecc_ena())
 		mv_ddr_mem_scrubbing();
 
+#if defined(MV_DDR_TRACE) && defined(MV_DDR_TRACE_DUMP_ADDR)
+	/* dram is up, keep the trace there for the boot loader to fetch */
+	{
+		u32 len;
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+		/* the dump must not race with the background scrubbing */
+		mv_ddr_mem_scrub_wait();
+#endif /* MV_DDR_SCRUB_ASYNC */
+
+		if (mv_ddr_trace_record_get((u8 *)(uintptr_t)MV_DDR_TRACE_DUMP_ADDR,
+					    MV_DDR_TRACE_RECORD_MAX_SIZE, &len) == MV_OK)
+			printf("mv_ddr: trace: %d bytes at 0x%x\n", len, MV_DDR_TRACE_DUMP_ADDR);
+	}
+#endif /* MV_DDR_TRACE && MV_DDR_TRACE_DUMP_ADDR */
+
+#if defined(MV_DDR_PROF) && defined(MV_DDR_PROF_DUMP_ADDR)
+	/* keep the training profile in dram too, for tools/prof_decode */
+	{
+		u32 len;
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+		/* the dump must not race with the background scrubbing */
+		mv_ddr_mem_scrub_wait();
+#endif /* MV_DDR_SCRUB_ASYNC */
+
+		if (mv_ddr_prof_record_get((u8 *)(uintptr_t)MV_DDR_PROF_DUMP_ADDR,
+					   MV_DDR_PROF_RECORD_MAX_SIZE, &len) == MV_OK)
+			printf("mv_ddr: profile: %d bytes at 0x%x\n", len, MV_DDR_PROF_DUMP_ADDR);
+	}
+#endif /* MV_DDR_PROF && MV_DDR_PROF_DUMP_ADDR */
+
 	printf("mv_ddr: completed successfully\n");
 
 	return MV_OK;
 }
 
+#if !defined(CONFIG_PHY_STATIC) || defined(MV_DDR_RETRAIN)
+/* PHY initialization (Training) */
+static int mv_ddr_phy_train(void)
+{
+	int status;
+
+	status = hws_ddr3_tip_run_alg(0, ALGO_TYPE_DYNAMIC);
+	if (MV_OK != status) {
+		printf("%s Training Sequence - FAILED\n", ddr_type);
+#if defined(MV_DDR_TRACE)
+		mv_ddr_trace_print(MV_DDR_TRACE_FAIL_PRINT);
+#endif /* MV_DDR_TRACE */
+	}
+
+	return status;
+}
+#endif
+
 /*
  * Name:	mv_ddr_training_params_set
  * Desc:
@@ -19,6 +19,14 @@
 #include "a38x/mv_ddr_plat.h"
 #endif
 
+/*
+ * platforms w/o a free running time base read zero: timeouts never expire,
+ * waits record poll steps only and the profiler reports access counts only
+ */
+#if !defined(mv_ddr_time_us)
+#define mv_ddr_time_us()		0
+#endif
+
 #include "seq_exec.h"
 #include "ddr3_logging_def.h"
 #include "ddr3_training_hw_algo.h"
@@ -29,6 +37,14 @@
 #include "ddr3_training_ip_pbs.h"
 #include "ddr3_training_ip_prv_if.h"
 #include "ddr3_training_leveling.h"
+#include "mv_ddr_phy_batch.h"
+#include "mv_ddr_phy_cache.h"
+#include "mv_ddr_prof.h"
+#include "mv_ddr_retrain.h"
+#include "mv_ddr_shadow.h"
+#include "mv_ddr_snapshot.h"
+#include "mv_ddr_trace.h"
+#include "mv_ddr_wait.h"
 #include "xor.h"
 
 /* For checking function return values */
@@ -162,6 +178,9 @@ int mv_ddr_early_init2(void);
 int ddr3_silicon_post_init(void);
 int ddr3_post_run_alg(void);
 void ddr3_new_tip_ecc_scrub(void);
+int ddr3_new_tip_ecc_scrub_start(void);
+int ddr3_new_tip_ecc_scrub_is_done(uint64_t addr, uint64_t size);
+void ddr3_new_tip_ecc_scrub_wait(void);
 
 int ddr3_tip_reg_write(u32 dev_num, u32 reg_addr, u32 data);
 int ddr3_tip_reg_read(u32 dev_num, u32 reg_addr, u32 *data, u32 reg_mask);
@@ -181,6 +200,11 @@ int read_phase_value(u32 dev_num, u32 pup_values[MAX_INTERFACE_NUM * MAX_BUS_NUM
 int write_leveling_value(u32 dev_num, u32 pup_values[MAX_INTERFACE_NUM * MAX_BUS_NUM],
 			 u32 pup_ph_values[MAX_INTERFACE_NUM * MAX_BUS_NUM], int reg_addr);
 int ddr3_tip_restore_dunit_regs(u32 dev_num);
+int ddr3_tip_ddr3_reset_phy_regs(u32 dev_num);
+u32 mv_ddr_phy_cs_reg_get(u32 cs, u32 idx);
+int adll_calibration(u32 dev_num, enum hws_access_type access_type,
+		     u32 if_id, enum mv_ddr_freq frequency);
+void mv_ddr_training_stage_set(enum auto_tune_stage stage);
 void print_topology(struct mv_ddr_topology_map *tm);
 
 u32 mv_board_id_get(void);
@@ -1059,17 +1059,48 @@ static int odt_test(u32 dev_num, enum hws_algo_type algo_type)
  */
 int hws_ddr3_tip_select_ddr_controller(u32 dev_num, int enable)
 {
+#if defined(MV_DDR_SHADOW)
+	/* the platform accesses the mux register directly */
+	mv_ddr_shadow_invalidate();
+#endif /* MV_DDR_SHADOW */
 	return config_func_info[dev_num].
 		tip_dunit_mux_select_func((u8)dev_num, enable);
 }
 
+/*
+ * Set current training stage
+ */
+void mv_ddr_training_stage_set(enum auto_tune_stage stage)
+{
+	training_stage = stage;
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_STAGE, 0, stage, 0, 0, 0);
+#if defined(MV_DDR_PROF)
+	mv_ddr_prof_stage_set(stage);
+#endif /* MV_DDR_PROF */
+}
+
 /*
  * Dunit Register Write
  */
 int ddr3_tip_if_write(u32 dev_num, enum hws_access_type interface_access,
 		      u32 if_id, u32 reg_addr, u32 data_value, u32 mask)
 {
+#if defined(MV_DDR_PHY_BATCH)
+	if (mv_ddr_phy_batch_is_pending())
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+#endif /* MV_DDR_PHY_BATCH */
+#if defined(MV_DDR_SHADOW)
+	if (mv_ddr_shadow_write(dev_num, reg_addr, &data_value, &mask) == MV_NO_CHANGE)
+		return MV_OK;
+#endif /* MV_DDR_SHADOW */
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_DUNIT_WR);
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_DUNIT_WR, 0, 0, reg_addr, data_value, mask);
 	config_func_info[dev_num].mv_ddr_dunit_write(reg_addr, mask, data_value);
+#if defined(MV_DDR_PHY_CACHE)
+	/* hw leveling writes its results to the phy */
+	if (reg_addr == TRAINING_REG)
+		mv_ddr_phy_cache_invalidate();
+#endif /* MV_DDR_PHY_CACHE */
 
 	return MV_OK;
 }
@@ -1080,7 +1111,19 @@ int ddr3_tip_if_write(u32 dev_num, enum hws_access_type interface_access,
 int ddr3_tip_if_read(u32 dev_num, enum hws_access_type interface_access,
 		     u32 if_id, u32 reg_addr, u32 *data, u32 mask)
 {
+#if defined(MV_DDR_PHY_BATCH)
+	if (mv_ddr_phy_batch_is_pending())
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+#endif /* MV_DDR_PHY_BATCH */
+#if defined(MV_DDR_SHADOW)
+	if (mv_ddr_shadow_read(dev_num, reg_addr, data) == MV_OK) {
+		*data &= mask;
+		return MV_OK;
+	}
+#endif /* MV_DDR_SHADOW */
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_DUNIT_RD);
 	config_func_info[dev_num].mv_ddr_dunit_read(reg_addr, mask, data);
+	MV_DDR_TRACE_READ(MV_DDR_TRACE_DUNIT_RD, 0, 0, reg_addr, data, mask);
 
 	return MV_OK;
 }
@@ -1112,6 +1155,7 @@ int ddr3_tip_if_polling(u32 dev_num, enum hws_access_type access_type,
 
 		is_if_fail = 0;
 		for (poll_cnt = 0; poll_cnt < poll_tries; poll_cnt++) {
+			MV_DDR_PROF_CNT_INC(MV_DDR_PROF_POLL);
 			ret =
 				ddr3_tip_if_read(dev_num, ACCESS_TYPE_UNICAST,
 						 interface_num, offset, read_data,
@@ -1130,6 +1174,7 @@ int ddr3_tip_if_polling(u32 dev_num, enum hws_access_type access_type,
 			is_if_fail = 1;
 		}
 
+		MV_DDR_TRACE_LOG(MV_DDR_TRACE_POLL, is_if_fail, poll_cnt, offset, exp_value, mask);
 		training_result[training_stage][interface_num] =
 			(is_if_fail == 1) ? TEST_FAILED : TEST_SUCCESS;
 	}
@@ -1144,8 +1189,31 @@ int ddr3_tip_bus_read(u32 dev_num, u32 if_id,
 		      enum hws_access_type phy_access, u32 phy_id,
 		      enum hws_ddr_phy phy_type, u32 reg_addr, u32 *data)
 {
-	return config_func_info[dev_num].
+	int ret;
+
+#if defined(MV_DDR_PHY_BATCH)
+	if (mv_ddr_phy_batch_is_pending())
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+#endif /* MV_DDR_PHY_BATCH */
+
+#if defined(MV_DDR_PHY_CACHE)
+	if (mv_ddr_phy_cache_read(phy_access, phy_id, phy_type, reg_addr, data) == MV_OK)
+		return MV_OK;
+
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_PHY_RD);
+	ret = config_func_info[dev_num].
 		mv_ddr_phy_read(phy_access, phy_id, phy_type, reg_addr, data);
+	if (ret == MV_OK)
+		mv_ddr_phy_cache_fill(phy_access, phy_id, phy_type, reg_addr, data);
+#else /* !MV_DDR_PHY_CACHE */
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_PHY_RD);
+	ret = config_func_info[dev_num].
+		mv_ddr_phy_read(phy_access, phy_id, phy_type, reg_addr, data);
+#endif /* MV_DDR_PHY_CACHE */
+	MV_DDR_TRACE_READ(MV_DDR_TRACE_PHY_RD, MV_DDR_TRACE_PHY(phy_access, phy_type),
+			  phy_id, reg_addr, data, 0);
+
+	return ret;
 }
 
 /*
@@ -1156,8 +1224,35 @@ int ddr3_tip_bus_write(u32 dev_num, enum hws_access_type interface_access,
 		       u32 phy_id, enum hws_ddr_phy phy_type, u32 reg_addr,
 		       u32 data_value)
 {
+#if defined(MV_DDR_PHY_CACHE)
+	int ret;
+#endif /* MV_DDR_PHY_CACHE */
+
+#if defined(MV_DDR_PHY_BATCH)
+	if (mv_ddr_phy_batch_is_active() && phy_access == ACCESS_TYPE_UNICAST)
+		return mv_ddr_phy_batch_add(dev_num, phy_id, phy_type, reg_addr, data_value);
+	if (mv_ddr_phy_batch_is_pending())
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+#endif /* MV_DDR_PHY_BATCH */
+
+	MV_DDR_TRACE_LOG(MV_DDR_TRACE_PHY_WR, MV_DDR_TRACE_PHY(phy_access, phy_type),
+			 phy_id, reg_addr, data_value, 0);
+#if defined(MV_DDR_PHY_CACHE)
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_PHY_WR);
+	ret = config_func_info[dev_num].
+		mv_ddr_phy_write(phy_access, phy_id, phy_type, reg_addr, data_value, OPERATION_WRITE);
+	if (ret == MV_OK)
+		mv_ddr_phy_cache_write(phy_access, phy_id, phy_type, reg_addr, data_value);
+	else
+		mv_ddr_phy_cache_invalidate();
+
+	return ret;
+#else /* !MV_DDR_PHY_CACHE */
+	MV_DDR_PROF_CNT_INC(MV_DDR_PROF_PHY_WR);
+
 	return config_func_info[dev_num].
 		mv_ddr_phy_write(phy_access, phy_id, phy_type, reg_addr, data_value, OPERATION_WRITE);
+#endif /* MV_DDR_PHY_CACHE */
 }
 
 
@@ -1210,7 +1305,7 @@ int adll_calibration(u32 dev_num, enum hws_access_type access_type,
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, SDRAM_CFG_REG,
 		      0, 0x10000000));
-	mdelay(10);
+	mv_ddr_wait_settle(MV_DDR_WAIT_DRV_RESET, MV_DDR_RESET_PULSE_US);
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, SDRAM_CFG_REG,
 		      0x10000000, 0x10000000));
@@ -1246,15 +1341,17 @@ int adll_calibration(u32 dev_num, enum hws_access_type access_type,
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, DRAM_PHY_CFG_REG,
 		      0, (0x80000000 | 0x40000000)));
-	mdelay(100 / (mv_ddr_freq_get(frequency)) / mv_ddr_freq_get(MV_DDR_FREQ_LOW_FREQ));
+	mv_ddr_wait_settle(MV_DDR_WAIT_ADLL_RESET,
+			   MV_DDR_ADLL_RESET_US(mv_ddr_freq_get(frequency),
+						mv_ddr_freq_get(MV_DDR_FREQ_LOW_FREQ)));
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, DRAM_PHY_CFG_REG,
 		      (0x80000000 | 0x40000000), (0x80000000 | 0x40000000)));
 
 	/* polling for ADLL Done */
-	if (ddr3_tip_if_polling(dev_num, access_type, if_id,
-				0x3ff03ff, 0x3ff03ff, PHY_LOCK_STATUS_REG,
-				MAX_POLLING_ITERATIONS) != MV_OK) {
+	if (mv_ddr_wait_reg(dev_num, MV_DDR_WAIT_ADLL_LOCK, access_type, if_id,
+			    PHY_LOCK_STATUS_REG, 0x3ff03ff, 0x3ff03ff, 0,
+			    MV_DDR_WAIT_TIMEOUT_US) != MV_OK) {
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
 				  ("Freq_set: DDR3 poll failed(1)"));
 	}
@@ -1263,7 +1360,7 @@ int adll_calibration(u32 dev_num, enum hws_access_type access_type,
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, SDRAM_CFG_REG,
 		      0, 0x60000000));
-	mdelay(10);
+	mv_ddr_wait_settle(MV_DDR_WAIT_PUP_RESET, MV_DDR_RESET_PULSE_US);
 	CHECK_STATUS(ddr3_tip_if_write
 		     (dev_num, access_type, if_id, SDRAM_CFG_REG,
 		      0x60000000, 0x60000000));
@@ -1523,7 +1620,7 @@ int ddr3_tip_freq_set(u32 dev_num, enum hws_access_type access_type,
 		CHECK_STATUS(ddr3_tip_if_write
 			     (dev_num, access_type, if_id,
 			      SDRAM_CFG_REG, 0, 0x10000000));
-		mdelay(10);
+		mv_ddr_wait_settle(MV_DDR_WAIT_DRV_RESET, MV_DDR_RESET_PULSE_US);
 		CHECK_STATUS(ddr3_tip_if_write
 			     (dev_num, access_type, if_id,
 			      SDRAM_CFG_REG, 0x10000000, 0x10000000));
@@ -1556,17 +1653,17 @@ int ddr3_tip_freq_set(u32 dev_num, enum hws_access_type access_type,
 			     (dev_num, access_type, if_id,
 			      DRAM_PHY_CFG_REG, 0,
 			      (0x80000000 | 0x40000000)));
-		mdelay(100 / (freq / mv_ddr_freq_get(MV_DDR_FREQ_LOW_FREQ)));
+		mv_ddr_wait_settle(MV_DDR_WAIT_ADLL_RESET,
+				   MV_DDR_ADLL_RESET_US(freq, mv_ddr_freq_get(MV_DDR_FREQ_LOW_FREQ)));
 		CHECK_STATUS(ddr3_tip_if_write
 			     (dev_num, access_type, if_id,
 			      DRAM_PHY_CFG_REG, (0x80000000 | 0x40000000),
 			      (0x80000000 | 0x40000000)));
 
 		/* polling for ADLL Done */
-		if (ddr3_tip_if_polling
-		    (dev_num, ACCESS_TYPE_UNICAST, if_id, 0x3ff03ff,
-		     0x3ff03ff, PHY_LOCK_STATUS_REG,
-		     MAX_POLLING_ITERATIONS) != MV_OK) {
+		if (mv_ddr_wait_reg(dev_num, MV_DDR_WAIT_ADLL_LOCK, ACCESS_TYPE_UNICAST,
+				    if_id, PHY_LOCK_STATUS_REG, 0x3ff03ff, 0x3ff03ff, 0,
+				    MV_DDR_WAIT_TIMEOUT_US) != MV_OK) {
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
 					  ("Freq_set: DDR3 poll failed(1)\n"));
 		}
@@ -1575,7 +1672,7 @@ int ddr3_tip_freq_set(u32 dev_num, enum hws_access_type access_type,
 		CHECK_STATUS(ddr3_tip_if_write
 			     (dev_num, access_type, if_id,
 			      SDRAM_CFG_REG, 0, 0x60000000));
-		mdelay(10);
+		mv_ddr_wait_settle(MV_DDR_WAIT_PUP_RESET, MV_DDR_RESET_PULSE_US);
 		CHECK_STATUS(ddr3_tip_if_write
 			     (dev_num, access_type, if_id,
 			      SDRAM_CFG_REG, 0x60000000, 0x60000000));
@@ -2043,12 +2140,10 @@ int ddr3_tip_reset_fifo_ptr(u32 dev_num)
 	return MV_OK;
 }
 
-/*
- * Reset Phy registers
- */
-int ddr3_tip_ddr3_reset_phy_regs(u32 dev_num)
+/* reset the trained setup of the data subphys of every cs */
+static int ddr3_tip_data_phy_regs_reset(u32 dev_num)
 {
-	u32 if_id, phy_id, cs;
+	u32 if_id, phy_id;
 	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
 	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
 
@@ -2103,6 +2198,20 @@ int ddr3_tip_ddr3_reset_phy_regs(u32 dev_num)
 		}
 	}
 
+	return MV_OK;
+}
+
+/*
+ * Reset Phy registers
+ */
+int ddr3_tip_ddr3_reset_phy_regs(u32 dev_num)
+{
+	u32 cs;
+
+	/* same values go to all subphys; let the batch turn them into broadcasts */
+	CHECK_STATUS(mv_ddr_phy_batch_start(dev_num));
+	CHECK_STATUS(mv_ddr_phy_batch_end(dev_num, ddr3_tip_data_phy_regs_reset(dev_num)));
+
 	/* Set Receiver Calibration value */
 	for (cs = 0; cs < MAX_CS_NUM; cs++) {
 		/* PHY register 0xdb bits[5:0] - configure to 63 */
@@ -2115,6 +2224,31 @@ int ddr3_tip_ddr3_reset_phy_regs(u32 dev_num)
 	return MV_OK;
 }
 
+/* per cs data phy register by index, up to PHY_CS_REGS_NUM */
+u32 mv_ddr_phy_cs_reg_get(u32 cs, u32 idx)
+{
+	switch (idx) {
+	case 0:
+		return WL_PHY_REG(cs);
+	case 1:
+		return CTX_PHY_REG(cs);
+	case 2:
+		return RL_PHY_REG(cs);
+	case 3:
+		return CRX_PHY_REG(cs);
+	}
+
+	idx -= 4;
+	if (idx < PHY_CS_PBS_PADS)
+		return PBS_TX_PHY_REG(cs, idx);
+
+	idx -= PHY_CS_PBS_PADS;
+	if (idx < PHY_CS_PBS_PADS)
+		return PBS_RX_PHY_REG(cs, idx);
+
+	return VREF_PHY_REG(cs, idx - PHY_CS_PBS_PADS);
+}
+
 /*
  * Restore Dunit registers
  */
@@ -2228,7 +2362,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & INIT_CONTROLLER_MASK_BIT) {
-		training_stage = INIT_CONTROLLER;
+		mv_ddr_training_stage_set(INIT_CONTROLLER);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("INIT_CONTROLLER_MASK_BIT\n"));
 		init_cntr_prm.do_mrs_phy = 1;
@@ -2255,8 +2389,16 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 			return MV_FAIL;
 	}
 
+#if defined(MV_DDR_SNAPSHOT)
+	/* warm boot: apply a matching training snapshot instead of training */
+	if (mv_ddr_snapshot_restore(dev_num) == MV_OK) {
+		CHECK_STATUS(ddr3_tip_restore_dunit_regs(dev_num));
+		return MV_OK;
+	}
+#endif /* MV_DDR_SNAPSHOT */
+
 	if (mask_tune_func & SET_LOW_FREQ_MASK_BIT) {
-		training_stage = SET_LOW_FREQ;
+		mv_ddr_training_stage_set(SET_LOW_FREQ);
 
 		for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 			ddr3_tip_adll_regs_bypass(dev_num, 0, 0x1f);
@@ -2280,7 +2422,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & WRITE_LEVELING_LF_MASK_BIT) {
-		training_stage = WRITE_LEVELING_LF;
+		mv_ddr_training_stage_set(WRITE_LEVELING_LF);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 			("WRITE_LEVELING_LF_MASK_BIT\n"));
 		ret = ddr3_tip_dynamic_write_leveling(dev_num, 1);
@@ -2296,7 +2438,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & LOAD_PATTERN_MASK_BIT) {
-			training_stage = LOAD_PATTERN;
+			mv_ddr_training_stage_set(LOAD_PATTERN);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("LOAD_PATTERN_MASK_BIT #%d\n",
 					   effective_cs));
@@ -2324,7 +2466,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	effective_cs = 0;
 
 	if (mask_tune_func & SET_MEDIUM_FREQ_MASK_BIT) {
-		training_stage = SET_MEDIUM_FREQ;
+		mv_ddr_training_stage_set(SET_MEDIUM_FREQ);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("SET_MEDIUM_FREQ_MASK_BIT %d\n",
 				   freq_tbl[medium_freq]));
@@ -2342,7 +2484,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & WRITE_LEVELING_MASK_BIT) {
-		training_stage = WRITE_LEVELING;
+		mv_ddr_training_stage_set(WRITE_LEVELING);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("WRITE_LEVELING_MASK_BIT\n"));
 		if ((rl_mid_freq_wa == 0) || (freq_tbl[medium_freq] == 533)) {
@@ -2364,7 +2506,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & LOAD_PATTERN_2_MASK_BIT) {
-			training_stage = LOAD_PATTERN_2;
+			mv_ddr_training_stage_set(LOAD_PATTERN_2);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("LOAD_PATTERN_2_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2384,7 +2526,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	effective_cs = 0;
 
 	if (mask_tune_func & READ_LEVELING_MASK_BIT) {
-		training_stage = READ_LEVELING;
+		mv_ddr_training_stage_set(READ_LEVELING);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("READ_LEVELING_MASK_BIT\n"));
 		if ((rl_mid_freq_wa == 0) || (freq_tbl[medium_freq] == 533)) {
@@ -2405,7 +2547,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & WRITE_LEVELING_SUPP_MASK_BIT) {
-		training_stage = WRITE_LEVELING_SUPP;
+		mv_ddr_training_stage_set(WRITE_LEVELING_SUPP);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("WRITE_LEVELING_SUPP_MASK_BIT\n"));
 		ret = ddr3_tip_dynamic_write_leveling_supp(dev_num);
@@ -2422,7 +2564,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 #if !defined(CONFIG_DDR4)
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & PBS_RX_MASK_BIT) {
-			training_stage = PBS_RX;
+			mv_ddr_training_stage_set(PBS_RX);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("PBS_RX_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2441,7 +2583,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & PBS_TX_MASK_BIT) {
-			training_stage = PBS_TX;
+			mv_ddr_training_stage_set(PBS_TX);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("PBS_TX_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2462,7 +2604,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 #endif /* CONFIG_DDR4 */
 
 	if (mask_tune_func & SET_TARGET_FREQ_MASK_BIT) {
-		training_stage = SET_TARGET_FREQ;
+		mv_ddr_training_stage_set(SET_TARGET_FREQ);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("SET_TARGET_FREQ_MASK_BIT %d\n",
 				   freq_tbl[tm->
@@ -2483,7 +2625,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & WRITE_LEVELING_TF_MASK_BIT) {
-		training_stage = WRITE_LEVELING_TF;
+		mv_ddr_training_stage_set(WRITE_LEVELING_TF);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("WRITE_LEVELING_TF_MASK_BIT\n"));
 		ret = ddr3_tip_dynamic_write_leveling(dev_num, 0);
@@ -2498,7 +2640,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & LOAD_PATTERN_HIGH_MASK_BIT) {
-		training_stage = LOAD_PATTERN_HIGH;
+		mv_ddr_training_stage_set(LOAD_PATTERN_HIGH);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("LOAD_PATTERN_HIGH\n"));
 		ret = ddr3_tip_load_all_pattern_to_mem(dev_num);
 		if (is_reg_dump != 0)
@@ -2512,7 +2654,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & READ_LEVELING_TF_MASK_BIT) {
-		training_stage = READ_LEVELING_TF;
+		mv_ddr_training_stage_set(READ_LEVELING_TF);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("READ_LEVELING_TF_MASK_BIT\n"));
 		ret = ddr3_tip_dynamic_read_leveling(dev_num, tm->
@@ -2529,7 +2671,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & RL_DQS_BURST_MASK_BIT) {
-		training_stage = READ_LEVELING_TF;
+		mv_ddr_training_stage_set(READ_LEVELING_TF);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 				  ("RL_DQS_BURST_MASK_BIT\n"));
 		ret = mv_ddr_rl_dqs_burst(0, 0, tm->interface_params[0].memory_freq);
@@ -2550,7 +2692,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & VREF_CALIBRATION_MASK_BIT) {
-			training_stage = VREF_CALIBRATION;
+			mv_ddr_training_stage_set(VREF_CALIBRATION);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("VREF\n"));
 			ret = ddr3_tip_vref(dev_num);
 			if (is_reg_dump != 0) {
@@ -2571,7 +2713,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & CENTRALIZATION_RX_MASK_BIT) {
-			training_stage = CENTRALIZATION_RX;
+			mv_ddr_training_stage_set(CENTRALIZATION_RX);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("CENTRALIZATION_RX_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2593,7 +2735,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & WRITE_LEVELING_SUPP_TF_MASK_BIT) {
-			training_stage = WRITE_LEVELING_SUPP_TF;
+			mv_ddr_training_stage_set(WRITE_LEVELING_SUPP_TF);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("WRITE_LEVELING_SUPP_TF_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2620,7 +2762,7 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 #if !defined(CONFIG_DDR4)
 	for (effective_cs = 0; effective_cs < max_cs; effective_cs++) {
 		if (mask_tune_func & CENTRALIZATION_TX_MASK_BIT) {
-			training_stage = CENTRALIZATION_TX;
+			mv_ddr_training_stage_set(CENTRALIZATION_TX);
 			DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
 					  ("CENTRALIZATION_TX_MASK_BIT CS #%d\n",
 					   effective_cs));
@@ -2644,6 +2786,10 @@ static int ddr3_tip_ddr3_training_main_flow(u32 dev_num)
 	/* restore register values */
 	CHECK_STATUS(ddr3_tip_restore_dunit_regs(dev_num));
 
+#if defined(MV_DDR_SNAPSHOT)
+	CHECK_STATUS(mv_ddr_snapshot_save(dev_num));
+#endif /* MV_DDR_SNAPSHOT */
+
 	if (is_reg_dump != 0)
 		ddr3_tip_reg_dump(dev_num);
 
@@ -2659,14 +2805,36 @@ static int ddr3_tip_ddr3_auto_tune(u32 dev_num)
 	u32 if_id, stage;
 	int is_if_fail = 0, is_auto_tune_fail = 0;
 
-	training_stage = INIT_CONTROLLER;
+	mv_ddr_training_stage_set(INIT_CONTROLLER);
 
 	for (if_id = 0; if_id <= MAX_INTERFACE_NUM - 1; if_id++) {
 		for (stage = 0; stage < MAX_STAGE_LIMIT; stage++)
 			training_result[stage][if_id] = NO_TEST_DONE;
 	}
 
+#if defined(MV_DDR_PROF)
+	mv_ddr_prof_start();
+#endif /* MV_DDR_PROF */
+#if defined(MV_DDR_SHADOW)
+	mv_ddr_shadow_start();
+#endif /* MV_DDR_SHADOW */
+#if defined(MV_DDR_PHY_CACHE)
+	mv_ddr_phy_cache_start();
+#endif /* MV_DDR_PHY_CACHE */
 	status = ddr3_tip_ddr3_training_main_flow(dev_num);
+#if defined(MV_DDR_PHY_CACHE)
+	mv_ddr_phy_cache_stop();
+	mv_ddr_phy_cache_stats_print();
+#endif /* MV_DDR_PHY_CACHE */
+#if defined(MV_DDR_SHADOW)
+	mv_ddr_shadow_stop();
+	mv_ddr_shadow_stats_print();
+#endif /* MV_DDR_SHADOW */
+#if defined(MV_DDR_PROF)
+	mv_ddr_prof_stop();
+	mv_ddr_prof_print();
+	mv_ddr_wait_stats_print();
+#endif /* MV_DDR_PROF */
 
 	/* activate XSB test */
 	if (xsb_validate_type != 0) {
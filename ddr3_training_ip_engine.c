@@ -1069,9 +1069,7 @@ int ddr3_tip_load_pattern_to_mem(u32 dev_num, enum hws_pattern pattern)
 			      ODPG_DATA_CTRL_REG, (u32)(0x1 << 31),
 			      (u32)(0x1 << 31)));
 	}
-	mdelay(1);
-
-	if (mv_ddr_is_odpg_done(MAX_POLLING_ITERATIONS) != MV_OK)
+	if (mv_ddr_wait_odpg_done(MV_DDR_WAIT_ODPG_DONE, MV_DDR_ODPG_SETTLE_US) != MV_OK)
 		return MV_FAIL;
 
 	/* Disable ODPG and stop write to memory */
@@ -1090,8 +1088,8 @@ int ddr3_tip_load_pattern_to_mem(u32 dev_num, enum hws_pattern pattern)
 			     (dev_num, ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE,
 			      SDRAM_ODT_CTRL_HIGH_REG, 0x0, 0xf));
 	}
-	/* temporary added */
-	mdelay(1);
+	/* no completion indication for the odpg returning to default */
+	mv_ddr_wait_settle(MV_DDR_WAIT_ODPG_IDLE, MV_DDR_ODPG_IDLE_SETTLE_US);
 
 	return MV_OK;
 }
@@ -121,6 +121,11 @@
 #define MV_WRITE_PROTECT (0x22)	/* Write protected                       */
 #define MV_INVALID	(int)(-1)
 
+/* free running time base, in microseconds */
+#define mv_ddr_time_us()	((u32)timer_get_us())
+#define mv_ddr_time_ticks()	mv_ddr_time_us()
+#define mv_ddr_time_ticks_hz()	1000000
+
 /*
  * Accessor functions for the registers
  */
@@ -36,6 +36,8 @@ static inline uint64_t mmio_read_64(uintptr_t addr)
 
 /* uboot/tools/marvell/bin_hdr/platform/drivers/mv_time.c */
 void mdelay(unsigned long);
+void __udelay(unsigned long);
+#define udelay __udelay
 
 /* TODO: Check if LE/BE support is needed */
 #define MV_MEMIO_LE32_WRITE2(data,addr) \
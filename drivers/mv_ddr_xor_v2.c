@@ -6,6 +6,7 @@
 #include "mv_ddr_atf_wrapper.h"
 #endif
 
+#include "mv_ddr_common.h"
 #include "mv_ddr_xor_v2.h"
 
 /* dma engine registers */
@@ -81,11 +82,17 @@
  * to support a few dma engines operation
  */
 #define MV_XOR_V2_MAX_DESC_NUM			128
+#if ((MV_XOR_V2_MAX_DESC_NUM) > (MV_DDR_DMA_FAIL_MAP_WORDS) * 32)
+#error "dma failed descriptors bitmap is too small"
+#endif
 
 /* dma engine base address */
 #define MV_XOR_BASE		0x00400000
 #define MV_XOR_ENGINE(n)	(MV_XOR_BASE + (n) * 0x20000)
-#define MV_XOR_ENGINE_NUM	4
+#define MV_XOR_ENGINE_NUM	MV_DDR_DMA_ENG_NUM
+
+/* time w/o a descriptor completed, after which a dma engine is considered stuck, in microseconds */
+#define MV_XOR_V2_TIMEOUT_US		5000000
 
 #define MV_XOR_MAX_BURST_SIZE		4	/* 256B read or write transfers */
 #define MV_XOR_MAX_BURST_SIZE_MASK	0xff
@@ -151,6 +158,26 @@ enum {
 /* locate dma descriptors queue in sram with 256B alignment per hw requirement */
 static struct mv_xor_v2_hw_desc qmem[MV_XOR_ENGINE_NUM][MV_XOR_V2_MAX_DESC_NUM] __aligned(0x100);
 
+/* dma session; engines and descriptors queues stay initialized between open and close */
+static struct {
+	u32 dma_num;				/* engines in use; 0 - no open session */
+	u32 wr_idx[MV_XOR_ENGINE_NUM];		/* next descriptor to prepare */
+	u32 pending[MV_XOR_ENGINE_NUM];		/* descriptors enqueued and not yet waited for */
+	u32 crc[MV_XOR_ENGINE_NUM];		/* golden crc32 of pending crc compare descriptors */
+} session;
+
+/* background memset; a region's chunks follow the previous region's ones */
+static struct {
+	u32 rgn_num;					/* 0 - not started */
+	u32 in_flight;					/* started and not yet waited for */
+	u32 fail;
+	uint64_t start[MV_DDR_DMA_MEMSET_RGN_MAX];
+	uint64_t size[MV_DDR_DMA_MEMSET_RGN_MAX];
+	u32 first_chunk[MV_DDR_DMA_MEMSET_RGN_MAX];	/* index of a region's first chunk */
+	u32 chunk_num;
+	uint64_t chunk_size;
+} bg_memset;
+
 static void mv_xor_v2_init(u32 xor_id)
 {
 	u32 reg_val;
@@ -212,43 +239,49 @@ static void mv_xor_v2_init(u32 xor_id)
 	reg_write(xor_base + DMA_DESQ_STOP_OFF, DMA_DESQ_STOP_QUEUE_DIS_ENA << DMA_DESQ_STOP_QUEUE_DIS_OFFS);
 }
 
+/*
+ * prepare a descriptor in a queue cleared on session open;
+ * desc_id and crc32_result are left as is, the fields that change are written
+ */
 static void mv_xor_v2_desc_prep(u32 xor_id, u32 desc_id, enum mv_xor_v2_desc_op_mode op_mode,
 				uint64_t src, uint64_t dst, uint64_t size, uint64_t data)
 {
 	struct mv_xor_v2_hw_desc *desc = &qmem[xor_id][desc_id];
-
-	memset((void *)desc, 0, sizeof(*desc));
-	desc->desc_id = desc_id;
-	desc->buff_size = size;
+	u32 desc_ctrl;
 
 	switch (op_mode) {
 	case DESC_OP_MODE_MEMSET:
-		desc->desc_ctrl = DESC_OP_MODE_MEMSET << DESC_OP_MODE_SHIFT;
-		desc->fill_pattern_src_addr_lo = (u32)data;
-		desc->fill_pattern_src_addr_hi = (u32)(data >> 32);
-		desc->fill_pattern_dst_addr_lo = (u32)dst;
-		desc->fill_pattern_dst_addr_hi = (u32)(dst >> 32);
+		desc_ctrl = DESC_OP_MODE_MEMSET << DESC_OP_MODE_SHIFT;
+		src = data;
 		break;
 	case DESC_OP_MODE_MEMCPY:
-		desc->desc_ctrl = DESC_OP_MODE_MEMCPY << DESC_OP_MODE_SHIFT;
-		desc->fill_pattern_src_addr_lo = (u32)src;
-		desc->fill_pattern_src_addr_hi = (u32)(src >> 32);
-		desc->fill_pattern_dst_addr_lo = (u32)dst;
-		desc->fill_pattern_dst_addr_hi = (u32)(dst >> 32);
+		desc_ctrl = DESC_OP_MODE_MEMCPY << DESC_OP_MODE_SHIFT;
 		break;
 	case DESC_OP_MODE_MEMCMP:
-		desc->desc_ctrl = (DESC_OP_MODE_MEMCMP << DESC_OP_MODE_SHIFT) |
-				  (DESC_BYTE_CMP_CRC_FIRST_ENA << DESC_BYTE_CMP_CRC_FIRST_SHIFT) |
-				  (DESC_BYTE_CMP_CRC_LAST_ENA << DESC_BYTE_CMP_CRC_LAST_SHIFT);
-		desc->fill_pattern_src_addr_lo = (u32)src;
-		desc->fill_pattern_src_addr_hi = (u32)(src >> 32);
-		desc->fill_pattern_dst_addr_lo = (u32)dst;
-		desc->fill_pattern_dst_addr_hi = (u32)(dst >> 32);
+		desc_ctrl = (DESC_OP_MODE_MEMCMP << DESC_OP_MODE_SHIFT) |
+			    (DESC_BYTE_CMP_CRC_FIRST_ENA << DESC_BYTE_CMP_CRC_FIRST_SHIFT) |
+			    (DESC_BYTE_CMP_CRC_LAST_ENA << DESC_BYTE_CMP_CRC_LAST_SHIFT);
+		break;
+	case DESC_OP_MODE_CRC32:
+		/* a single buffer crc; no destination */
+		desc_ctrl = (DESC_OP_MODE_CRC32 << DESC_OP_MODE_SHIFT) |
+			    (DESC_BYTE_CMP_CRC_FIRST_ENA << DESC_BYTE_CMP_CRC_FIRST_SHIFT) |
+			    (DESC_BYTE_CMP_CRC_LAST_ENA << DESC_BYTE_CMP_CRC_LAST_SHIFT);
+		dst = 0;
 		break;
 	default:
 		printf("mv_ddr: dma: unsupported operation mode\n");
 		return;
 	}
+
+	/* clear status of previous operation in this descriptor */
+	desc->flags = 0;
+	desc->desc_ctrl = desc_ctrl;
+	desc->buff_size = size;
+	desc->fill_pattern_src_addr_lo = (u32)src;
+	desc->fill_pattern_src_addr_hi = (u32)(src >> 32);
+	desc->fill_pattern_dst_addr_lo = (u32)dst;
+	desc->fill_pattern_dst_addr_hi = (u32)(dst >> 32);
 }
 
 static void mv_xor_v2_enqueue(u32 xor_id, u32 desc_num)
@@ -267,6 +300,14 @@ static u32 mv_xor_v2_done(u32 xor_id)
 	return reg_read(xor_base + DMA_DESQ_DONE_OFF) & DMA_DESQ_DONE_PENDING_MASK;
 }
 
+static void mv_xor_v2_dealloc(u32 xor_id, u32 desc_num)
+{
+	u32 xor_base = MV_XOR_ENGINE(xor_id);
+
+	/* release a number of completed descriptors back to the descriptors queue */
+	reg_write(xor_base + DMA_DESQ_DEALLOC_OFF, desc_num);
+}
+
 static void mv_xor_v2_finish(u32 xor_id)
 {
 	u32 xor_base = MV_XOR_ENGINE(xor_id);
@@ -292,149 +333,604 @@ static u32 mv_xor_v2_memcmp_status_get(u32 xor_id, u32 desc_id)
 	return (desc->flags >> DESC_BYTE_CMP_STATUS_OFFS) & DESC_BYTE_CMP_STATUS_MASK;
 }
 
-/* mv_ddr dma api */
-int mv_ddr_dma_memset(uint64_t start_addr, uint64_t size, uint64_t data)
+static u32 mv_xor_v2_crc_get(u32 xor_id, u32 desc_id)
+{
+	struct mv_xor_v2_hw_desc *desc = &qmem[xor_id][desc_id];
+
+	return desc->crc32_result;
+}
+
+static u32 mv_xor_v2_op_mode_get(u32 xor_id, u32 desc_id)
+{
+	struct mv_xor_v2_hw_desc *desc = &qmem[xor_id][desc_id];
+
+	return desc->desc_ctrl >> DESC_OP_MODE_SHIFT;
+}
+
+/* prepare a descriptor at the session's write index of a dma engine */
+static void mv_xor_v2_session_add(u32 xor_id, enum mv_xor_v2_desc_op_mode op_mode,
+				  uint64_t src, uint64_t dst, uint64_t size, uint64_t data)
 {
-	uint64_t start = start_addr;
-	uint64_t end = start_addr + size;
-	uint64_t buffer_size;
-	u32 desc_id = 0;
+	u32 desc_id = session.wr_idx[xor_id];
+
+	mv_xor_v2_desc_prep(xor_id, desc_id, op_mode, src, dst, size, data);
+	session.wr_idx[xor_id] = (desc_id + 1) % MV_XOR_V2_MAX_DESC_NUM;
+	session.pending[xor_id]++;
+}
 
-	/* initialize dma descriptors queue memory region */
-	memset((void *)qmem, 0, sizeof(qmem));
+/* check that a batch fits in the open dma session */
+static int mv_xor_v2_session_check(u32 dma_num, u32 desc_num)
+{
+	u32 dma_id;
 
-	/* initialize dma engine */
-	mv_xor_v2_init(DMA_ENG_0);
+	if (session.dma_num == 0) {
+		printf("mv_ddr: error: no open dma session\n");
+		return 1; /* fail */
+	}
 
-	while (start < end) {
-		if (desc_id >= MV_XOR_V2_MAX_DESC_NUM) {
-			/* increase dma max desc number if required */
+	if (dma_num > session.dma_num) {
+		printf("mv_ddr: error: dma session engines number limit (%d) reached\n",
+		       session.dma_num);
+		return 1; /* fail */
+	}
+
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		if (session.pending[dma_id] + desc_num > MV_XOR_V2_MAX_DESC_NUM) {
+			/* increase dma max desc number or wait for submitted batches if required */
 			printf("mv_ddr: error: dma desq size limit (%d) reached\n",
 			       MV_XOR_V2_MAX_DESC_NUM);
 			return 1; /* fail */
 		}
-		buffer_size = end - start;
-		if (buffer_size > MV_XOR_MAX_TRANSFER_SIZE)
-			buffer_size = MV_XOR_MAX_TRANSFER_SIZE;
-		mv_xor_v2_desc_prep(DMA_ENG_0, desc_id, DESC_OP_MODE_MEMSET,
-				    0, start, buffer_size, data);
-		mv_xor_v2_enqueue(DMA_ENG_0, 1);
-		desc_id++;
-		start += buffer_size;
 	}
 
-	/* wait for transfer completion */
-	while (mv_xor_v2_done(DMA_ENG_0) != desc_id)
-		;
+	return 0; /* pass */
+}
+
+/* src_seq - consecutive source regions, as destination ones; else a single source region */
+static int mv_xor_v2_session_submit(enum mv_xor_v2_desc_op_mode op_mode, uint64_t *src, uint64_t *dst,
+				    uint64_t size, u32 dma_num, u32 desc_num, int src_seq)
+{
+	u32 dma_id, desc_id;
+
+	if (mv_xor_v2_session_check(dma_num, desc_num))
+		return 1; /* fail */
+
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		for (desc_id = 0; desc_id < desc_num; desc_id++) {
+			/* prepare dma hw descriptor; crc has no destination */
+			mv_xor_v2_session_add(dma_id, op_mode,
+					      src[dma_id] + (src_seq ? size * desc_id : 0),
+					      dst ? dst[dma_id] + size * desc_id : 0, size, 0);
+		}
+	}
+	/* enqueue dma descriptors to start processing */
+	for (dma_id = 0; dma_id < dma_num; dma_id++)
+		mv_xor_v2_enqueue(dma_id, desc_num);
+
+	return 0; /* pass */
+}
 
-	/* disable dma engine */
-	mv_xor_v2_finish(DMA_ENG_0);
+/* wait for transfer completion; returns non-zero if an engine made no progress within timeout */
+static int mv_xor_v2_session_sync(void)
+{
+	u32 dma_id, done, last_done, start;
+
+	for (dma_id = 0; dma_id < session.dma_num; dma_id++) {
+		last_done = 0;
+		start = mv_ddr_time_us();
+		while ((done = mv_xor_v2_done(dma_id)) != session.pending[dma_id]) {
+			if (done != last_done) {
+				last_done = done;
+				start = mv_ddr_time_us();
+			} else if (mv_ddr_time_us() - start > MV_XOR_V2_TIMEOUT_US) {
+				printf("mv_ddr: error: dma engine %d timeout (%d of %d done)\n",
+				       dma_id, done, session.pending[dma_id]);
+				return 1; /* fail */
+			}
+		}
+	}
 
 	return 0; /* pass */
 }
 
-int mv_ddr_dma_memcpy(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+/* check that the open dma session has enough engines and none has pending descriptors */
+static int mv_xor_v2_session_idle(u32 dma_num)
+{
+	u32 dma_id;
+
+	if (session.dma_num == 0 || dma_num > session.dma_num) {
+		printf("mv_ddr: error: no open dma session for %d engines\n", dma_num);
+		return 1; /* fail */
+	}
+
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		if (session.pending[dma_id]) {
+			printf("mv_ddr: error: dma session has pending descriptors\n");
+			return 1; /* fail */
+		}
+	}
+
+	return 0; /* pass */
+}
+
+/* disable dma engines; queue reset drops descriptors left after a timeout */
+static void mv_xor_v2_session_end(void)
+{
+	u32 dma_id;
+
+	for (dma_id = 0; dma_id < session.dma_num; dma_id++) {
+		mv_xor_v2_finish(dma_id);
+		session.pending[dma_id] = 0;
+	}
+
+	session.dma_num = 0;
+}
+
+/* mv_ddr dma api */
+int mv_ddr_dma_session_open(u32 dma_num)
 {
-	uint64_t desc_dst;
 	u32 dma_id, desc_id;
 
-	if (dma_num > MV_XOR_ENGINE_NUM) {
-		printf("mv_ddr: error: dma engines number limit (%d) reached\n",
-		       MV_XOR_ENGINE_NUM);
+	if (session.dma_num) {
+		printf("mv_ddr: error: dma session already open\n");
 		return 1; /* fail */
 	}
 
-	if (desc_num > MV_XOR_V2_MAX_DESC_NUM) {
-		/* increase dma max desc number if required */
-		printf("mv_ddr: error: dma desq size limit (%d) reached\n",
-		       MV_XOR_V2_MAX_DESC_NUM);
+	if (dma_num == 0 || dma_num > MV_XOR_ENGINE_NUM) {
+		printf("mv_ddr: error: dma engines number limit (%d) reached\n",
+		       MV_XOR_ENGINE_NUM);
 		return 1; /* fail */
 	}
 
-	/* initialize dma descriptors queue memory region */
-	memset((void *)qmem, 0, sizeof(qmem));
+	/* initialize dma descriptors queues memory region */
+	memset((void *)qmem, 0, dma_num * sizeof(qmem[0]));
 
 	/* initialize dma engines */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		for (desc_id = 0; desc_id < MV_XOR_V2_MAX_DESC_NUM; desc_id++)
+			qmem[dma_id][desc_id].desc_id = desc_id;
+		session.wr_idx[dma_id] = 0;
+		session.pending[dma_id] = 0;
 		mv_xor_v2_init(dma_id);
+	}
+	session.dma_num = dma_num;
+
+	return 0; /* pass */
+}
+
+int mv_ddr_dma_session_memcpy(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+{
+	return mv_xor_v2_session_submit(DESC_OP_MODE_MEMCPY, src, dst, size, dma_num, desc_num, 0);
+}
+
+int mv_ddr_dma_session_memcmp(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+{
+	return mv_xor_v2_session_submit(DESC_OP_MODE_MEMCMP, src, dst, size, dma_num, desc_num, 0);
+}
+
+int mv_ddr_dma_session_memcmp_seq(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+{
+	return mv_xor_v2_session_submit(DESC_OP_MODE_MEMCMP, src, dst, size, dma_num, desc_num, 1);
+}
+
+int mv_ddr_dma_session_memset(uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num,
+			      uint64_t *data, uint64_t data_step)
+{
+	u32 dma_id, desc_id;
+
+	if (mv_xor_v2_session_check(dma_num, desc_num))
+		return 1; /* fail */
 
 	for (dma_id = 0; dma_id < dma_num; dma_id++) {
-		for (desc_id = 0; desc_id < desc_num; desc_id++) {
-			desc_dst = dst[dma_id] + size * desc_id;
-			/* prepare dma hw descriptor */
-			mv_xor_v2_desc_prep(dma_id, desc_id, DESC_OP_MODE_MEMCPY,
-					    src[dma_id], desc_dst, size, 0);
-		}
-	}
-	/* enqueue dma descriptors to start processing */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
+		for (desc_id = 0; desc_id < desc_num; desc_id++)
+			mv_xor_v2_session_add(dma_id, DESC_OP_MODE_MEMSET, 0, dst[dma_id] + size * desc_id,
+					      size, data[dma_id] + data_step * desc_id);
 		mv_xor_v2_enqueue(dma_id, desc_num);
+	}
 
-	/* wait for transfer completion */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		while (mv_xor_v2_done(dma_id) != desc_num)
-			;
+	return 0; /* pass */
+}
 
-	/* disable dma engines */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		mv_xor_v2_finish(dma_id);
+int mv_ddr_dma_session_crc(uint64_t *src, uint64_t size, u32 dma_num, u32 *crc)
+{
+	u32 dma_id, desc_id;
+
+	if (mv_xor_v2_session_idle(dma_num))
+		return 1; /* fail */
+
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		mv_xor_v2_session_add(dma_id, DESC_OP_MODE_CRC32, src[dma_id], 0, size, 0);
+		mv_xor_v2_enqueue(dma_id, 1);
+	}
+
+	if (mv_xor_v2_session_sync())
+		return 1; /* fail */
+
+	for (dma_id = 0; dma_id < dma_num; dma_id++) {
+		desc_id = (session.wr_idx[dma_id] + MV_XOR_V2_MAX_DESC_NUM - 1) % MV_XOR_V2_MAX_DESC_NUM;
+		crc[dma_id] = mv_xor_v2_crc_get(dma_id, desc_id);
+		mv_xor_v2_dealloc(dma_id, 1);
+		session.pending[dma_id] = 0;
+	}
 
 	return 0; /* pass */
 }
 
-int mv_ddr_dma_memcmp(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+int mv_ddr_dma_session_crccmp(uint64_t *src, uint64_t size, u32 dma_num, u32 desc_num, u32 *crc)
 {
-	uint64_t desc_dst;
-	u32 dma_id, desc_id;
-	int fail_cnt = 0;
+	u32 dma_id;
 
-	if (dma_num > MV_XOR_ENGINE_NUM) {
-		printf("mv_ddr: error: dma engines number limit (%d) reached\n",
-		       MV_XOR_ENGINE_NUM);
-		return -1; /* fail */
+	if (session.dma_num == 0 || dma_num > session.dma_num) {
+		printf("mv_ddr: error: no open dma session for %d engines\n", dma_num);
+		return 1; /* fail */
 	}
 
-	if (desc_num > MV_XOR_V2_MAX_DESC_NUM) {
-		/* increase dma max desc number if required */
-		printf("mv_ddr: error: dma desq size limit (%d) reached\n",
-		       MV_XOR_V2_MAX_DESC_NUM);
+	for (dma_id = 0; dma_id < dma_num; dma_id++)
+		session.crc[dma_id] = crc[dma_id];
+
+	return mv_xor_v2_session_submit(DESC_OP_MODE_CRC32, src, NULL, size, dma_num, desc_num, 1);
+}
+
+int mv_ddr_dma_session_wait(void)
+{
+	return mv_ddr_dma_session_wait_map(NULL);
+}
+
+int mv_ddr_dma_session_wait_map(u32 fail_map[][MV_DDR_DMA_FAIL_MAP_WORDS])
+{
+	u32 dma_id, desc_id, i;
+	int fail_cnt = 0, fail;
+
+	if (mv_xor_v2_session_sync())
 		return -1; /* fail */
+
+	for (dma_id = 0; dma_id < session.dma_num; dma_id++) {
+		if (fail_map)
+			memset(fail_map[dma_id], 0, sizeof(fail_map[dma_id]));
+		/* the waited for descriptors end at the write index and may wrap around the queue */
+		desc_id = (session.wr_idx[dma_id] + MV_XOR_V2_MAX_DESC_NUM - session.pending[dma_id]) %
+			  MV_XOR_V2_MAX_DESC_NUM;
+		for (i = 0; i < session.pending[dma_id]; i++) {
+			switch (mv_xor_v2_op_mode_get(dma_id, desc_id)) {
+			case DESC_OP_MODE_MEMCMP:
+				fail = (mv_xor_v2_memcmp_status_get(dma_id, desc_id) == DESC_BYTE_CMP_STATUS_FAIL);
+				break;
+			case DESC_OP_MODE_CRC32:
+				fail = (mv_xor_v2_crc_get(dma_id, desc_id) != session.crc[dma_id]);
+				break;
+			default:
+				fail = 0;
+				break;
+			}
+			if (fail) {
+				fail_cnt++; /* count a number of failures */
+				if (fail_map)
+					fail_map[dma_id][i / 32] |= 1u << (i % 32);
+			}
+			desc_id = (desc_id + 1) % MV_XOR_V2_MAX_DESC_NUM;
+		}
+
+		mv_xor_v2_dealloc(dma_id, session.pending[dma_id]);
+		session.pending[dma_id] = 0;
 	}
 
-	/* initialize dma descriptors queue memory region */
-	memset((void *)qmem, 0, sizeof(qmem));
+	return fail_cnt;
+}
 
-	/* initialize dma engines */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		mv_xor_v2_init(dma_id);
+void mv_ddr_dma_session_close(void)
+{
+	mv_ddr_dma_session_wait();
+	mv_xor_v2_session_end();
+}
+
+int mv_ddr_dma_golden_load(const uint64_t *unit, uint64_t *dst, uint64_t size, u32 dma_num,
+			   u32 desc_num, struct mv_ddr_dma_golden *golden)
+{
+	uint64_t addr, offs;
+	u32 dma_id, desc_id, crc;
 
 	for (dma_id = 0; dma_id < dma_num; dma_id++) {
-		for (desc_id = 0; desc_id < desc_num; desc_id++) {
-			desc_dst = dst[dma_id] + size * desc_id;
-			/* prepare dma hw descriptor */
-			mv_xor_v2_desc_prep(dma_id, desc_id, DESC_OP_MODE_MEMCMP,
-					    src[dma_id], desc_dst, size, 0);
+		for (desc_id = 0, addr = dst[dma_id]; desc_id < desc_num; desc_id++) {
+			for (offs = 0; offs < size; offs += sizeof(unit[0]), addr += sizeof(unit[0]))
+				writeq(addr, unit[offs / sizeof(unit[0])]);
 		}
 	}
-	/* enqueue dma descriptors to start processing */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		mv_xor_v2_enqueue(dma_id, desc_num);
 
-	/* wait for transfer completion */
+	crc = mv_ddr_crc32c(0, (const unsigned char *)unit, size);
 	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		while (mv_xor_v2_done(dma_id) != desc_num)
-			;
+		golden->crc[dma_id] = crc;
+	golden->unit = unit;
+	golden->dirty = 0;
 
-	/* disable dma engines */
-	for (dma_id = 0; dma_id < dma_num; dma_id++)
-		mv_xor_v2_finish(dma_id);
+	return 0; /* pass */
+}
+
+int mv_ddr_dma_session_golden_check(uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num,
+				    struct mv_ddr_dma_golden *golden)
+{
+	if (golden->dirty)
+		mv_ddr_dma_golden_load(golden->unit, dst, size, dma_num, desc_num, golden);
+
+	if (mv_ddr_dma_session_crccmp(dst, size, dma_num, desc_num, golden->crc))
+		return -1; /* fail */
+
+	return mv_ddr_dma_session_wait();
+}
+
+int mv_ddr_dma_memset(uint64_t start_addr, uint64_t size, uint64_t data)
+{
+	uint64_t start[MV_XOR_ENGINE_NUM], end[MV_XOR_ENGINE_NUM];
+	uint64_t stripe, buffer_size;
+	int own_session = (session.dma_num == 0);
+	u32 dma_num = own_session ? MV_XOR_ENGINE_NUM : session.dma_num;
+	u32 dma_id, done, desc_num, busy, last;
+	int ret = 0;
+
+	/* split memory region into an address stripe per dma engine, aligned to max burst */
+	stripe = (size / dma_num) & ~(uint64_t)MV_XOR_MAX_BURST_SIZE_MASK;
+	if (stripe == 0) {
+		dma_num = 1;
+		stripe = size;
+	}
+
+	if (own_session) {
+		if (mv_ddr_dma_session_open(dma_num))
+			return 1; /* fail */
+	} else if (mv_xor_v2_session_idle(dma_num)) {
+		return 1; /* fail */
+	}
 
 	for (dma_id = 0; dma_id < dma_num; dma_id++) {
-		for (desc_id = 0; desc_id < desc_num; desc_id++) {
-			if (mv_xor_v2_memcmp_status_get(dma_id, desc_id) == 0)
-				fail_cnt++; /* count a number of failures */
+		start[dma_id] = start_addr + stripe * dma_id;
+		end[dma_id] = (dma_id == dma_num - 1) ? start_addr + size : start[dma_id] + stripe;
+	}
+
+	last = mv_ddr_time_us();
+	do {
+		busy = 0;
+		for (dma_id = 0; dma_id < dma_num; dma_id++) {
+			/* release completed descriptors, so the queue wraps around for any region size */
+			done = mv_xor_v2_done(dma_id);
+			if (done) {
+				mv_xor_v2_dealloc(dma_id, done);
+				session.pending[dma_id] -= done;
+				last = mv_ddr_time_us();
+			}
+
+			/* refill the queue */
+			for (desc_num = 0; start[dma_id] < end[dma_id] &&
+			     session.pending[dma_id] < MV_XOR_V2_MAX_DESC_NUM; desc_num++) {
+				buffer_size = end[dma_id] - start[dma_id];
+				if (buffer_size > MV_XOR_MAX_TRANSFER_SIZE)
+					buffer_size = MV_XOR_MAX_TRANSFER_SIZE;
+				mv_xor_v2_session_add(dma_id, DESC_OP_MODE_MEMSET, 0, start[dma_id],
+						      buffer_size, data);
+				start[dma_id] += buffer_size;
+			}
+			if (desc_num)
+				mv_xor_v2_enqueue(dma_id, desc_num);
+
+			if (session.pending[dma_id])
+				busy = 1;
+		}
+
+		if (busy && mv_ddr_time_us() - last > MV_XOR_V2_TIMEOUT_US) {
+			printf("mv_ddr: error: dma memset timeout at 0x%llx\n",
+			       (unsigned long long)start_addr);
+			ret = 1; /* fail */
+			break;
+		}
+	} while (busy);
+
+	if (own_session)
+		mv_ddr_dma_session_close();
+
+	return ret;
+}
+
+int mv_ddr_dma_memset_start(uint64_t *start_addr, uint64_t *size, u32 rgn_num, uint64_t data)
+{
+	uint64_t total_size = 0, chunk_size, addr, end, buffer_size;
+	u32 rgn_id, dma_id, chunk_id = 0, chunk_max;
+
+	if (bg_memset.in_flight) {
+		printf("mv_ddr: error: dma memset already started\n");
+		return 1; /* fail */
+	}
+
+	if (rgn_num == 0 || rgn_num > MV_DDR_DMA_MEMSET_RGN_MAX) {
+		printf("mv_ddr: error: dma memset regions number limit (%d) reached\n",
+		       MV_DDR_DMA_MEMSET_RGN_MAX);
+		return 1; /* fail */
+	}
+
+	for (rgn_id = 0; rgn_id < rgn_num; rgn_id++)
+		total_size += size[rgn_id];
+
+	/*
+	 * all chunks fit in the descriptors queues at once;
+	 * a descriptor per region is spared for its last partial chunk
+	 */
+	chunk_max = MV_XOR_ENGINE_NUM * MV_XOR_V2_MAX_DESC_NUM - rgn_num;
+	chunk_size = (total_size + chunk_max - 1) / chunk_max;
+	chunk_size = (chunk_size + MV_XOR_MAX_BURST_SIZE_MASK) & ~(uint64_t)MV_XOR_MAX_BURST_SIZE_MASK;
+	if (chunk_size > MV_XOR_MAX_TRANSFER_SIZE) {
+		printf("mv_ddr: error: dma memset size limit reached\n");
+		return 1; /* fail */
+	}
+
+	if (mv_ddr_dma_session_open(MV_XOR_ENGINE_NUM))
+		return 1; /* fail */
+
+	for (rgn_id = 0; rgn_id < rgn_num; rgn_id++) {
+		bg_memset.start[rgn_id] = start_addr[rgn_id];
+		bg_memset.size[rgn_id] = size[rgn_id];
+		bg_memset.first_chunk[rgn_id] = chunk_id;
+		end = start_addr[rgn_id] + size[rgn_id];
+		for (addr = start_addr[rgn_id]; addr < end; addr += buffer_size, chunk_id++) {
+			buffer_size = (end - addr < chunk_size) ? end - addr : chunk_size;
+			mv_xor_v2_session_add(chunk_id % MV_XOR_ENGINE_NUM, DESC_OP_MODE_MEMSET,
+					      0, addr, buffer_size, data);
 		}
 	}
+	bg_memset.chunk_num = chunk_id;
+	bg_memset.chunk_size = chunk_size;
+	bg_memset.rgn_num = rgn_num;
+	bg_memset.in_flight = 1;
+	bg_memset.fail = 0;
+
+	/* enqueue dma descriptors to start processing */
+	for (dma_id = 0; dma_id < MV_XOR_ENGINE_NUM; dma_id++)
+		if (session.pending[dma_id])
+			mv_xor_v2_enqueue(dma_id, session.pending[dma_id]);
+
+	return 0; /* pass */
+}
+
+int mv_ddr_dma_memset_is_done(uint64_t addr, uint64_t size)
+{
+	u32 rgn_id, dma_id, chunk_id, next_chunk;
+	uint64_t done_size;
+
+	if (bg_memset.rgn_num == 0)
+		return 1; /* not started */
+
+	if (!bg_memset.in_flight)
+		return !bg_memset.fail;
+
+	/*
+	 * an engine completes its chunks in order, so the first chunk
+	 * not completed by any engine bounds the memory set so far
+	 */
+	next_chunk = bg_memset.chunk_num;
+	for (dma_id = 0; dma_id < session.dma_num; dma_id++) {
+		chunk_id = mv_xor_v2_done(dma_id) * session.dma_num + dma_id;
+		if (chunk_id < next_chunk)
+			next_chunk = chunk_id;
+	}
+
+	for (rgn_id = 0; rgn_id < bg_memset.rgn_num; rgn_id++) {
+		if (addr < bg_memset.start[rgn_id] ||
+		    addr + size > bg_memset.start[rgn_id] + bg_memset.size[rgn_id])
+			continue;
+		if (next_chunk <= bg_memset.first_chunk[rgn_id])
+			return 0;
+		done_size = (uint64_t)(next_chunk - bg_memset.first_chunk[rgn_id]) * bg_memset.chunk_size;
+		return addr + size <= bg_memset.start[rgn_id] + done_size;
+	}
+
+	/* outside of memset regions */
+	return 0;
+}
+
+int mv_ddr_dma_memset_wait(void)
+{
+	if (!bg_memset.in_flight)
+		return bg_memset.fail; /* not started or already waited for */
+
+	if (mv_xor_v2_session_sync()) {
+		printf("mv_ddr: error: dma memset timeout\n");
+		bg_memset.fail = 1;
+	}
+	mv_xor_v2_session_end();
+	bg_memset.in_flight = 0;
+
+	return bg_memset.fail;
+}
+
+/* background scrubbing size and start time */
+static uint64_t scrub_async_sz;
+static u32 scrub_async_start_us;
+
+/* decimal units: bytes per microsecond is MB/s */
+static void mv_ddr_dma_scrub_rate_print(uint64_t scrub_sz, u32 elapsed_us)
+{
+	if (elapsed_us)
+		printf("mv_ddr: scrubbed %d MB in %d ms, %d.%02d GB/s\n",
+		       (u32)(scrub_sz / 1000000), elapsed_us / 1000,
+		       (u32)(scrub_sz / elapsed_us / 1000), (u32)(scrub_sz / elapsed_us / 10 % 100));
+}
+
+int mv_ddr_dma_scrub(uint64_t *start_addr, uint64_t *size, u32 rgn_num)
+{
+	uint64_t scrub_sz = 0;
+	u32 rgn_id, start_us;
+	int ret = 0;
+
+	for (rgn_id = 0; rgn_id < rgn_num; rgn_id++)
+		scrub_sz += size[rgn_id];
+
+#if defined(MV_DDR_SCRUB_ASYNC)
+	/* a previous scrubbing, e.g. of another interface, holds the dma engines */
+	mv_ddr_dma_scrub_wait();
+
+	/* scrub in the background, low memory first; see mv_ddr_dma_memset_is_done() */
+	start_us = mv_ddr_time_us();
+	if (mv_ddr_dma_memset_start(start_addr, size, rgn_num, 0) == 0) {
+		printf("mv_ddr: scrubbing memory in the background...\n");
+		scrub_async_sz = scrub_sz;
+		scrub_async_start_us = start_us;
+		return 0; /* pass */
+	}
+#endif /* MV_DDR_SCRUB_ASYNC */
+
+	printf("mv_ddr: scrubbing memory...\n");
+	start_us = mv_ddr_time_us();
+	for (rgn_id = 0; rgn_id < rgn_num; rgn_id++)
+		if (mv_ddr_dma_memset(start_addr[rgn_id], size[rgn_id], 0))
+			ret = 1; /* fail */
+
+	mv_ddr_dma_scrub_rate_print(scrub_sz, mv_ddr_time_us() - start_us);
+
+	return ret;
+}
+
+int mv_ddr_dma_scrub_wait(void)
+{
+	int ret;
+
+	if (scrub_async_sz == 0)
+		return 0; /* not started or already waited for */
+
+	ret = mv_ddr_dma_memset_wait();
+	if (ret == 0)
+		mv_ddr_dma_scrub_rate_print(scrub_async_sz, mv_ddr_time_us() - scrub_async_start_us);
+	scrub_async_sz = 0;
+
+	return ret;
+}
+
+int mv_ddr_dma_memcpy(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+{
+	int own_session = (session.dma_num == 0);
+	int ret;
+
+	if (own_session && mv_ddr_dma_session_open(dma_num))
+		return 1; /* fail */
+
+	ret = mv_ddr_dma_session_memcpy(src, dst, size, dma_num, desc_num);
+	if (ret == 0 && mv_ddr_dma_session_wait() < 0)
+		ret = 1; /* fail */
+
+	if (own_session)
+		mv_ddr_dma_session_close();
+
+	return ret;
+}
+
+int mv_ddr_dma_memcmp(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num)
+{
+	int own_session = (session.dma_num == 0);
+	int fail_cnt = -1;
+
+	if (own_session && mv_ddr_dma_session_open(dma_num))
+		return -1; /* fail */
+
+	if (mv_ddr_dma_session_memcmp(src, dst, size, dma_num, desc_num) == 0)
+		fail_cnt = mv_ddr_dma_session_wait();
+
+	if (own_session)
+		mv_ddr_dma_session_close();
 
 	return fail_cnt;
 }
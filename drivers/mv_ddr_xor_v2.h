@@ -5,8 +5,13 @@
 #ifndef _MV_DDR_XOR_V2_H
 #define _MV_DDR_XOR_V2_H
 
+/* number of dma engines */
+#define MV_DDR_DMA_ENG_NUM	4
+
 /**
- * set memory region to data using dma
+ * set memory region to data using dma; the region is split into an address
+ * stripe per dma engine (all engines, or those of an open idle dma session)
+ * and descriptors queues are reused, so any region size is supported
  *
  * @param    start_addr	start address of memory region
  * @param    size	size of memory region
@@ -16,6 +21,62 @@
  */
 int mv_ddr_dma_memset(uint64_t start_addr, uint64_t size, uint64_t data);
 
+/* memory regions of a background memset */
+#define MV_DDR_DMA_MEMSET_RGN_MAX	2
+
+/**
+ * start setting memory regions to data in the background; the regions are
+ * split into chunks in address order, dealt round robin to all dma engines,
+ * and all of them are enqueued at once, so low memory is set first and the
+ * engines run w/o cpu attention; the engines stay in a dma session, and so
+ * do the descriptors queues in sram, until mv_ddr_dma_memset_wait()
+ *
+ * @param    start_addr	start addresses of memory regions
+ * @param    size	sizes of memory regions
+ * @param    rgn_num	number of memory regions, up to MV_DDR_DMA_MEMSET_RGN_MAX
+ * @param    data	data to be written
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_memset_start(uint64_t *start_addr, uint64_t *size, u32 rgn_num, uint64_t data);
+
+/**
+ * check whether a memory range is already set by the background memset
+ *
+ * @param    addr	start address of memory range
+ * @param    size	size of memory range
+ *
+ * @retval 1 set, or no background memset started
+ */
+int mv_ddr_dma_memset_is_done(uint64_t addr, uint64_t size);
+
+/**
+ * wait for completion of the background memset, if started, and close its dma session
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_memset_wait(void);
+
+/**
+ * scrub memory regions, i.e. set them to zero, and print the scrubbing rate;
+ * with MV_DDR_SCRUB_ASYNC, in the background (see mv_ddr_dma_memset_start)
+ * unless the dma engines are not available
+ *
+ * @param    start_addr	start addresses of memory regions
+ * @param    size	sizes of memory regions
+ * @param    rgn_num	number of memory regions, up to MV_DDR_DMA_MEMSET_RGN_MAX
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_scrub(uint64_t *start_addr, uint64_t *size, u32 rgn_num);
+
+/**
+ * wait for completion of the background scrubbing, if started
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_scrub_wait(void);
+
 /**
  * copy memory region from source to destination using a few dma engines
  *
@@ -42,4 +103,166 @@ int mv_ddr_dma_memcpy(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num,
  */
 int mv_ddr_dma_memcmp(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num);
 
+/**
+ * open a dma session: initialize dma engines and their descriptors queues once
+ * for a sequence of batches; mv_ddr_dma_memset/memcpy/memcmp called with the
+ * session open reuse it instead of initializing and disabling the engines
+ *
+ * @param    dma_num	number of dma engines to use
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_open(u32 dma_num);
+
+/**
+ * submit a copy batch to the open dma session; returns without waiting
+ *
+ * @param    src	start addresses of source memory regions per dma
+ * @param    dst	start addresses of destination memory regions per dma
+ * @param    size	size of memory region to copy
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    desc_num	number of descriptors per dma engine to use
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_memcpy(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num);
+
+/**
+ * submit a compare batch to the open dma session; returns without waiting,
+ * so wait for a copy batch before comparing its destination
+ *
+ * @param    src	start addresses of source memory regions per dma
+ * @param    dst	start addresses of destination memory regions per dma
+ * @param    size	size of memory region to compare
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    desc_num	number of descriptors per dma engine to use
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_memcmp(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num);
+
+/**
+ * submit a compare batch of consecutive source regions to the open dma session:
+ * the n-th source region of a dma engine is compared with its n-th destination one
+ *
+ * @param    src	start addresses of source memory regions per dma
+ * @param    dst	start addresses of destination memory regions per dma
+ * @param    size	size of each memory region
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    desc_num	number of descriptors (region pairs) per dma engine to use
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_memcmp_seq(uint64_t *src, uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num);
+
+/**
+ * submit a fill batch to the open dma session; returns without waiting;
+ * the n-th region of a dma engine is set to its data plus n times data_step,
+ * e.g. to its own address
+ *
+ * @param    dst	start addresses of memory regions per dma
+ * @param    size	size of each memory region
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    desc_num	number of descriptors (regions) per dma engine to use
+ * @param    data	data of the first region per dma
+ * @param    data_step	data increment per region
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_memset(uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num,
+			      uint64_t *data, uint64_t data_step);
+
+/**
+ * calculate crc32 of a memory region per dma engine in the open dma session,
+ * which must have no pending batches; blocks until done
+ *
+ * @param    src	start addresses of memory regions per dma
+ * @param    size	size of memory region
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    crc	crc32 per dma, returned
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_crc(uint64_t *src, uint64_t size, u32 dma_num, u32 *crc);
+
+/**
+ * submit a read-only check batch to the open dma session: crc32 of desc_num
+ * consecutive regions of size bytes per dma engine compared with a golden
+ * crc32 taken with mv_ddr_dma_session_crc() or mv_ddr_dma_golden_load(); one
+ * golden value per dma engine applies to all its pending check descriptors
+ *
+ * @param    src	start addresses of memory regions per dma
+ * @param    size	size of each memory region
+ * @param    dma_num	number of dma engines to use, up to the session's
+ * @param    desc_num	number of descriptors (regions) per dma engine to use
+ * @param    crc	golden crc32 per dma
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_session_crccmp(uint64_t *src, uint64_t size, u32 dma_num, u32 desc_num, u32 *crc);
+
+/**
+ * wait for completion of all batches submitted to the open dma session
+ *
+ * @retval   fail_cnt	number of comparison failures in submitted compare and check batches
+ *			or -1 if a dma engine timed out
+ */
+int mv_ddr_dma_session_wait(void);
+
+/* failed descriptors bitmap words per dma engine */
+#define MV_DDR_DMA_FAIL_MAP_WORDS	4
+
+/**
+ * wait like mv_ddr_dma_session_wait() and tell which descriptors failed
+ *
+ * @param    fail_map	per dma engine bitmap of failed descriptors, bit n for the n-th
+ *			descriptor submitted since the last wait; may be NULL
+ *
+ * @retval   fail_cnt	number of comparison failures or -1 if a dma engine timed out
+ */
+int mv_ddr_dma_session_wait_map(u32 fail_map[][MV_DDR_DMA_FAIL_MAP_WORDS]);
+
+/**
+ * wait for submitted batches and disable dma engines of the open dma session
+ */
+void mv_ddr_dma_session_close(void);
+
+/* golden data unit held by dst regions, for read-only checks */
+struct mv_ddr_dma_golden {
+	u32 crc[MV_DDR_DMA_ENG_NUM];	/* golden crc32 per dma */
+	const uint64_t *unit;		/* data unit, kept by the caller */
+	int dirty;			/* dst regions may no longer hold the data unit */
+};
+
+/**
+ * write a data unit to dst regions by the cpu and take its crc32, as the
+ * dma engines calculate it, on the cpu too, as the golden value for
+ * mv_ddr_dma_session_golden_check(); nothing is read thru the dram, so the
+ * golden data does not depend on the rx setup under test
+ *
+ * @param    unit	data unit; kept in golden for a reload, so it has to stay valid
+ * @param    dst	start addresses of dst regions per dma
+ * @param    size	size of data unit
+ * @param    dma_num	number of dma engines to use
+ * @param    desc_num	number of descriptors (regions) per dma engine to use
+ * @param    golden	golden data unit, returned
+ *
+ * @retval 0 success
+ */
+int mv_ddr_dma_golden_load(const uint64_t *unit, uint64_t *dst, uint64_t size, u32 dma_num,
+			   u32 desc_num, struct mv_ddr_dma_golden *golden);
+
+/**
+ * read-only check of dst regions: their crc32 is compared with the golden one,
+ * which halves dram traffic compared with a copy and a compare; dst regions
+ * are reloaded first if golden is dirty, e.g. after a failed copy test
+ *
+ * @param    dst, size, dma_num, desc_num, golden	as in mv_ddr_dma_golden_load()
+ *
+ * @retval   fail_cnt	number of comparison failures
+ *			or -1 if a dma engine timed out
+ */
+int mv_ddr_dma_session_golden_check(uint64_t *dst, uint64_t size, u32 dma_num, u32 desc_num,
+				    struct mv_ddr_dma_golden *golden);
+
 #endif /* _MV_DDR_XOR_V2_H */
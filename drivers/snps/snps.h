@@ -6,6 +6,7 @@
 #define _SNPS_H_
 
 #include "mv_ddr_atf_wrapper.h"
+#include "snps_mailbox_bin.h"
 /*#define SNPS_DEBUG*/
 #if defined(SNPS_DEBUG)
 #define pr_debug(args...)	printf(args)
@@ -17,6 +18,39 @@
 #define pr_debug(args...)
 #endif
 
+/*
+ * load the sequential imem/dmem sections thru the xor v2 dma engine,
+ * falling back to cpu writes when the dma can't be used
+ */
+/*#define SNPS_DMA_LOAD*/
+/* load each sequential section with the cpu and the dma, and print both times */
+/*#define SNPS_DMA_LOAD_TIMING*/
+/*
+ * link the sequential imem/dmem sections packed and unpack them on load
+ * (set by the build with SNPS_PACKED=y, see snps_pack.h)
+ */
+/*#define SNPS_PACKED*/
+/*
+ * keep the mail box log as a binary ring of (id, args) records, dumped on
+ * training failure and decoded on the host (see snps_mailbox_bin.h);
+ * the message dictionaries are then not compiled in
+ */
+/*#define SNPS_MAIL_BOX_BIN*/
+/*
+ * skip 2D training when the 1D eyes reported by the firmware are wide enough;
+ * each margin is in the units of its eye messages: 1/32 UI for the write dq
+ * eyes (see the TxDqDly passing regions message), and rx clk delay steps
+ * (RX_CLK_DLY_MASK field of REG_8C_RX_CLK_DLY) for the read eyes.
+ * the first 1D run then reports the eye messages, which are not logged
+ */
+/*#define SNPS_2D_SKIP*/
+#if !defined(SNPS_2D_SKIP_TX_MARGIN)
+#define SNPS_2D_SKIP_TX_MARGIN	16	/* narrowest 1D write dq eye, 1/32 UI */
+#endif
+#if !defined(SNPS_2D_SKIP_RX_MARGIN)
+#define SNPS_2D_SKIP_RX_MARGIN	16	/* narrowest 1D read clk eye, rx clk delay steps */
+#endif
+
 /*#define SNPS_DEBUG_MSG*/
 #if defined(SNPS_DEBUG_MSG) || defined(SNPS_DEBUG)
 #define pr_debug_msg(args...)	printf(args)
@@ -33,8 +67,14 @@
 struct snps_address_dynamic_update {
 	u32 addr;
 	u16 (*get_update_value)(void);
+	u32 flags;
 };
 
+/* dynamic update flags:
+ * values are derived from the topology once per boot and cached, unless
+ * they depend on the training state (e.g step or retry count) */
+#define SNPS_DYNAMIC_VOLATILE	(1 << 0)
+
 /* initialization flow is bisected to 3 stages:
  * 1. Static initialization: with Synopsys delivery input
  * 2. Static update: with fixed values for certain variables
@@ -87,6 +127,7 @@ enum snps_training_result {
 
 enum snps_load_source_type {
 	LOAD_SEQUENTIAL,
+	LOAD_SEQUENTIAL_PACKED,
 	LOAD_RANDOM,
 };
 
@@ -108,6 +149,7 @@ struct snps_section_content {
 	union {
 		const struct snps_address_data	*random;
 		const struct snps_seq_data *sequential;
+		const struct snps_seq_packed *packed;
 	} load_static;
 	const struct snps_address_data	*load_static_update;
 	const struct snps_address_dynamic_update	*load_dynamic_update;
@@ -115,7 +157,11 @@ struct snps_section_content {
 
 
 /* ************ Message Block definitions ************ */
-#define SNPS_MAX_RUN_COUNT 10
+/* retries of a recoverable training failure, before it's considered fatal */
+#define SNPS_MAX_RETRY_COUNT	2
+/* times 1D is retrained when 2D keeps failing */
+#define SNPS_MAX_2D_FALLBACK	1
+#define SNPS_MAX_RUN_COUNT 16
 /* NOTE:
  * This enum below must be aligned with message block field's definition
  * (defined in snps_msg_block_result msg_blk_data)
@@ -206,6 +252,12 @@ enum snps_major_msg_id {
 	MB_MAJOR_ID_TRAINING_FAILED = 0xff
 };
 
+/* 1D 'stream' messages reporting eye passing regions:
+ * db, lane (nibble for rx), eye left, eye right, eye center */
+#define MB_STREAM_1D_TXDQ_EYE		0x16
+#define MB_STREAM_1D_TXDQ_EYE_ALT	0x1e
+#define MB_STREAM_1D_RXCLK_EYE		0x37
+
 enum snps_log_level {
 	LOG_LEVEL_10 = 0,
 	LOG_LEVEL_20,
@@ -221,12 +273,28 @@ struct snps_global_data {
 	enum snps_training_state training_state;
 
 	/* Mail Box */
+#if defined(SNPS_MAIL_BOX_BIN)
+	u32 mb_ring[SNPS_MB_BIN_RING_WORDS];
+	int mb_ring_head;	/* next word to write */
+	int mb_ring_used;	/* words in use */
+	int mb_ring_lost;	/* records dropped on overflow */
+#else
 	int messages[MAILBOX_MSG_MAX_COUNT][MAILBOX_MSG_ARGUMENT_MAX_COUNT];
 	int message_log_index;
+#endif
+	int mb_steps_done;	/* sequence_ctrl steps completed in the last run */
+#if defined(SNPS_2D_SKIP)
+	/* narrowest 1D eyes reported by the firmware, and the number of reports */
+	int eye_min_tx, eye_tx_count;
+	int eye_min_rx, eye_rx_count;
+#endif
 
 	/* Message Block & training results data */
 	struct snps_msg_block_result_log results[SNPS_MAX_RUN_COUNT];
 	int current_run_num;
+
+	/* retries done for the currently trained section */
+	int retry_count;
 };
 
 extern struct snps_global_data gd;
@@ -248,7 +316,12 @@ u16 snps_sequence_ctrl_get(void);
 void snps_trigger_pmu_training(void);
 int snps_mail_box_log_init(void);
 int snps_mail_box_read(void);
+#if defined(SNPS_MAIL_BOX_BIN)
+void snps_mail_box_bin_dump(void);
+#else
 void snps_mail_box_log_dump(void);
+#endif
+int snps_mail_box_steps_done(void);
 int snps_poll_calibration_completion(void);
 enum snps_training_state snps_get_state(void);
 void snps_set_state(enum snps_training_state training_state);
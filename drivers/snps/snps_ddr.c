@@ -6,6 +6,10 @@
 #include "snps.h"
 #include "snps_update.h"
 #include "snps_regs.h"
+#include "snps_pack.h"
+#if defined(SNPS_DMA_LOAD) || defined(SNPS_DMA_LOAD_TIMING)
+#include "mv_ddr_xor_v2.h"
+#endif
 
 /* TODO: consider where to relocate the below structs: snps_section_names & snps_sections */
 static struct snps_section_name snps_section_names[] = {
@@ -26,26 +30,46 @@ static struct snps_section_content snps_sections[] = {
 	 .load_dynamic_update = init_phy_dynamic_update
 	},
 	{.section_id = SECTION_1D_IMEM,
+#if defined(SNPS_PACKED)
+	 .load_type = LOAD_SEQUENTIAL_PACKED,
+	 .load_static.packed = &one_d_imem_packed,
+#else
 	 .load_type = LOAD_SEQUENTIAL,
 	 .load_static.sequential = &one_d_imem_static,
+#endif /* SNPS_PACKED */
 	 .load_static_update = NULL,
 	 .load_dynamic_update = NULL
 	},
 	{.section_id = SECTION_1D_DMEM,
+#if defined(SNPS_PACKED)
+	 .load_type = LOAD_SEQUENTIAL_PACKED,
+	 .load_static.packed = &one_d_dmem_packed,
+#else
 	 .load_type = LOAD_SEQUENTIAL,
 	 .load_static.sequential = &one_d_dmem_static,
+#endif /* SNPS_PACKED */
 	 .load_static_update = one_d_dmem_static_update,
 	 .load_dynamic_update = one_d_dmem_dynamic_update
 	},
 	{.section_id = SECTION_2D_IMEM,
+#if defined(SNPS_PACKED)
+	 .load_type = LOAD_SEQUENTIAL_PACKED,
+	 .load_static.packed = &two_d_imem_packed,
+#else
 	 .load_type = LOAD_SEQUENTIAL,
 	 .load_static.sequential = &two_d_imem_static,
+#endif /* SNPS_PACKED */
 	 .load_static_update = NULL,
 	 .load_dynamic_update = NULL
 	},
 	{.section_id = SECTION_2D_DMEM,
+#if defined(SNPS_PACKED)
+	 .load_type = LOAD_SEQUENTIAL_PACKED,
+	 .load_static.packed = &two_d_dmem_packed,
+#else
 	 .load_type = LOAD_SEQUENTIAL,
 	 .load_static.sequential = &two_d_dmem_static,
+#endif /* SNPS_PACKED */
 	 .load_static_update = two_d_dmem_static_update,
 	 .load_dynamic_update = two_d_dmem_dynamic_update
 	},
@@ -81,7 +105,7 @@ static int snps_mail_box_poll_completion(void)
 		ret = snps_mail_box_read();
 	} while (ret != MB_MAJOR_ID_TRAINING_SUCCESS &&	ret != MB_MAJOR_ID_TRAINING_FAILED
 			&& ret != MAIL_BOX_ERROR);
-#if !defined(T9130) && !defined(T9030)
+#if !defined(T9130) && !defined(T9030) && !defined(SNPS_MAIL_BOX_BIN)
 	/* Once step completed, dump mail box messages according to log level */
 	/* On 9130 and 9030 the SRAM is too small, therefore it can not compile with this function */
 	snps_mail_box_log_dump();
@@ -97,10 +121,12 @@ static int snps_mail_box_poll_completion(void)
  * SNPS_TRAINING_SEQUENCE_RETRY: Training step failed, but this can be recovered.
  *				 This means that a certain training step (or steps) should be retried.
  * SNPS_TRAINING_SEQUENCE_FAIL : Training step failed - unrecoverable.
+ * On retry, 'retry_flags' is set with the sequence_ctrl step/s to be re-run:
+ * the requested steps that weren't reported as completed in the mail box.
  */
-static int snps_evaluate_training_results(int sequence_ctrl)
+static int snps_evaluate_training_results(int sequence_ctrl, int *retry_flags)
 {
-	int ret;
+	int ret, failed_steps;
 	debug_enter();
 
 	ret = snps_get_result(MSG_BLK_CS_TEST_FAIL, SNPS_LAST_RUN, SEQEUNCE_CTRL_ALL);
@@ -110,17 +136,35 @@ static int snps_evaluate_training_results(int sequence_ctrl)
 	}
 
 	/* Else CS_TEST_FAIL equals non-zero, means that one or more ranks failed training */
+	if (ret < 0) {
+		ret = TRAINING_SEQUENCE_FAIL;
+		goto finish;
+	}
 	pr_debug("Error: %d ranks failed training\n" , ret);
-	ret = TRAINING_SEQUENCE_FAIL;
 
-	/* TODO: implement decision logic below, (SNPS state machine):
-	 * read message block (and mail box if needed), and decide whether training is:
-	 * 1. Recoverable, so we should retry training step/s, with new settings
-	 * 2. Failed, since failure can't be recovered.
-	 */
+	/* the first step that didn't complete is the one that failed; when all
+	 * steps completed (the final rank test failed), all of them are re-run */
+	failed_steps = sequence_ctrl & ~snps_mail_box_steps_done();
+	if (failed_steps == 0)
+		failed_steps = sequence_ctrl;
 
-	/* return SNPS_TRAINING_SEQUENCE_RETRY; */
-	/* return SNPS_TRAINING_SEQUENCE_FAIL; */
+	/* a device that failed to initialize won't recover by retraining */
+	if (failed_steps & SEQUENCE_CTRL_DEV_INIT) {
+		printf("SNPS DDR: device init failed (CS_TEST_FAIL = %d)\n", ret);
+		ret = TRAINING_SEQUENCE_FAIL;
+		goto finish;
+	}
+
+	if (gd.retry_count >= SNPS_MAX_RETRY_COUNT ||
+	    gd.current_run_num >= SNPS_MAX_RUN_COUNT) {
+		printf("SNPS DDR: training step/s %x failed after %d retries\n",
+		       failed_steps, gd.retry_count);
+		ret = TRAINING_SEQUENCE_FAIL;
+		goto finish;
+	}
+
+	*retry_flags = failed_steps;
+	ret = TRAINING_SEQUENCE_RETRY;
 
 
 	/* some examples on how to use snps_get_results with various argument's combination
@@ -149,6 +193,108 @@ finish:
 	return ret;
 }
 
+/* write a sequential section word by word, and pad the rest of it with zeros */
+static void snps_load_seq_cpu(const struct snps_seq_data *seq)
+{
+	int idx, address;
+
+	/* Firstly write all predefined entries */
+	for (idx = 0, address = seq->start_addr; idx < seq->data_count; address++, idx++)
+		SNPS_STATIC_WRITE(address, seq->data[idx]);
+
+	/* Pad the rest of memory with zeros */
+	for (; address <= seq->end_addr; address++)
+		SNPS_STATIC_WRITE(address, 0x0);
+}
+
+#if defined(SNPS_DMA_LOAD) || defined(SNPS_DMA_LOAD_TIMING)
+/*
+ * each 16-bit phy csr takes two bytes of the unit's address space, so a
+ * sequential section is a plain copy of its image followed by a zero fill;
+ * the dma moves the SNPS_DMA_LOAD_ALIGN aligned bulk of both, the cpu writes
+ * the remaining words. returns non-zero when the dma can't be used.
+ */
+#define SNPS_DMA_LOAD_ALIGN	8
+
+static int snps_load_seq_dma(const struct snps_seq_data *seq)
+{
+	uint64_t src = (uint64_t)(unsigned long)seq->data;
+	uint64_t dst = gd.base_address + 2 * seq->start_addr;
+	uint64_t size = 2 * seq->data_count;
+	uint64_t pad_dst, pad_size;
+	int idx, address;
+
+	if ((src | dst) & (SNPS_DMA_LOAD_ALIGN - 1))
+		return -1;
+
+	/* image bulk, and the words left by the dma */
+	idx = (size & ~(SNPS_DMA_LOAD_ALIGN - 1)) / 2;
+	if (idx && mv_ddr_dma_memcpy(&src, &dst, 2 * idx, 1, 1))
+		return -1;
+	for (address = seq->start_addr + idx; idx < seq->data_count; address++, idx++)
+		SNPS_STATIC_WRITE(address, seq->data[idx]);
+
+	/* zero padding: cpu up to the dma alignment, dma bulk, cpu tail */
+	for (; address <= seq->end_addr; address++) {
+		pad_dst = gd.base_address + 2 * address;
+		if ((pad_dst & (SNPS_DMA_LOAD_ALIGN - 1)) == 0)
+			break;
+		SNPS_STATIC_WRITE(address, 0x0);
+	}
+	pad_size = 0;
+	if (address <= seq->end_addr)
+		pad_size = (2 * (seq->end_addr + 1 - address)) & ~(SNPS_DMA_LOAD_ALIGN - 1);
+	if (pad_size && mv_ddr_dma_memset(pad_dst, pad_size, 0))
+		return -1;
+	for (address += pad_size / 2; address <= seq->end_addr; address++)
+		SNPS_STATIC_WRITE(address, 0x0);
+
+	return 0;
+}
+#endif /* SNPS_DMA_LOAD || SNPS_DMA_LOAD_TIMING */
+
+static void snps_load_sequential(enum snps_section_id section_id, const struct snps_seq_data *seq)
+{
+#if defined(SNPS_DMA_LOAD_TIMING)
+	u32 start, cpu_us, dma_us, idx, errors = 0;
+
+	start = mv_ddr_time_us();
+	snps_load_seq_cpu(seq);
+	cpu_us = mv_ddr_time_us() - start;
+
+	/* scramble the image, so that the readback below checks the dma load */
+	for (idx = 0; idx < seq->data_count; idx++)
+		SNPS_STATIC_WRITE(seq->start_addr + idx, ~seq->data[idx]);
+
+	start = mv_ddr_time_us();
+	if (snps_load_seq_dma(seq)) {
+		printf("SNPS DDR: '%s': dma load not possible, cpu %d us\n",
+		       snps_section_names[section_id].section_name, cpu_us);
+		snps_load_seq_cpu(seq);
+		return;
+	}
+	dma_us = mv_ddr_time_us() - start;
+
+	for (idx = 0; idx < seq->data_count; idx++)
+		if (snps_read(seq->start_addr + idx) != seq->data[idx])
+			errors++;
+	printf("SNPS DDR: '%s': %d words, cpu %d us, dma %d us, %d readback errors\n",
+	       snps_section_names[section_id].section_name, seq->end_addr - seq->start_addr + 1,
+	       cpu_us, dma_us, errors);
+	if (errors)
+		snps_load_seq_cpu(seq);
+#elif defined(SNPS_DMA_LOAD)
+	if (snps_load_seq_dma(seq) == 0)
+		return;
+
+	printf("SNPS DDR: '%s': dma load not possible, using cpu\n",
+	       snps_section_names[section_id].section_name);
+	snps_load_seq_cpu(seq);
+#else
+	snps_load_seq_cpu(seq);
+#endif
+}
+
 /* This routine will load the initial static section of requested section_id,
  * and if requested also static_update stage (with 'static_update' argument),
  * than it will also load the static update section for that section_id.
@@ -199,21 +345,30 @@ static int snps_load_static(enum snps_section_id section_id, enum snps_static_up
 			/* Sequentional load - only possible at stage 0 (init) */
 			const struct snps_seq_data *sequent_ptr =
 						 snps_sections[section_id].load_static.sequential;
-			int address;
 
 			/* Verify section */
 			if (sequent_ptr == NULL)
 				goto static_isolate_csr;
 
-			/* Firstly write all predefined entries */
-			for (idx = 0, address = sequent_ptr->start_addr;
-			     idx < sequent_ptr->data_count; address++, idx++)
-				SNPS_STATIC_WRITE(address, sequent_ptr->data[idx]);
+			snps_load_sequential(section_id, sequent_ptr);
+			idx = sequent_ptr->data_count;
+
+#if defined(SNPS_PACKED)
+		} else if ((stage == 0) &&
+			   (snps_sections[section_id].load_type == LOAD_SEQUENTIAL_PACKED)) {
+			/* Packed sequential load - unpacked on the fly */
+			const struct snps_seq_packed *packed_ptr =
+						 snps_sections[section_id].load_static.packed;
 
-			/* Pad the rest of memory with zeros */
-			for (; address <= sequent_ptr->end_addr; address++)
-				SNPS_STATIC_WRITE(address, 0x0);
+			/* Verify section */
+			if (packed_ptr == NULL)
+				goto static_isolate_csr;
 
+			/* a corrupted stream is reported as invalid content */
+			if (snps_unpack_seq(packed_ptr))
+				goto static_isolate_csr;
+			idx = packed_ptr->data_count;
+#endif /* SNPS_PACKED */
 		} else {
 			/* Random sequence load */
 			const struct snps_address_data *section_ptr;
@@ -288,6 +443,16 @@ finish:
 	return 0;
 }
 
+/* per section cache of the dynamic update values (see SNPS_DYNAMIC_VOLATILE) */
+#define SNPS_DYNAMIC_CACHE_SIZE	48
+struct snps_dynamic_cache {
+	int valid;
+	int count;	/* cached entries; entries beyond it are never cached */
+	u16 values[SNPS_DYNAMIC_CACHE_SIZE];
+};
+
+static struct snps_dynamic_cache snps_dynamic_cache[SECTION_PHY_INIT_ENGINE + 1];
+
 /* snps_load_dynamic:
  * This routine will overide the pre-loaded static sections, with topology
  * settings updates, and run-time updates (depends on the training step).
@@ -295,11 +460,15 @@ finish:
  * any step of the training process.
  * The function pointers for getting updated field's values are defined
  * at the struct pointed by load_dynamic_update entry in the snps_sections array.
+ * Values that only depend on the topology are derived on the first load of the
+ * section, and are written from the section's cache on the following loads.
  */
 static int snps_load_dynamic(enum snps_section_id section_id)
 {
 	int ret = 0, i = 0;
 	const struct snps_address_dynamic_update *section_ptr;
+	struct snps_dynamic_cache *cache = &snps_dynamic_cache[section_id];
+	u16 value;
 
 	debug_enter();
 
@@ -315,11 +484,21 @@ static int snps_load_dynamic(enum snps_section_id section_id)
 			ret = -1;
 			goto isolate_csr;
 	}
+	if (!cache->valid) {
+		for (i = 0; section_ptr[i].addr != -1 && i < SNPS_DYNAMIC_CACHE_SIZE; i++)
+			if (!(section_ptr[i].flags & SNPS_DYNAMIC_VOLATILE))
+				cache->values[i] = section_ptr[i].get_update_value();
+		cache->count = i;
+		cache->valid = 1;
+	}
+
 	/* Go over section and write it's address-data pairs */
-	while (section_ptr[i].addr != -1) {
-		/*snps_fw_write(section_ptr[i].addr, section_ptr[i].get_update_value());*/
-		snps_fw_write(section_ptr[i].addr, section_ptr[i].get_update_value());
-		i++;
+	for (i = 0; section_ptr[i].addr != -1; i++) {
+		if (i < cache->count && !(section_ptr[i].flags & SNPS_DYNAMIC_VOLATILE))
+			value = cache->values[i];
+		else
+			value = section_ptr[i].get_update_value();
+		snps_fw_write(section_ptr[i].addr, value);
 	}
 
 isolate_csr:
@@ -367,6 +546,8 @@ fail:
  * 5. Read message block training output results
  * 6. Evaluate success/failure of performed training step
  * 7. Decide how to retry, in case retry is required
+ * returns 0 on success, TRAINING_SEQUENCE_RETRY when a recoverable failure ran
+ * out of retries, or another non-zero value on a fatal failure
  *
  * - enum snps_section_id dmem_section: SNPS_1D_DMEM / SNPS_2D_DMEM
  * - enum snps_training_method training_method:
@@ -376,7 +557,7 @@ fail:
  */
 static int snps_ddr_section_run(enum snps_section_id dmem_section, enum snps_training_method training_method)
 {
-	int ret = 0, step;
+	int ret = 0, step, retry_flags = 0;
 	/* Mark all sequence_flags cells as unused (-1) */
 	int sequence_flags[SEQEUNCE_CTRL_1D_COUNT + 1] = { [0 ... (SEQEUNCE_CTRL_1D_COUNT)] = -1 };
 	debug_enter();
@@ -411,6 +592,8 @@ static int snps_ddr_section_run(enum snps_section_id dmem_section, enum snps_tra
 		goto fail;
 	}
 
+	gd.retry_count = 0;
+
 	/* Load dynamic updates for each section & step, trigger step, and evaluate results */
 	for (step = 0; sequence_flags[step] != -1; ) {
 		/* --- Step 3: Set required training step --- */
@@ -436,28 +619,25 @@ static int snps_ddr_section_run(enum snps_section_id dmem_section, enum snps_tra
 			goto fail;
 
 		/* --- Step 7: Evaluate training results */
-		ret = snps_evaluate_training_results(sequence_flags[step]);
+		ret = snps_evaluate_training_results(sequence_flags[step], &retry_flags);
 		switch (ret) {
 		case TRAINING_SEQUENCE_PASS:
 			pr_debug("Training step/s sequence %x passed\n", sequence_flags[step]);
 			step++;	/* set next step */
 		break;
 		case TRAINING_SEQUENCE_RETRY:
-			/* TODO: consider relocate following retry settings to a specific routine */
-			pr_debug("Training step/s sequence %x will be retried\n", sequence_flags[step]);
-			/* TODO: set what step we need to retry:
-			 * 1. Set new sequence_flags to be re-run from current section
-			 * OR
-			 * 2. In case 2D failed, and 1D step is required to be run again
-			 *    then snps_ddr_section_trigger routine can be called recursively:
-			 *    example:
-			 *    -> call: snps_ddr_section_trigger(2D), which failed and now need 1D again
-			 *    -> call snps_ddr_training(1D)  from here (recursively)
-			 *    -> return here from 1D recursive call, and continue from same step of 2D training
-			 */
+			/* re-run only the failed step/s of the current step; the dynamic
+			 * update of the retried run is aware of the retry count */
+			gd.retry_count++;
+			printf("SNPS DDR: training step/s %x failed, retry %d of %d with step/s %x\n",
+			       sequence_flags[step], gd.retry_count, SNPS_MAX_RETRY_COUNT, retry_flags);
+			sequence_flags[step] = retry_flags;
 		break;
 		case TRAINING_SEQUENCE_FAIL:
 			printf("Training step/s sequence %x failed\n", sequence_flags[step]);
+			/* report a recoverable failure that ran out of retries */
+			if (gd.retry_count >= SNPS_MAX_RETRY_COUNT)
+				ret = TRAINING_SEQUENCE_RETRY;
 			goto fail;
 		}
 	}
@@ -507,17 +687,44 @@ fail:
 	return ret;
 }
 
+#if defined(SNPS_2D_SKIP)
+/* 2D training is only needed when some 1D eye is narrower than the threshold;
+ * without eye reports from the firmware, or after a retried 1D run, 2D training
+ * is never skipped */
+static int snps_2d_skip_check(void)
+{
+	int skip;
+
+	skip = !gd.retry_count && gd.eye_tx_count && gd.eye_rx_count &&
+	       gd.eye_min_tx >= SNPS_2D_SKIP_TX_MARGIN &&
+	       gd.eye_min_rx >= SNPS_2D_SKIP_RX_MARGIN;
+
+	printf("SNPS DDR: 1D eyes: tx %d (%d lanes, min %d), rx %d (%d nibbles, min %d): %s 2D training\n",
+	       gd.eye_min_tx, gd.eye_tx_count, SNPS_2D_SKIP_TX_MARGIN,
+	       gd.eye_min_rx, gd.eye_rx_count, SNPS_2D_SKIP_RX_MARGIN,
+	       skip ? "skipping" : "running");
+
+	return skip;
+}
+#endif /* SNPS_2D_SKIP */
+
 /* initialize global settings */
 static void snps_global_settings_init(unsigned long base_address)
 {
 	gd.current_run_num = 0;
 	gd.base_address =  base_address;
+	memset(snps_dynamic_cache, 0, sizeof(snps_dynamic_cache));
+#if defined(SNPS_MAIL_BOX_BIN)
+	gd.mb_ring_head = 0;
+	gd.mb_ring_used = 0;
+	gd.mb_ring_lost = 0;
+#endif
 }
 
 
 int snps_init(unsigned int base_address)
 {
-	int ret;
+	int ret, fallback;
 	debug_enter();
 
 	printf("Synopsys DDR43 PHY Firmware version: %s\n" , SNPS_DDR_PHY_FW_VERSION);
@@ -545,21 +752,37 @@ int snps_init(unsigned int base_address)
 	if (ret != 0)
 		goto fail;
 
-	/* 1D training */
-	snps_set_state(TRAINING_1D);
-	ret = snps_ddr_training(SECTION_1D_IMEM);
-	if (ret != 0)
-		goto fail;
+	for (fallback = 0; ; fallback++) {
+		/* 1D training */
+		snps_set_state(TRAINING_1D);
+#if defined(SNPS_2D_SKIP)
+		gd.eye_tx_count = 0;
+		gd.eye_rx_count = 0;
+#endif
+		ret = snps_ddr_training(SECTION_1D_IMEM);
+		if (ret != 0)
+			goto fail;
 
-	/* fix 1d receiver centering training result */
-	snps_crx_1d_fix();
+		/* fix 1d receiver centering training result */
+		snps_crx_1d_fix();
 
-	/* 2D training */
-	snps_set_state(TRAINING_2D);
+#if defined(SNPS_2D_SKIP)
+		if (snps_2d_skip_check())
+			break;
+#endif
 
-	ret = snps_ddr_training(SECTION_2D_IMEM);
-	if (ret != 0)
-		goto fail;
+		/* 2D training */
+		snps_set_state(TRAINING_2D);
+
+		ret = snps_ddr_training(SECTION_2D_IMEM);
+		if (ret == 0)
+			break;
+
+		/* 2D failures that retries didn't recover, may be fixed by new 1D results */
+		if (ret != TRAINING_SEQUENCE_RETRY || fallback >= SNPS_MAX_2D_FALLBACK)
+			goto fail;
+		printf("SNPS DDR: falling back to 1D training\n");
+	}
 
 	/* load PHY Init Engine (PIE) static section, with no static update */
 	snps_set_state(PHY_INIT_ENGINE);
@@ -568,6 +791,11 @@ int snps_init(unsigned int base_address)
 		goto fail;
 
 fail:
+#if defined(SNPS_MAIL_BOX_BIN)
+	/* the binary mail box log is only dumped on failure, for the host decoder */
+	if (ret != 0)
+		snps_mail_box_bin_dump();
+#endif
 	printf("SNPS DDR: training %s\n", ret == 0 ? "completed" : "failed");
 	debug_exit();
 	return ret;
@@ -4,12 +4,15 @@
 
 #include "snps.h"
 #include "snps_regs.h"
+#if !defined(SNPS_MAIL_BOX_BIN)
 #include "snps_mailbox_stream.h"
+#endif
 #include "ddr_topology_def.h"
 #include "ddr3_training_ip_db.h"
 
 struct snps_global_data gd;
 
+#if !defined(SNPS_MAIL_BOX_BIN)
 struct mail_box_major_message mb_major_messages[] = {
 /*	ID,					Message string	*/
 	{MB_MAJOR_ID_END_INIT,			"End of initialization"},
@@ -30,6 +33,7 @@ struct mail_box_major_message mb_major_messages[] = {
 	{MB_MAJOR_ID_WRITE_LVL_COARSE_DELAY,	"End of Write leveling coarse delay"},
 	{MB_MAJOR_ID_TRAINING_FAILED,		"Training has failed (firmware complete)"}
 };
+#endif /* SNPS_MAIL_BOX_BIN */
 
 /* ==================================================================== */
 /*				Message Block				*/
@@ -165,9 +169,13 @@ fail:
  * to log messages */
 int snps_mail_box_log_init(void)
 {
-	int i, j, ret = 0;
+#if !defined(SNPS_MAIL_BOX_BIN)
+	int i, j;
+#endif
+	int ret = 0;
 	debug_enter();
 
+#if !defined(SNPS_MAIL_BOX_BIN)
 	/* go over all message array entries and clear them from previous data */
 	for (i = 0; i < MAILBOX_MSG_MAX_COUNT; i++)
 		for (j = 0; j < MAILBOX_MSG_ARGUMENT_MAX_COUNT; j++)
@@ -175,6 +183,9 @@ int snps_mail_box_log_init(void)
 
 	/* clear logged message counter */
 	gd.message_log_index = 0;
+#endif
+	/* the binary log ring keeps the messages of previous runs */
+	gd.mb_steps_done = 0;
 
 	debug_exit();
 	return ret;
@@ -243,22 +254,134 @@ fail:
 	return ret;
 }
 
-/* Read mail box message and log it.
- * Received messages and their arguments were logged in 'messages' global array
- * - cell#0: message ID
- * - cell#1:
- *		- if equals to MB_MSG_TYPE_MAJOR, than message is 'major' message
- *		- else if equals to MB_MSG_TYPE_STREAM, message is 'stream' type with arguments
- * - cells[#2..end]: message arguments (in case message is 'stream')
+/* map a 'major' message to the sequence_ctrl training step it completes */
+static int snps_mail_box_major_step(int message_id)
+{
+	switch (message_id) {
+	case MB_MAJOR_ID_END_INIT:
+		return SEQUENCE_CTRL_DEV_INIT;
+	case MB_MAJOR_ID_FINE_WR_LVL:
+		return SEQUENCE_CTRL_1D_WR_LVL;
+	case MB_MAJOR_ID_READ_EN_TRANING:
+		return SEQUENCE_CTRL_1D_RX_EN;
+	case MB_MAJOR_ID_READ_DELAY_CNTR_OPT:
+		return SEQUENCE_CTRL_1D_RD_DQS_1D;
+	case MB_MAJOR_ID_WRITE_DELAY_CNTR_OPT:
+		return SEQUENCE_CTRL_1D_WR_DQ_1D;
+	case MB_MAJOR_ID_MAX_READ_DQ_DESKEW:
+		return SEQUENCE_CTRL_1D_RD_DESKEW;
+	case MB_MAJOR_ID_MAX_READ_LATENCY:
+		return SEQUENCE_CTRL_1D_MX_RD_LAT;
+	case MB_MAJOR_ID_2D_WRITE_DELAY_CNTR_OPT:	/* read delay/voltage center */
+		return SEQUENCE_CTRL_2D_READ_DQS;
+	case MB_MAJOR_ID_2D_READ_DELAY_CNTR_OPT:	/* write delay/voltage center */
+		return SEQUENCE_CTRL_2D_WRITE_DQ;
+	}
+
+	return 0;
+}
+
+#if defined(SNPS_2D_SKIP)
+/* keep the narrowest of the 1D eyes reported by the firmware */
+static void snps_mail_box_eye_track(int message_id, const int *args, int argument_count)
+{
+	int width;
+
+	if (argument_count < 4)
+		return;
+
+	width = args[3] - args[2];
+	switch (message_id) {
+	case MB_STREAM_1D_TXDQ_EYE:
+	case MB_STREAM_1D_TXDQ_EYE_ALT:
+		if (gd.eye_tx_count++ == 0 || width < gd.eye_min_tx)
+			gd.eye_min_tx = width;
+		break;
+	case MB_STREAM_1D_RXCLK_EYE:
+		if (gd.eye_rx_count++ == 0 || width < gd.eye_min_rx)
+			gd.eye_min_rx = width;
+		break;
+	}
+}
+#endif /* SNPS_2D_SKIP */
+
+/* Log a received message:
+ * - binary log: a record of header word and arguments is added to the ring,
+ *   dropping the oldest records when there's no room
+ * - else: message is saved in 'messages' global array
+ *	- cell#0: message ID
+ *	- cell#1: MB_MSG_TYPE_MAJOR or MB_MSG_TYPE_STREAM
+ *	- cells[#2..end]: message arguments (in case message is 'stream')
+ */
+static void snps_mail_box_log(int message_id, enum snps_mailbox_msg_type msg_type,
+			      const int *args, int argument_count)
+{
+	int i;
+#if defined(SNPS_MAIL_BOX_BIN)
+	int tail;
+	u32 header;
+#endif
+
+#if defined(SNPS_2D_SKIP)
+	/* the first 1D run reports margins verbosity for the eyes only (see
+	 * dmem_1d_hdt_ctrl_get): track them, and keep its stream messages out of
+	 * the log, as the default verbosity would */
+	if (msg_type == MB_MSG_TYPE_STREAM && gd.training_state == TRAINING_1D &&
+	    !gd.retry_count) {
+		snps_mail_box_eye_track(message_id, args, argument_count);
+		return;
+	}
+#endif
+
+#if defined(SNPS_MAIL_BOX_BIN)
+
+	header = ((message_id & SNPS_MB_REC_ID_MASK) << SNPS_MB_REC_ID_OFFS) |
+		 ((argument_count & SNPS_MB_REC_ARGC_MASK) << SNPS_MB_REC_ARGC_OFFS) |
+		 ((gd.training_state & SNPS_MB_REC_STATE_MASK) << SNPS_MB_REC_STATE_OFFS);
+	if (msg_type == MB_MSG_TYPE_STREAM)
+		header |= SNPS_MB_REC_STREAM;
+
+	while (gd.mb_ring_used + 1 + argument_count > SNPS_MB_BIN_RING_WORDS) {
+		tail = (gd.mb_ring_head + SNPS_MB_BIN_RING_WORDS - gd.mb_ring_used) %
+		       SNPS_MB_BIN_RING_WORDS;
+		gd.mb_ring_used -= 1 + ((gd.mb_ring[tail] >> SNPS_MB_REC_ARGC_OFFS) &
+					SNPS_MB_REC_ARGC_MASK);
+		gd.mb_ring_lost++;
+	}
+
+	gd.mb_ring[gd.mb_ring_head] = header;
+	gd.mb_ring_head = (gd.mb_ring_head + 1) % SNPS_MB_BIN_RING_WORDS;
+	for (i = 0; i < argument_count; i++) {
+		gd.mb_ring[gd.mb_ring_head] = args[i];
+		gd.mb_ring_head = (gd.mb_ring_head + 1) % SNPS_MB_BIN_RING_WORDS;
+	}
+	gd.mb_ring_used += 1 + argument_count;
+#else
+	/* a full log drops messages; completed steps are tracked below */
+	if (gd.message_log_index < MAILBOX_MSG_MAX_COUNT) {
+		for (i = 0; i < argument_count; i++)
+			gd.messages[gd.message_log_index][i + 2] = args[i];
+		/* NOTE: this mark will be used in snps_mail_box_log_dump(),
+		 * to print message string from 'major' or 'stream' string dictionary */
+		gd.messages[gd.message_log_index][1] = msg_type;
+		gd.messages[gd.message_log_index++][0] = message_id;
+	}
+#endif
+
+	if (msg_type == MB_MSG_TYPE_MAJOR)
+		gd.mb_steps_done |= snps_mail_box_major_step(message_id);
+}
+
+/* Read mail box message and log it (see snps_mail_box_log).
  * Routine returns message type
  */
 int snps_mail_box_read(void)
 {
-	int i, argument_count, message_id, message_arg, stream_message_id, ret = 0;
+	int i, argument_count = 0, message_id, message_arg, stream_message_id, ret = 0;
+	int args[MAILBOX_MSG_ARGUMENT_MAX_COUNT];
+	enum snps_mailbox_msg_type msg_type = MB_MSG_TYPE_MAJOR;
 	debug_enter();
 
-
-
 	/* first read 'MAJOR' type of message */
 	message_id = snps_mail_box_get_message(MB_MSG_TYPE_MAJOR);
 	if (message_id == MAIL_BOX_ERROR) {
@@ -266,7 +389,7 @@ int snps_mail_box_read(void)
 		goto fail;
 	}
 
-	pr_debug("%s: read message #%d = 0x%x\n", __func__, gd.message_log_index, message_id);
+	pr_debug("%s: read message = 0x%x\n", __func__, message_id);
 
 	/* if message type is 'stream', read message content and arguments (if exists) */
 	if (message_id == MB_MAJOR_ID_STREAM_MSG) {
@@ -289,7 +412,7 @@ int snps_mail_box_read(void)
 			goto fail;
 		}
 
-		/* If arguments exists, save them in message log, starting cell#2 */
+		/* read the arguments (if exists) */
 		for (i = 0; i < argument_count; i++) {
 			message_arg = snps_mail_box_get_message(MB_MSG_TYPE_STREAM);
 			/* pr_debug("arg#%d = 0x%x\n" , i, message_arg); */
@@ -299,30 +422,49 @@ int snps_mail_box_read(void)
 				goto fail;
 			}
 			pr_debug_msg("message_arg = 0x%x\n", message_arg);
-			gd.messages[gd.message_log_index][i + 2] = message_arg;
+			args[i] = message_arg;
 		}
-		 /* Mark 'stream' type in cell#1 of messages log */
-		gd.messages[gd.message_log_index][1] = MB_MSG_TYPE_STREAM;
+		msg_type = MB_MSG_TYPE_STREAM;
 		message_id = (stream_message_id >> MAILBOX_STREAM_MSG_ID_OFFSET);
 	} else {
 		pr_debug_msg("message is 'major' type (MSG ID = 0x%x)\n", message_id);
-		/* else message type is 'major', with no arguments,
-		 * so mark 'major' type in cell#1 of messages log
-		 * NOTE: this mark will be used in snps_mail_box_log_dump(),
-		 *	 to print message string from 'major' string dictionary) */
-		gd.messages[gd.message_log_index][1] = MB_MSG_TYPE_MAJOR;
+		/* else message type is 'major', with no arguments */
 		ret = message_id;
 	}
 
-	/* Save message_id in cell#0 of current message log array,
-	 * while next cells will hold the message arguments (if exists) */
-	gd.messages[gd.message_log_index++][0] = message_id;
+	snps_mail_box_log(message_id, msg_type, args, argument_count);
 
 fail:
 	debug_exit();
 	return ret;
 }
 
+/* return the sequence_ctrl flags of the training steps that were reported
+ * as completed ('major' messages) in the mail box log of the last run */
+int snps_mail_box_steps_done(void)
+{
+	return gd.mb_steps_done;
+}
+
+#if defined(SNPS_MAIL_BOX_BIN)
+/* dump the binary mail box log, oldest record first (see snps_mailbox_bin.h) */
+void snps_mail_box_bin_dump(void)
+{
+	int i, idx;
+
+	printf(SNPS_MB_BIN_TAG " begin %d %d\n", gd.mb_ring_used, gd.mb_ring_lost);
+	idx = (gd.mb_ring_head + SNPS_MB_BIN_RING_WORDS - gd.mb_ring_used) % SNPS_MB_BIN_RING_WORDS;
+	for (i = 0; i < gd.mb_ring_used; i++) {
+		if ((i % 8) == 0)
+			printf(SNPS_MB_BIN_TAG);
+		printf(" %08x", gd.mb_ring[idx]);
+		if ((i % 8) == 7 || i == gd.mb_ring_used - 1)
+			printf("\n");
+		idx = (idx + 1) % SNPS_MB_BIN_RING_WORDS;
+	}
+	printf(SNPS_MB_BIN_TAG " end\n");
+}
+#else
 /* print 'major' type of meesages:
  * go over major messages dictionary struct 'mb_major_messages', find required message
  * according to msg_id (since dictionary ID's are not continuous),
@@ -436,6 +578,7 @@ void snps_mail_box_log_dump(void)
 
 	debug_exit();
 }
+#endif /* SNPS_MAIL_BOX_BIN */
 
 /* this routine writes 'data' to specified 'address' offset, with optional debug print support */
 void snps_fw_write(u32 offset, u16 data)
@@ -0,0 +1,37 @@
+/* Copyright (c) 2017 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _SNPS_MAILBOX_BIN_H_
+#define _SNPS_MAILBOX_BIN_H_
+
+/*
+ * binary mail box log
+ *
+ * with SNPS_MAIL_BOX_BIN, mail box messages are kept in a ring of 32-bit
+ * words instead of the message array; each record is a header word followed
+ * by the message arguments. when the ring is full, the oldest records are
+ * dropped. the ring is dumped as hex words on lines starting with
+ * SNPS_MB_BIN_TAG, and decoded on the host with tools/snps_mb_decode, which
+ * owns the message dictionaries:
+ *	<tag> begin <ring words> <lost records>
+ *	<tag> <word> <word> ...
+ *	<tag> end
+ */
+#define SNPS_MB_BIN_TAG			"SNPS MB:"
+
+/* ring size in words */
+#if !defined(SNPS_MB_BIN_RING_WORDS)
+#define SNPS_MB_BIN_RING_WORDS		1024
+#endif
+
+/* record header word */
+#define SNPS_MB_REC_STREAM		(1u << 31)	/* 'stream' message, else 'major' */
+#define SNPS_MB_REC_STATE_OFFS		28		/* enum snps_training_state */
+#define SNPS_MB_REC_STATE_MASK		0x3
+#define SNPS_MB_REC_ARGC_OFFS		16
+#define SNPS_MB_REC_ARGC_MASK		0xff
+#define SNPS_MB_REC_ID_OFFS		0
+#define SNPS_MB_REC_ID_MASK		0xffff
+
+#endif	/* _SNPS_MAILBOX_BIN_H_ */
@@ -0,0 +1,75 @@
+/* Copyright (c) 2017 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "snps_static.h"
+#include "snps.h"
+#include "snps_pack.h"
+
+#if defined(SNPS_PACKED)
+/* last unpacked words, the source of lz copies */
+static u16 snps_pack_window[SNPS_PACK_WINDOW_MAX];
+
+/*
+ * unpack a sequential section straight into csr writes and pad the rest
+ * of it with zeros; returns non-zero on a corrupted stream
+ */
+int snps_unpack_seq(const struct snps_seq_packed *seq)
+{
+	const unsigned char *in = seq->data, *end = seq->data + seq->size;
+	int address = seq->start_addr;
+	int out = 0, cnt, dist, i;
+	u16 word;
+
+	if (seq->codec == SNPS_PACK_LZ &&
+	    (seq->window <= 0 || seq->window > SNPS_PACK_WINDOW_MAX))
+		return -1;
+
+	while (in < end) {
+		if (*in < SNPS_PACK_REP) {
+			/* literal words */
+			cnt = *in++ + 1;
+			if (end - in < 2 * cnt || out + cnt > seq->data_count)
+				return -1;
+			for (i = 0; i < cnt; i++, in += 2, out++) {
+				word = in[0] | (in[1] << 8);
+				snps_pack_window[out & (SNPS_PACK_WINDOW_MAX - 1)] = word;
+				SNPS_STATIC_WRITE(address++, word);
+			}
+			continue;
+		}
+
+		if (end - in < 3)
+			return -1;
+		word = in[1] | (in[2] << 8);
+		if (seq->codec == SNPS_PACK_RLE) {
+			cnt = *in - SNPS_PACK_REP + SNPS_PACK_RLE_MIN;
+			dist = 0;
+		} else {
+			cnt = *in - SNPS_PACK_REP + SNPS_PACK_LZ_MIN;
+			dist = word;
+			if (dist == 0 || dist > seq->window || dist > out)
+				return -1;
+		}
+		in += 3;
+		if (out + cnt > seq->data_count)
+			return -1;
+
+		for (i = 0; i < cnt; i++, out++) {
+			if (dist)
+				word = snps_pack_window[(out - dist) & (SNPS_PACK_WINDOW_MAX - 1)];
+			snps_pack_window[out & (SNPS_PACK_WINDOW_MAX - 1)] = word;
+			SNPS_STATIC_WRITE(address++, word);
+		}
+	}
+
+	if (out != seq->data_count)
+		return -1;
+
+	/* Pad the rest of memory with zeros */
+	for (; address <= seq->end_addr; address++)
+		SNPS_STATIC_WRITE(address, 0x0);
+
+	return 0;
+}
+#endif /* SNPS_PACKED */
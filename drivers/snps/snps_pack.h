@@ -0,0 +1,55 @@
+/* Copyright (c) 2017 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _SNPS_PACK_H_
+#define _SNPS_PACK_H_
+
+/*
+ * packed sequential sections
+ *
+ * with SNPS_PACKED, the sequential imem/dmem sections are linked in packed
+ * form, as generated by tools/snps_pack out of fw/snps_static.o, and are
+ * unpacked on the fly straight into csr writes.
+ * a packed stream is a sequence of tokens; little-endian 16-bit words:
+ * - token < SNPS_PACK_REP: (token + 1) literal words follow
+ * - rle codec, token >= SNPS_PACK_REP:
+ *	the next word repeats (token - SNPS_PACK_REP + SNPS_PACK_RLE_MIN) times
+ * - lz codec, token >= SNPS_PACK_REP:
+ *	(token - SNPS_PACK_REP + SNPS_PACK_LZ_MIN) words are copied from the
+ *	distance in words (16-bit) that follows, within the last window words
+ */
+#define SNPS_PACK_REP		0x80
+#define SNPS_PACK_RLE_MIN	2
+#define SNPS_PACK_LZ_MIN	2
+
+/* unpack window in words; a power of two the packed lz window must fit in */
+#if !defined(SNPS_PACK_WINDOW_MAX)
+#define SNPS_PACK_WINDOW_MAX	1024
+#endif
+
+enum snps_pack_codec {
+	SNPS_PACK_RLE,
+	SNPS_PACK_LZ
+};
+
+struct snps_seq_packed {
+	int start_addr;
+	int end_addr;
+	int data_count;		/* unpacked words */
+	int codec;		/* enum snps_pack_codec */
+	int window;		/* lz window in words */
+	int size;		/* packed bytes */
+	const unsigned char *data;
+};
+
+#if defined(SNPS_PACKED)
+extern const struct snps_seq_packed one_d_imem_packed;
+extern const struct snps_seq_packed one_d_dmem_packed;
+extern const struct snps_seq_packed two_d_imem_packed;
+extern const struct snps_seq_packed two_d_dmem_packed;
+
+int snps_unpack_seq(const struct snps_seq_packed *seq);
+#endif /* SNPS_PACKED */
+
+#endif	/* _SNPS_PACK_H_ */
@@ -290,6 +290,8 @@
 #define PHY_VREF_VAL		0x54
 #define DRAM_TYPE_REG_VAL	((DDR4_UNBUFFERED_VAL & MODULE_TYPE_MASK) << MODULE_TYPE_OFFS)
 #define PHY_VREF_REG_VAL	((PHY_VREF_VAL & MODULE_TYPE_MASK) << VDDQ_PRECENTAGE_OFFS)
+/* phy vref offset of a retried 1D run: +step on the first retry, -step on the next */
+#define PHY_VREF_RETRY_STEP	0x4
 
 #define REG_5400A_1D_2D_PHY_CFG_CSTEST_FAIL	0x5400a /* take from topology */
 #define SLOW_ACCESS_MODE_OFFS	0
@@ -330,6 +332,8 @@
 #define RX2D_TRAIN_OPT_REG_VAL	(((RX2D_DFE_ENA & RX2D_DFE_MASK) << RX2D_DFE_OFFS) | \
 				 ((RX2D_V_STEP_SIZE_1DAC & RX2D_V_STEP_SIZE_MASK) << RX2D_V_STEP_SIZE_OFFS) | \
 				 ((RX2D_DLY_STEP_SIZE_1LCDL & RX2D_DLY_STEP_SIZE_MASK) << RX2D_DLY_STEP_SIZE_OFFS))
+/* rx 2d options of a retried 2D run: no dfe, which may not converge on a marginal eye */
+#define RX2D_TRAIN_OPT_RETRY_VAL	(RX2D_TRAIN_OPT_REG_VAL & ~(RX2D_DFE_MASK << RX2D_DFE_OFFS))
 
 #define REG_5400D_1D_2D_RSRV1B_RSRV1A		0x5400d
 #define RSRV1B_VAL	0x0
@@ -646,3 +646,50 @@ u16 dmem_1d_2d_gear_down_x16_present_get(void)
 
 	return ret_val;
 }
+
+/* hdt ctrl of a training run: a retried run reports coarse debug messages
+ * (e.g. rank information), so that the cause of the failure gets logged;
+ * the retried run's training parameters change as well (see
+ * dmem_2d_hdt_ctrl_get and dmem_1d_dram_type_phy_vref_get) */
+static u16 dmem_hdt_ctrl_get(void)
+{
+	if (gd.retry_count)
+		return (COARSE_MSG_VAL & VERBOSITY_LEVEL_MASK) << VERBOSITY_LEVEL_OFFS;
+
+	return HDT_CTRL_REG_VAL;
+}
+
+u16 dmem_1d_hdt_ctrl_get(void)
+{
+#if defined(SNPS_2D_SKIP)
+	/* the 2D skip decision needs the 1D eye passing regions, which only the
+	 * margins verbosity reports; a retried run keeps its own verbosity and
+	 * never skips 2D (see snps_2d_skip_check) */
+	if (!gd.retry_count)
+		return (DETAILED_MSG_VAL_MARGINS & VERBOSITY_LEVEL_MASK) << VERBOSITY_LEVEL_OFFS;
+#endif
+	return dmem_hdt_ctrl_get();
+}
+
+u16 dmem_2d_hdt_ctrl_get(void)
+{
+	if (gd.retry_count)
+		return dmem_hdt_ctrl_get() | RX2D_TRAIN_OPT_RETRY_VAL;
+
+	return dmem_hdt_ctrl_get() | RX2D_TRAIN_OPT_REG_VAL;
+}
+
+/* dram type & phy vref of a 1D run: a retried run moves the phy vref, which
+ * 1D read training starts from, a step up and then a step down */
+u16 dmem_1d_dram_type_phy_vref_get(void)
+{
+	u16 phy_vref = PHY_VREF_VAL;
+
+	if (gd.retry_count == 1)
+		phy_vref += PHY_VREF_RETRY_STEP;
+	else if (gd.retry_count > 1)
+		phy_vref -= PHY_VREF_RETRY_STEP;
+
+	return (DRAM_TYPE_REG_VAL << BYTE_OFFSET) |
+	       ((phy_vref & MODULE_TYPE_MASK) << VDDQ_PRECENTAGE_OFFS);
+}
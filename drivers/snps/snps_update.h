@@ -32,6 +32,9 @@ u16 dmem_1d_2d_mr6_get(void);	/* TODO get the mrs from data base */
 u16 dmem_1d_2d_rtt_nom_wr_park_get(void);
 u16 dmem_1d_2d_en_dq_dis_dbyte_get(void);
 u16 dmem_1d_2d_gear_down_x16_present_get(void);
+u16 dmem_1d_hdt_ctrl_get(void);
+u16 dmem_2d_hdt_ctrl_get(void);
+u16 dmem_1d_dram_type_phy_vref_get(void);
 
 struct snps_address_data init_phy_static_update[] = {
 	{PHY_REG_ADDR_MAP(P_STATE_0, BLK_TYPE_MASTER, INST_NUM_0, REG_88_PHY_CAL_RATE),
@@ -141,6 +144,8 @@ struct snps_address_dynamic_update one_d_dmem_dynamic_update[] = {
 	{REG_54036_1D_2D_CS_SETUP_GDDEC_X16_PRESENT, dmem_1d_2d_gear_down_x16_present_get},
 	{REG_54037_1D_2D_RTT_NOM_WR_PARK0, dmem_1d_2d_rtt_nom_wr_park_get},
 	{REG_54038_1D_2D_RTT_NOM_WR_PARK1, dmem_1d_2d_rtt_nom_wr_park_get},
+	{REG_5400C_1D_2D_RESV19_HDT_CTRL, dmem_1d_hdt_ctrl_get, SNPS_DYNAMIC_VOLATILE},
+	{REG_54006_1D_2D_DRAM_TYPE_PHY_VREF, dmem_1d_dram_type_phy_vref_get, SNPS_DYNAMIC_VOLATILE},
 	{-1, NULL}
 };
 
@@ -180,6 +185,7 @@ struct snps_address_dynamic_update two_d_dmem_dynamic_update[] = {
 	{REG_54036_1D_2D_CS_SETUP_GDDEC_X16_PRESENT, dmem_1d_2d_gear_down_x16_present_get},
 	{REG_54037_1D_2D_RTT_NOM_WR_PARK0, dmem_1d_2d_rtt_nom_wr_park_get},
 	{REG_54038_1D_2D_RTT_NOM_WR_PARK1, dmem_1d_2d_rtt_nom_wr_park_get},
+	{REG_5400C_1D_2D_RESV19_HDT_CTRL, dmem_2d_hdt_ctrl_get, SNPS_DYNAMIC_VOLATILE},
 	{ -1	, NULL }
 };
 
@@ -344,7 +344,12 @@ int mv_ddr4_calibration_adjust(u32 dev_num, u8 vref_en, u8 pod_only)
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
 				  ("mv_ddr4_calibration_adjust: calibration polling failed (1)\n"));
 
-	mdelay(10); /* TODO: check it */
+	/* re-check calibration done after a settle guard */
+	if (mv_ddr_wait_reg(dev_num, MV_DDR_WAIT_PAD_CAL, ACCESS_TYPE_UNICAST, if_id,
+			    MAIN_PADS_CAL_MACH_CTRL_REG, 0x80000000, 0x80000000,
+			    MV_DDR_PAD_CAL_SETTLE_US, MV_DDR_WAIT_TIMEOUT_US) != MV_OK)
+		DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
+				  ("mv_ddr4_calibration_adjust: calibration settle failed (0)\n"));
 
 	/* disable dynamic */
 	status = ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, if_id, MAIN_PADS_CAL_MACH_CTRL_REG, 0, 0x1);
@@ -363,7 +368,12 @@ int mv_ddr4_calibration_adjust(u32 dev_num, u8 vref_en, u8 pod_only)
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
 				  ("mv_ddr4_calibration_adjust: calibration polling failed (3)\n"));
 
-	mdelay(10); /* TODO: check why polling insufficient */
+	/* re-check calibration done after a settle guard */
+	if (mv_ddr_wait_reg(dev_num, MV_DDR_WAIT_PAD_CAL, ACCESS_TYPE_UNICAST, if_id,
+			    MAIN_PADS_CAL_MACH_CTRL_REG, 0x80000000, 0x80000000,
+			    MV_DDR_PAD_CAL_SETTLE_US, MV_DDR_WAIT_TIMEOUT_US) != MV_OK)
+		DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
+				  ("mv_ddr4_calibration_adjust: calibration settle failed (1)\n"));
 
 	/* read calibration value and set it manually */
 	status = ddr3_tip_if_read(dev_num, ACCESS_TYPE_UNICAST, if_id, 0x1dc8, read_data, MASK_ALL_BITS);
@@ -501,7 +511,7 @@ int mv_ddr4_training_main_flow(u32 dev_num)
 	u16 pbs_tap_factor[MAX_INTERFACE_NUM][MAX_BUS_NUM][BUS_WIDTH_IN_BITS] = {0};
 
 	if (mask_tune_func & RECEIVER_CALIBRATION_MASK_BIT) {
-		training_stage = RECEIVER_CALIBRATION;
+		mv_ddr_training_stage_set(RECEIVER_CALIBRATION);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("RECEIVER_CALIBRATION_MASK_BIT #%d\n", effective_cs));
 		status = mv_ddr4_receiver_calibration(dev_num);
 		if (is_reg_dump != 0)
@@ -514,7 +524,7 @@ int mv_ddr4_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & WL_PHASE_CORRECTION_MASK_BIT) {
-		training_stage = WL_PHASE_CORRECTION;
+		mv_ddr_training_stage_set(WL_PHASE_CORRECTION);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("WL_PHASE_CORRECTION_MASK_BIT #%d\n", effective_cs));
 		status = mv_ddr4_dynamic_wl_supp(dev_num);
 		if (is_reg_dump != 0)
@@ -527,7 +537,7 @@ int mv_ddr4_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & DQ_VREF_CALIBRATION_MASK_BIT) {
-		training_stage = DQ_VREF_CALIBRATION;
+		mv_ddr_training_stage_set(DQ_VREF_CALIBRATION);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("DQ_VREF_CALIBRATION_MASK_BIT #%d\n", effective_cs));
 		status = mv_ddr4_dq_vref_calibration(dev_num, pbs_tap_factor);
 		if (is_reg_dump != 0)
@@ -540,7 +550,7 @@ int mv_ddr4_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & DM_TUNING_MASK_BIT) {
-		training_stage = DM_TUNING;
+		mv_ddr_training_stage_set(DM_TUNING);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("DM_TUNING_MASK_BIT #%d\n", effective_cs));
 		status = mv_ddr4_dm_tuning(effective_cs, pbs_tap_factor);
 		if (is_reg_dump != 0)
@@ -553,7 +563,7 @@ int mv_ddr4_training_main_flow(u32 dev_num)
 	}
 
 	if (mask_tune_func & DQ_MAPPING_MASK_BIT) {
-		training_stage = DQ_MAPPING;
+		mv_ddr_training_stage_set(DQ_MAPPING);
 		DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO, ("DQ_MAPPING_MASK_BIT\n"));
 		status = mv_ddr4_dq_pins_mapping(dev_num);
 		if (is_reg_dump != 0)
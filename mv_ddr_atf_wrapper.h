@@ -138,6 +138,15 @@ typedef unsigned int u32;
 /* memcpy function */
 #include <lib/mmio.h>
 
+/* generic timer access */
+#include <arch_helpers.h>
+
+/* free running time base, in microseconds */
+#define mv_ddr_time_us()	((u32)(read_cntpct_el0() / (read_cntfrq_el0() / 1000000)))
+/* free running counter and its frequency, in hz */
+#define mv_ddr_time_ticks()	((u32)read_cntpct_el0())
+#define mv_ddr_time_ticks_hz()	((u32)read_cntfrq_el0())
+
 /*
  * Accessor functions for the registers
  */
@@ -52,3 +52,33 @@ int round_div(unsigned int dividend, unsigned int divisor, unsigned int *quotien
 
 	return MV_OK;
 }
+
+/* crc32 (ieee 802.3, reflected) of buf, continuing from crc */
+unsigned int mv_ddr_crc32(unsigned int crc, const unsigned char *buf, unsigned int len)
+{
+	unsigned int i, bit;
+
+	crc = ~crc;
+	for (i = 0; i < len; i++) {
+		crc ^= buf[i];
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 0x1)));
+	}
+
+	return ~crc;
+}
+
+/* crc32c (castagnoli, reflected) of buf, continuing from crc; as the xor v2 dma engines take it */
+unsigned int mv_ddr_crc32c(unsigned int crc, const unsigned char *buf, unsigned int len)
+{
+	unsigned int i, bit;
+
+	crc = ~crc;
+	for (i = 0; i < len; i++) {
+		crc ^= buf[i];
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0x82f63b78 & (0 - (crc & 0x1)));
+	}
+
+	return ~crc;
+}
@@ -49,5 +49,7 @@ void mv_ddr_ver_print(void);
 unsigned int ceil_div(unsigned int x, unsigned int y);
 unsigned int time_to_nclk(unsigned int t, unsigned int tclk);
 int round_div(unsigned int dividend, unsigned int divisor, unsigned int *quotient);
+unsigned int mv_ddr_crc32(unsigned int crc, const unsigned char *buf, unsigned int len);
+unsigned int mv_ddr_crc32c(unsigned int crc, const unsigned char *buf, unsigned int len);
 
 #endif /* _MV_DDR_COMMON_H */
@@ -0,0 +1,428 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_MEM_TEST)
+
+/* post-training dma memory test */
+
+#include "mv_ddr_atf_wrapper.h"
+#include "mv_ddr_plat.h"
+#include "ddr_topology_def.h"
+#include "mv_ddr_xor_v2.h"
+#include "mv_ddr_mem_test.h"
+
+/* the compare reference is at the start of dram, below the non-dram memory region */
+#define MEM_TEST_REF_ADDR		0
+#define MEM_TEST_BATCH_BLOCKS		(MV_DDR_MEM_TEST_DMA_NUM * MV_DDR_MEM_TEST_DESC_NUM)
+#define MEM_TEST_FAIL_PRINT_MAX		16
+/* a cs may be split by the non-dram memory region */
+#define MEM_TEST_RGN_MAX		(2 * MAX_CS_NUM)
+
+enum mem_test_val {
+	MEM_TEST_NONE,
+	MEM_TEST_PAT,		/* pass pattern */
+	MEM_TEST_INV		/* inverted pass pattern */
+};
+
+enum mem_test_data {
+	MEM_TEST_DATA_SOLID,	/* all zeros */
+	MEM_TEST_DATA_WALK,	/* a single one bit per pattern */
+	MEM_TEST_DATA_MOVING,	/* a one bit per byte, moved by a bit per pattern */
+	MEM_TEST_DATA_ADDR	/* block address; word address for the cpu sub-pass */
+};
+
+/* march element: compare each batch of blocks with rd, then write wr to it */
+struct mem_test_elem {
+	int down;		/* descending address order */
+	enum mem_test_val rd;
+	enum mem_test_val wr;
+};
+
+/* {w0}; up {r0, w1}; up {r1, w0}; down {r0, w1}; down {r1, w0}; {r0} */
+static const struct mem_test_elem mem_test_march_c[] = {
+	{0, MEM_TEST_NONE, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_INV},
+	{0, MEM_TEST_INV, MEM_TEST_PAT},
+	{1, MEM_TEST_PAT, MEM_TEST_INV},
+	{1, MEM_TEST_INV, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_NONE}
+};
+
+/* {w0}; {r0, w1}; {r1} */
+static const struct mem_test_elem mem_test_walk[] = {
+	{0, MEM_TEST_NONE, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_INV},
+	{0, MEM_TEST_INV, MEM_TEST_NONE}
+};
+
+/* {w0}; up {r0, w1}; down {r1} */
+static const struct mem_test_elem mem_test_addr[] = {
+	{0, MEM_TEST_NONE, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_INV},
+	{1, MEM_TEST_INV, MEM_TEST_NONE}
+};
+
+/* {w0}; up {r0, w1}; down {r1, w0}; {r0} */
+static const struct mem_test_elem mem_test_moving[] = {
+	{0, MEM_TEST_NONE, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_INV},
+	{1, MEM_TEST_INV, MEM_TEST_PAT},
+	{0, MEM_TEST_PAT, MEM_TEST_NONE}
+};
+
+static const struct mem_test_pass {
+	const char *name;
+	const struct mem_test_elem *elem;
+	u32 elem_num;
+	enum mem_test_data data;
+	u32 pat_num[2];		/* per enum mv_ddr_mem_test_profile */
+} mem_test_passes[] = {
+	{"march c-", mem_test_march_c, sizeof(mem_test_march_c) / sizeof(mem_test_march_c[0]),
+	 MEM_TEST_DATA_SOLID, {1, 1}},
+	{"walking ones/zeros", mem_test_walk, sizeof(mem_test_walk) / sizeof(mem_test_walk[0]),
+	 MEM_TEST_DATA_WALK, {64, 64}},
+	{"address", mem_test_addr, sizeof(mem_test_addr) / sizeof(mem_test_addr[0]),
+	 MEM_TEST_DATA_ADDR, {1, 1}},
+	{"moving inversions", mem_test_moving, sizeof(mem_test_moving) / sizeof(mem_test_moving[0]),
+	 MEM_TEST_DATA_MOVING, {1, 8}}
+};
+
+/* tested memory regions in cpu address space */
+static struct {
+	uint64_t start[MEM_TEST_RGN_MAX];
+	uint64_t size[MEM_TEST_RGN_MAX];
+	u32 cs[MEM_TEST_RGN_MAX];
+	u32 rgn_num;
+	u32 fail_print;
+} mem_test;
+
+static void mem_test_rgn_add(u32 cs, uint64_t start, uint64_t size)
+{
+	if (size == 0)
+		return;
+
+	mem_test.start[mem_test.rgn_num] = start;
+	mem_test.size[mem_test.rgn_num] = size;
+	mem_test.cs[mem_test.rgn_num] = cs;
+	mem_test.rgn_num++;
+}
+
+/* set test regions to the first limit bytes of each cs; returns their total size */
+static uint64_t mem_test_rgns_set(uint64_t limit)
+{
+	uint64_t cs_size = mv_ddr_mem_sz_per_cs_get();
+	uint64_t offs, size, end, total = 0;
+	u32 cs, cs_num = mv_ddr_cs_num_get();
+
+	mem_test.rgn_num = 0;
+	for (cs = 0; cs < cs_num; cs++) {
+		offs = cs * cs_size;
+		size = cs_size;
+		if (cs == 0) {
+			/* skip the compare reference */
+			offs += MV_DDR_MEM_TEST_REF_SIZE;
+			size -= MV_DDR_MEM_TEST_REF_SIZE;
+		}
+		if (size > limit)
+			size = limit;
+		size &= ~(uint64_t)(MV_DDR_MEM_TEST_BLOCK_SIZE - 1);
+		end = offs + size;
+		total += size;
+
+		/* dram up to non-dram memory region, and the rest of it remapped above */
+		if (offs < NON_DRAM_MEM_RGN_START_ADDR)
+			mem_test_rgn_add(cs, offs, ((end < NON_DRAM_MEM_RGN_START_ADDR) ?
+					 end : NON_DRAM_MEM_RGN_START_ADDR) - offs);
+		if (end > NON_DRAM_MEM_RGN_START_ADDR) {
+			if (offs < NON_DRAM_MEM_RGN_START_ADDR)
+				offs = NON_DRAM_MEM_RGN_START_ADDR;
+			mem_test_rgn_add(cs, offs + NON_DRAM_MEM_RGN_END_ADDR - NON_DRAM_MEM_RGN_START_ADDR,
+					 end - offs);
+		}
+	}
+
+	return total;
+}
+
+static uint64_t mem_test_pat_get(enum mem_test_data data, u32 pat_id)
+{
+	switch (data) {
+	case MEM_TEST_DATA_WALK:
+		return 1ULL << pat_id;
+	case MEM_TEST_DATA_MOVING:
+		return 0x0101010101010101ULL << pat_id;
+	default:
+		return 0;
+	}
+}
+
+/*
+ * set or compare blk_num consecutive blocks from base, spread over the dma
+ * engines; block n of the batch holds data plus n times data_step.
+ * returns the number of failed blocks or -1 on a dma error
+ */
+static int mem_test_batch(int cmp, uint64_t base, u32 blk_num, uint64_t data, uint64_t data_step,
+			  const char *name, u32 cs)
+{
+	uint64_t dst[2][MV_DDR_MEM_TEST_DMA_NUM], ref[2][MV_DDR_MEM_TEST_DMA_NUM];
+	uint64_t val[2][MV_DDR_MEM_TEST_DMA_NUM];
+	u32 blk[2][MV_DDR_MEM_TEST_DMA_NUM], desc_num[2], dma_num[2];
+	u32 fail_map[MV_DDR_MEM_TEST_DMA_NUM][MV_DDR_DMA_FAIL_MAP_WORDS];
+	u32 part, dma_id, i;
+	int seq = (data_step != 0);
+	int fail_cnt;
+
+	/* part 0: an equal share of blocks per dma engine; part 1: a block per engine for the rest */
+	desc_num[0] = blk_num / MV_DDR_MEM_TEST_DMA_NUM;
+	dma_num[0] = desc_num[0] ? MV_DDR_MEM_TEST_DMA_NUM : 0;
+	desc_num[1] = 1;
+	dma_num[1] = blk_num % MV_DDR_MEM_TEST_DMA_NUM;
+	for (dma_id = 0; dma_id < MV_DDR_MEM_TEST_DMA_NUM; dma_id++) {
+		blk[0][dma_id] = dma_id * desc_num[0];
+		blk[1][dma_id] = MV_DDR_MEM_TEST_DMA_NUM * desc_num[0] + dma_id;
+		for (part = 0; part < 2; part++) {
+			dst[part][dma_id] = base + (uint64_t)blk[part][dma_id] * MV_DDR_MEM_TEST_BLOCK_SIZE;
+			val[part][dma_id] = data + data_step * blk[part][dma_id];
+			/* a reference block per compared block, or a single one per engine for solid data */
+			ref[part][dma_id] = MEM_TEST_REF_ADDR +
+					    (uint64_t)dma_id * MV_DDR_MEM_TEST_DESC_NUM * MV_DDR_MEM_TEST_BLOCK_SIZE +
+					    ((part && seq) ? (uint64_t)desc_num[0] * MV_DDR_MEM_TEST_BLOCK_SIZE : 0);
+		}
+	}
+
+	if (!cmp) {
+		for (part = 0; part < 2; part++)
+			if (dma_num[part] &&
+			    mv_ddr_dma_session_memset(dst[part], MV_DDR_MEM_TEST_BLOCK_SIZE, dma_num[part],
+						      desc_num[part], val[part], data_step))
+				return -1;
+		return (mv_ddr_dma_session_wait() < 0) ? -1 : 0;
+	}
+
+	/* write the reference first; the dma engines compare memory regions */
+	if (seq) {
+		for (part = 0; part < 2; part++)
+			if (dma_num[part] &&
+			    mv_ddr_dma_session_memset(ref[part], MV_DDR_MEM_TEST_BLOCK_SIZE, dma_num[part],
+						      desc_num[part], val[part], data_step))
+				return -1;
+	} else if (mv_ddr_dma_session_memset(ref[0], MV_DDR_MEM_TEST_BLOCK_SIZE,
+					     MV_DDR_MEM_TEST_DMA_NUM, 1, val[0], 0)) {
+		return -1;
+	}
+	if (mv_ddr_dma_session_wait() < 0)
+		return -1;
+
+	for (part = 0; part < 2; part++) {
+		if (dma_num[part] == 0)
+			continue;
+		if (seq ? mv_ddr_dma_session_memcmp_seq(ref[part], dst[part], MV_DDR_MEM_TEST_BLOCK_SIZE,
+							dma_num[part], desc_num[part]) :
+			  mv_ddr_dma_session_memcmp(ref[part], dst[part], MV_DDR_MEM_TEST_BLOCK_SIZE,
+						    dma_num[part], desc_num[part]))
+			return -1;
+	}
+	fail_cnt = mv_ddr_dma_session_wait_map(fail_map);
+	if (fail_cnt <= 0)
+		return fail_cnt;
+
+	for (dma_id = 0; dma_id < MV_DDR_MEM_TEST_DMA_NUM; dma_id++) {
+		for (i = 0; i < desc_num[0] + (dma_id < dma_num[1]); i++) {
+			if (!(fail_map[dma_id][i / 32] & (1u << (i % 32))))
+				continue;
+			if (mem_test.fail_print++ < MEM_TEST_FAIL_PRINT_MAX)
+				printf("mv_ddr: mem test: %s: fail at 0x%llx, cs %d\n", name,
+				       (unsigned long long)(i < desc_num[0] ? dst[0][dma_id] +
+				       (uint64_t)i * MV_DDR_MEM_TEST_BLOCK_SIZE : dst[1][dma_id]), cs);
+		}
+	}
+
+	return fail_cnt;
+}
+
+/* data of a batch's first block and its increment per block */
+static void mem_test_data_get(enum mem_test_data data, enum mem_test_val val, uint64_t pat,
+			      uint64_t base, uint64_t *first, uint64_t *step)
+{
+	if (data == MEM_TEST_DATA_ADDR) {
+		/* each block holds its own address or its inverse */
+		*first = (val == MEM_TEST_INV) ? ~base : base;
+		*step = (val == MEM_TEST_INV) ? -(uint64_t)MV_DDR_MEM_TEST_BLOCK_SIZE :
+						MV_DDR_MEM_TEST_BLOCK_SIZE;
+	} else {
+		*first = (val == MEM_TEST_INV) ? ~pat : pat;
+		*step = 0;
+	}
+}
+
+/*
+ * run a march element over the test regions, a batch of blocks at a time;
+ * a descending element takes the batches from the top, while the blocks
+ * within a batch ascend. returns the number of failed blocks or -1
+ */
+static int mem_test_elem_run(const struct mem_test_pass *pass, const struct mem_test_elem *elem,
+			     uint64_t pat)
+{
+	uint64_t base, first, step;
+	u32 i, rgn_id, blk_id, blk_num, cnt;
+	int fail_cnt = 0, ret;
+
+	for (i = 0; i < mem_test.rgn_num; i++) {
+		rgn_id = elem->down ? mem_test.rgn_num - 1 - i : i;
+		blk_num = mem_test.size[rgn_id] / MV_DDR_MEM_TEST_BLOCK_SIZE;
+		for (blk_id = 0; blk_id < blk_num; blk_id += cnt) {
+			cnt = blk_num - blk_id;
+			if (cnt > MEM_TEST_BATCH_BLOCKS)
+				cnt = MEM_TEST_BATCH_BLOCKS;
+			base = mem_test.start[rgn_id] + (uint64_t)(elem->down ? blk_num - blk_id - cnt : blk_id) *
+			       MV_DDR_MEM_TEST_BLOCK_SIZE;
+
+			if (elem->rd != MEM_TEST_NONE) {
+				mem_test_data_get(pass->data, elem->rd, pat, base, &first, &step);
+				ret = mem_test_batch(1, base, cnt, first, step, pass->name, mem_test.cs[rgn_id]);
+				if (ret < 0)
+					return -1;
+				fail_cnt += ret;
+			}
+
+			if (elem->wr != MEM_TEST_NONE) {
+				mem_test_data_get(pass->data, elem->wr, pat, base, &first, &step);
+				if (mem_test_batch(0, base, cnt, first, step, pass->name, mem_test.cs[rgn_id]))
+					return -1;
+			}
+		}
+	}
+
+	return fail_cnt;
+}
+
+/*
+ * cpu sub-pass of the address pass: the dma engines fill a block with a single
+ * value, so the address bits below the block size are tested here instead;
+ * each block gets its own address written to the words at offset 0 and at every
+ * power of two offset, which are then read back to find aliased addresses.
+ * returns the number of failed blocks
+ */
+static int mem_test_addr_cpu_run(const char *name)
+{
+	uint64_t base, offs;
+	u32 rgn_id, blk_id, blk_num;
+	int fail, fail_cnt = 0;
+
+	for (rgn_id = 0; rgn_id < mem_test.rgn_num; rgn_id++) {
+		blk_num = mem_test.size[rgn_id] / MV_DDR_MEM_TEST_BLOCK_SIZE;
+		for (blk_id = 0; blk_id < blk_num; blk_id++) {
+			base = mem_test.start[rgn_id] + (uint64_t)blk_id * MV_DDR_MEM_TEST_BLOCK_SIZE;
+
+			writeq(base, base);
+			for (offs = sizeof(uint64_t); offs < MV_DDR_MEM_TEST_BLOCK_SIZE; offs <<= 1)
+				writeq(base + offs, base + offs);
+
+			fail = (readq(base) != base);
+			for (offs = sizeof(uint64_t); offs < MV_DDR_MEM_TEST_BLOCK_SIZE; offs <<= 1)
+				if (readq(base + offs) != base + offs)
+					fail = 1;
+
+			if (!fail)
+				continue;
+			fail_cnt++;
+			if (mem_test.fail_print++ < MEM_TEST_FAIL_PRINT_MAX)
+				printf("mv_ddr: mem test: %s: cpu fail at 0x%llx, cs %d\n", name,
+				       (unsigned long long)base, mem_test.cs[rgn_id]);
+		}
+	}
+
+	return fail_cnt;
+}
+
+/* decimal units: bytes per microsecond is MB/s */
+static void mem_test_rate_print(const char *name, uint64_t bytes, u32 elapsed_us, int fail_cnt)
+{
+	printf("mv_ddr: mem test: %s: %d fails", name, fail_cnt);
+	if (elapsed_us)
+		printf(", %d MB in %d ms, %d.%02d GB/s", (u32)(bytes / 1000000), elapsed_us / 1000,
+		       (u32)(bytes / elapsed_us / 1000), (u32)(bytes / elapsed_us / 10 % 100));
+	printf("\n");
+}
+
+/* returns the number of failed blocks or -1 */
+static int mem_test_pass_run(const struct mem_test_pass *pass, enum mv_ddr_mem_test_profile profile,
+			     u32 start_us)
+{
+	uint64_t size, bytes = 0;
+	u32 pat_id, elem_id, pass_us, elapsed_us;
+	int fail_cnt = 0, ret;
+
+	if (pass->data == MEM_TEST_DATA_WALK)
+		size = mem_test_rgns_set(MV_DDR_MEM_TEST_WALK_SIZE);
+	else if (profile == MV_DDR_MEM_TEST_QUICK)
+		size = mem_test_rgns_set(MV_DDR_MEM_TEST_QUICK_SIZE);
+	else
+		size = mem_test_rgns_set(~0ULL);
+
+	pass_us = mv_ddr_time_us();
+	for (pat_id = 0; pat_id < pass->pat_num[profile]; pat_id++) {
+		if (profile == MV_DDR_MEM_TEST_QUICK &&
+		    mv_ddr_time_us() - start_us > MV_DDR_MEM_TEST_QUICK_US) {
+			printf("mv_ddr: mem test: %s: time limit reached after %d of %d patterns\n",
+			       pass->name, pat_id, pass->pat_num[profile]);
+			if (pat_id == 0)
+				return 0;
+			break;
+		}
+
+		for (elem_id = 0; elem_id < pass->elem_num; elem_id++) {
+			ret = mem_test_elem_run(pass, &pass->elem[elem_id],
+						mem_test_pat_get(pass->data, pat_id));
+			if (ret < 0)
+				return -1;
+			fail_cnt += ret;
+			bytes += size * ((pass->elem[elem_id].rd != MEM_TEST_NONE) +
+					 (pass->elem[elem_id].wr != MEM_TEST_NONE));
+		}
+	}
+
+	elapsed_us = mv_ddr_time_us() - pass_us;
+	if (pass->data == MEM_TEST_DATA_ADDR)
+		fail_cnt += mem_test_addr_cpu_run(pass->name);
+
+	/* dma bandwidth, w/o the cpu sub-pass */
+	mem_test_rate_print(pass->name, bytes, elapsed_us, fail_cnt);
+
+	return fail_cnt;
+}
+
+int mv_ddr_mem_test(enum mv_ddr_mem_test_profile profile)
+{
+	u32 pass_id, start_us = mv_ddr_time_us();
+	int fail_cnt = 0, ret;
+
+	printf("mv_ddr: %s mem test...\n", (profile == MV_DDR_MEM_TEST_QUICK) ? "quick" : "full");
+
+	if (mv_ddr_dma_session_open(MV_DDR_MEM_TEST_DMA_NUM))
+		return MV_FAIL;
+
+	mem_test.fail_print = 0;
+	for (pass_id = 0; pass_id < sizeof(mem_test_passes) / sizeof(mem_test_passes[0]); pass_id++) {
+		ret = mem_test_pass_run(&mem_test_passes[pass_id], profile, start_us);
+		if (ret < 0) {
+			printf("mv_ddr: mem test: dma error\n");
+			fail_cnt = -1;
+			break;
+		}
+		fail_cnt += ret;
+	}
+
+	mv_ddr_dma_session_close();
+
+	if (fail_cnt) {
+		printf("mv_ddr: mem test failed\n");
+		return MV_FAIL;
+	}
+
+	printf("mv_ddr: mem test passed in %d ms\n", (mv_ddr_time_us() - start_us) / 1000);
+
+	return MV_OK;
+}
+#endif /* MV_DDR_MEM_TEST */
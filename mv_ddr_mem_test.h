@@ -0,0 +1,53 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_MEM_TEST_H
+#define _MV_DDR_MEM_TEST_H
+
+#if defined(MV_DDR_MEM_TEST)
+/*
+ * post-training memory test
+ *
+ * march c-, walking ones/zeros, address-in-address and moving inversions
+ * passes run on the xor v2 dma engines over the memory of every cs; a pass
+ * fills and compares memory in blocks of MV_DDR_MEM_TEST_BLOCK_SIZE, so the
+ * march elements and the address pattern work at block granularity; the
+ * address bits below the block size are tested by a cpu sub-pass that writes
+ * and reads back the words at offset 0 and at power of two offsets in every
+ * block, so the other words of a block are not checked for aliasing. the
+ * compare reference is kept in the first MV_DDR_MEM_TEST_REF_SIZE bytes of
+ * dram, which are not tested. each pass reports its bandwidth; the quick
+ * profile tests the first MV_DDR_MEM_TEST_QUICK_SIZE bytes of each cs and
+ * stops starting passes after MV_DDR_MEM_TEST_QUICK_US.
+ */
+#define MV_DDR_MEM_TEST_BLOCK_SIZE	0x4000
+/* blocks per dma engine and batch, up to the dma descriptors queue size */
+#define MV_DDR_MEM_TEST_DESC_NUM	128
+#define MV_DDR_MEM_TEST_DMA_NUM		4
+#define MV_DDR_MEM_TEST_REF_SIZE	\
+	(MV_DDR_MEM_TEST_DMA_NUM * MV_DDR_MEM_TEST_DESC_NUM * MV_DDR_MEM_TEST_BLOCK_SIZE)
+/* walking ones/zeros run 64 patterns over this size per cs */
+#define MV_DDR_MEM_TEST_WALK_SIZE	0x40000
+
+#if !defined(MV_DDR_MEM_TEST_QUICK_SIZE)
+#define MV_DDR_MEM_TEST_QUICK_SIZE	0x1000000
+#endif
+#if !defined(MV_DDR_MEM_TEST_QUICK_US)
+#define MV_DDR_MEM_TEST_QUICK_US	500000
+#endif
+
+enum mv_ddr_mem_test_profile {
+	MV_DDR_MEM_TEST_QUICK,
+	MV_DDR_MEM_TEST_FULL
+};
+
+/* profile run on every boot; platforms with a memory check request run the full one */
+#if !defined(MV_DDR_MEM_TEST_PROFILE)
+#define MV_DDR_MEM_TEST_PROFILE		MV_DDR_MEM_TEST_QUICK
+#endif
+
+int mv_ddr_mem_test(enum mv_ddr_mem_test_profile profile);
+#endif /* MV_DDR_MEM_TEST */
+
+#endif /* _MV_DDR_MEM_TEST_H */
@@ -0,0 +1,168 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* phy write batching with broadcast coalescing */
+
+#include "ddr3_init.h"
+
+#if defined(MV_DDR_PHY_BATCH)
+
+struct mv_ddr_phy_batch_slot {
+	u32 reg_addr;
+	enum hws_ddr_phy phy_type;
+	u32 phy_mask;			/* subphys written */
+	u32 data[MAX_BUS_NUM];
+};
+
+static struct mv_ddr_phy_batch_slot batch_slot[MV_DDR_PHY_BATCH_SLOTS];
+static u32 batch_slots_num;
+static int batch_ena, batch_flushing;
+static struct mv_ddr_phy_batch_stats batch_stats;
+
+int mv_ddr_phy_batch_is_active(void)
+{
+	return batch_ena && !batch_flushing;
+}
+
+int mv_ddr_phy_batch_is_pending(void)
+{
+	return batch_slots_num != 0 && !batch_flushing;
+}
+
+int mv_ddr_phy_batch_start(u32 dev_num)
+{
+	/* batches do not nest; complete a batch left open by an error path */
+	if (batch_ena)
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+
+	batch_ena = 1;
+
+	return MV_OK;
+}
+
+int mv_ddr_phy_batch_end(u32 dev_num, int status)
+{
+	int ret;
+
+	ret = mv_ddr_phy_batch_flush(dev_num);
+	batch_ena = 0;
+
+	return (status != MV_OK) ? status : ret;
+}
+
+/*
+ * check whether a slot holds the same value for all data subphys;
+ * a broadcast write reaches every subphy, so a slot is not coalesced
+ * while any subphy is masked out of bus_act_mask
+ */
+static int mv_ddr_phy_batch_is_bcast(struct mv_ddr_phy_batch_slot *slot, u32 octets_per_if_num,
+				     u32 bus_act_mask)
+{
+	u32 phy, first = 1, data = 0;
+
+	if (slot->phy_type != DDR_PHY_DATA)
+		return 0;
+
+	for (phy = 0; phy < octets_per_if_num; phy++) {
+		if (IS_ACTIVE(bus_act_mask, phy) == 0)
+			return 0;
+		if (!(slot->phy_mask & (1 << phy)))
+			return 0;
+		if (first) {
+			data = slot->data[phy];
+			first = 0;
+		} else if (slot->data[phy] != data) {
+			return 0;
+		}
+	}
+
+	return !first;
+}
+
+int mv_ddr_phy_batch_flush(u32 dev_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	struct mv_ddr_phy_batch_slot *slot;
+	u32 i, phy, first_phy;
+	int status = MV_OK;
+
+	if (batch_slots_num == 0 || batch_flushing)
+		return MV_OK;
+
+	batch_flushing = 1;
+	for (i = 0; i < batch_slots_num && status == MV_OK; i++) {
+		slot = &batch_slot[i];
+		if (mv_ddr_phy_batch_is_bcast(slot, octets_per_if_num, tm->bus_act_mask)) {
+			for (first_phy = 0; !(slot->phy_mask & (1 << first_phy)); first_phy++)
+				;
+			status = ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+						    ACCESS_TYPE_MULTICAST, PARAM_NOT_CARE,
+						    slot->phy_type, slot->reg_addr,
+						    slot->data[first_phy]);
+			batch_stats.bcast++;
+			continue;
+		}
+
+		for (phy = 0; phy < MAX_BUS_NUM && status == MV_OK; phy++) {
+			if (!(slot->phy_mask & (1 << phy)))
+				continue;
+			status = ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, 0,
+						    ACCESS_TYPE_UNICAST, phy,
+						    slot->phy_type, slot->reg_addr,
+						    slot->data[phy]);
+			batch_stats.ucast++;
+		}
+	}
+	batch_slots_num = 0;
+	batch_flushing = 0;
+
+	return status;
+}
+
+/* queue a unicast phy write */
+int mv_ddr_phy_batch_add(u32 dev_num, u32 phy, enum hws_ddr_phy phy_type,
+			 u32 reg_addr, u32 data)
+{
+	struct mv_ddr_phy_batch_slot *slot = NULL;
+	u32 i;
+
+	if (phy >= MAX_BUS_NUM)
+		return MV_BAD_PARAM;
+
+	for (i = 0; i < batch_slots_num; i++) {
+		if (batch_slot[i].reg_addr == reg_addr &&
+		    batch_slot[i].phy_type == phy_type) {
+			slot = &batch_slot[i];
+			break;
+		}
+	}
+
+	/* a rewrite of the same subphy register must keep its order */
+	if (slot != NULL && (slot->phy_mask & (1 << phy))) {
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+		slot = NULL;
+	}
+
+	if (slot == NULL) {
+		if (batch_slots_num == MV_DDR_PHY_BATCH_SLOTS)
+			CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+		slot = &batch_slot[batch_slots_num++];
+		slot->reg_addr = reg_addr;
+		slot->phy_type = phy_type;
+		slot->phy_mask = 0;
+	}
+
+	slot->phy_mask |= (1 << phy);
+	slot->data[phy] = data;
+	batch_stats.queued++;
+
+	return MV_OK;
+}
+
+struct mv_ddr_phy_batch_stats *mv_ddr_phy_batch_stats_get(void)
+{
+	return &batch_stats;
+}
+#endif /* MV_DDR_PHY_BATCH */
@@ -0,0 +1,47 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_PHY_BATCH_H
+#define _MV_DDR_PHY_BATCH_H
+
+/*
+ * phy write batching
+ *
+ * when built with MV_DDR_PHY_BATCH, unicast phy writes issued thru
+ * ddr3_tip_bus_write() between mv_ddr_phy_batch_start() and
+ * mv_ddr_phy_batch_end() are queued per register; on flush, a data phy
+ * register written with the same value to all subphys, while all of them
+ * are active, is programmed with a single broadcast write.
+ * the queue is flushed before any phy read or dunit access, before a
+ * subphy register is rewritten and when the queue is full. a flush walks
+ * the registers in the order they were queued, and the subphys of each one
+ * in index order, so writes to different subphys may be reordered; writes
+ * to one subphy register keep their order.
+ * mv_ddr_phy_batch_end() gets the status of the writes issued in the batch,
+ * so a batch is closed on error paths too, and returns the first failure.
+ */
+#define MV_DDR_PHY_BATCH_SLOTS	16
+
+struct mv_ddr_phy_batch_stats {
+	u32 queued;	/* writes queued */
+	u32 bcast;	/* broadcast writes issued */
+	u32 ucast;	/* unicast writes issued */
+};
+
+#if defined(MV_DDR_PHY_BATCH)
+int mv_ddr_phy_batch_start(u32 dev_num);
+int mv_ddr_phy_batch_end(u32 dev_num, int status);
+int mv_ddr_phy_batch_flush(u32 dev_num);
+int mv_ddr_phy_batch_add(u32 dev_num, u32 phy, enum hws_ddr_phy phy_type,
+			 u32 reg_addr, u32 data);
+int mv_ddr_phy_batch_is_active(void);
+int mv_ddr_phy_batch_is_pending(void);
+struct mv_ddr_phy_batch_stats *mv_ddr_phy_batch_stats_get(void);
+#else /* !MV_DDR_PHY_BATCH */
+#define mv_ddr_phy_batch_start(dev_num)		MV_OK
+#define mv_ddr_phy_batch_end(dev_num, status)	(status)
+#define mv_ddr_phy_batch_flush(dev_num)		MV_OK
+#endif /* MV_DDR_PHY_BATCH */
+
+#endif /* _MV_DDR_PHY_BATCH_H */
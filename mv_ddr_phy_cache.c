@@ -0,0 +1,197 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_PHY_CACHE)
+
+/* phy register read cache */
+
+#include "ddr3_init.h"
+#include "mv_ddr_regs.h"
+
+#define PHY_CACHE_TYPES		2
+#define PHY_CACHE_VALID_WORDS	(MV_DDR_PHY_CACHE_REGS / 32)
+
+static u16 phy_cache_val[PHY_CACHE_TYPES][MAX_BUS_NUM][MV_DDR_PHY_CACHE_REGS];
+static u32 phy_cache_valid[PHY_CACHE_TYPES][MAX_BUS_NUM][PHY_CACHE_VALID_WORDS];
+static int phy_cache_ena;
+static struct mv_ddr_phy_cache_stats phy_cache_stats;
+
+/* registers updated by hardware are never cached */
+static int mv_ddr_phy_cache_is_volatile(enum hws_ddr_phy phy_type, u32 reg_addr)
+{
+	if (phy_type != DDR_PHY_DATA)
+		return 0;
+
+	if (reg_addr >= RESULT_PHY_REG && reg_addr < RESULT_PHY_REG + 0x10)
+		return 1;
+
+	if (reg_addr == TEST_ADLL_PHY_REG)
+		return 1;
+
+	return 0;
+}
+
+static int mv_ddr_phy_cache_is_valid(u32 type, u32 phy, u32 reg_addr)
+{
+	return (phy_cache_valid[type][phy][reg_addr / 32] >> (reg_addr % 32)) & 0x1;
+}
+
+static void mv_ddr_phy_cache_set(u32 type, u32 phy, u32 reg_addr, u32 data)
+{
+	phy_cache_val[type][phy][reg_addr] = (u16)data;
+	phy_cache_valid[type][phy][reg_addr / 32] |= ((u32)1 << (reg_addr % 32));
+}
+
+static void mv_ddr_phy_cache_clr(u32 type, u32 phy, u32 reg_addr)
+{
+	phy_cache_valid[type][phy][reg_addr / 32] &= ~((u32)1 << (reg_addr % 32));
+}
+
+/*
+ * a write to a pbs or vref broadcast register also updates the per-bit
+ * registers of the same cs; drop them from the cache
+ */
+static void mv_ddr_phy_cache_bcast_clr(u32 type, u32 phy, u32 reg_addr)
+{
+	u32 cs, bit;
+
+	if (type != DDR_PHY_DATA)
+		return;
+
+	for (cs = 0; cs < MAX_CS_NUM; cs++) {
+		if (reg_addr == PBS_TX_BCAST_PHY_REG(cs)) {
+			for (bit = 0; bit < BUS_WIDTH_IN_BITS; bit++)
+				mv_ddr_phy_cache_clr(type, phy, PBS_TX_PHY_REG(cs, bit));
+		} else if (reg_addr == PBS_RX_BCAST_PHY_REG(cs)) {
+			for (bit = 0; bit < BUS_WIDTH_IN_BITS; bit++)
+				mv_ddr_phy_cache_clr(type, phy, PBS_RX_PHY_REG(cs, bit));
+		} else if (reg_addr == VREF_BCAST_PHY_REG(cs)) {
+			for (bit = 0; bit < VREF_BCAST_PHY_BASE - VREF_PHY_BASE; bit++)
+				mv_ddr_phy_cache_clr(type, phy, VREF_PHY_REG(cs, bit));
+		}
+	}
+}
+
+void mv_ddr_phy_cache_start(void)
+{
+	mv_ddr_phy_cache_invalidate();
+	memset(&phy_cache_stats, 0, sizeof(phy_cache_stats));
+	phy_cache_ena = 1;
+}
+
+void mv_ddr_phy_cache_stop(void)
+{
+	phy_cache_ena = 0;
+	mv_ddr_phy_cache_invalidate();
+}
+
+void mv_ddr_phy_cache_invalidate(void)
+{
+	memset(phy_cache_valid, 0, sizeof(phy_cache_valid));
+	phy_cache_stats.inval++;
+}
+
+/*
+ * serve a phy register read from the cache
+ * returns MV_OK on hit, MV_NOT_FOUND when the bus has to be accessed;
+ * a multicast read hits only when all active subphys are cached
+ */
+int mv_ddr_phy_cache_read(enum hws_access_type phy_access, u32 phy,
+			  enum hws_ddr_phy phy_type, u32 reg_addr, u32 *data)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 type = phy_type & 0x1;
+	u32 i;
+
+	if (!phy_cache_ena || reg_addr >= MV_DDR_PHY_CACHE_REGS ||
+	    mv_ddr_phy_cache_is_volatile(phy_type, reg_addr))
+		return MV_NOT_FOUND;
+
+	if (phy_access == ACCESS_TYPE_MULTICAST) {
+		for (i = 0; i < octets_per_if_num; i++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, i);
+			if (!mv_ddr_phy_cache_is_valid(type, i, reg_addr)) {
+				phy_cache_stats.miss++;
+				return MV_NOT_FOUND;
+			}
+		}
+		for (i = 0; i < octets_per_if_num; i++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, i);
+			data[i] = phy_cache_val[type][i][reg_addr];
+		}
+	} else {
+		if (phy >= MAX_BUS_NUM || !mv_ddr_phy_cache_is_valid(type, phy, reg_addr)) {
+			phy_cache_stats.miss++;
+			return MV_NOT_FOUND;
+		}
+		*data = phy_cache_val[type][phy][reg_addr];
+	}
+
+	phy_cache_stats.hit++;
+
+	return MV_OK;
+}
+
+/* store the result of a phy register read from the bus */
+void mv_ddr_phy_cache_fill(enum hws_access_type phy_access, u32 phy,
+			   enum hws_ddr_phy phy_type, u32 reg_addr, u32 *data)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 type = phy_type & 0x1;
+	u32 i;
+
+	if (!phy_cache_ena || reg_addr >= MV_DDR_PHY_CACHE_REGS ||
+	    mv_ddr_phy_cache_is_volatile(phy_type, reg_addr))
+		return;
+
+	if (phy_access == ACCESS_TYPE_MULTICAST) {
+		for (i = 0; i < octets_per_if_num; i++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, i);
+			mv_ddr_phy_cache_set(type, i, reg_addr, data[i]);
+		}
+	} else if (phy < MAX_BUS_NUM) {
+		mv_ddr_phy_cache_set(type, phy, reg_addr, *data);
+	}
+}
+
+/* write-through: update the cache with a value written to the bus */
+void mv_ddr_phy_cache_write(enum hws_access_type phy_access, u32 phy,
+			    enum hws_ddr_phy phy_type, u32 reg_addr, u32 data)
+{
+	u32 type = phy_type & 0x1;
+	u32 i, first, last;
+
+	if (!phy_cache_ena || reg_addr >= MV_DDR_PHY_CACHE_REGS ||
+	    mv_ddr_phy_cache_is_volatile(phy_type, reg_addr))
+		return;
+
+	if (phy_access == ACCESS_TYPE_MULTICAST) {
+		first = 0;
+		last = MAX_BUS_NUM - 1;
+	} else if (phy < MAX_BUS_NUM) {
+		first = phy;
+		last = phy;
+	} else {
+		return;
+	}
+
+	for (i = first; i <= last; i++) {
+		mv_ddr_phy_cache_set(type, i, reg_addr, data);
+		mv_ddr_phy_cache_bcast_clr(type, i, reg_addr);
+	}
+}
+
+struct mv_ddr_phy_cache_stats *mv_ddr_phy_cache_stats_get(void)
+{
+	return &phy_cache_stats;
+}
+
+void mv_ddr_phy_cache_stats_print(void)
+{
+	printf("mv_ddr: phy cache: reads %d hit, %d miss, %d invalidations\n",
+	       phy_cache_stats.hit, phy_cache_stats.miss, phy_cache_stats.inval);
+}
+#endif /* MV_DDR_PHY_CACHE */
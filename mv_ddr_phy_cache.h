@@ -0,0 +1,38 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_PHY_CACHE_H
+#define _MV_DDR_PHY_CACHE_H
+
+/*
+ * phy register read cache
+ *
+ * when built with MV_DDR_PHY_CACHE, data and control phy registers are
+ * cached write-through, per subphy, type and address, while the training
+ * flow runs; the cache has to be invalidated whenever hardware may update
+ * phy registers on its own (e.g., training engine results written to adll)
+ */
+#define MV_DDR_PHY_CACHE_REGS	256
+
+struct mv_ddr_phy_cache_stats {
+	u32 hit;	/* reads served from the cache */
+	u32 miss;	/* reads sent to the bus */
+	u32 inval;	/* invalidations */
+};
+
+#if defined(MV_DDR_PHY_CACHE)
+void mv_ddr_phy_cache_start(void);
+void mv_ddr_phy_cache_stop(void);
+void mv_ddr_phy_cache_invalidate(void);
+int mv_ddr_phy_cache_read(enum hws_access_type phy_access, u32 phy,
+			  enum hws_ddr_phy phy_type, u32 reg_addr, u32 *data);
+void mv_ddr_phy_cache_fill(enum hws_access_type phy_access, u32 phy,
+			   enum hws_ddr_phy phy_type, u32 reg_addr, u32 *data);
+void mv_ddr_phy_cache_write(enum hws_access_type phy_access, u32 phy,
+			    enum hws_ddr_phy phy_type, u32 reg_addr, u32 data);
+struct mv_ddr_phy_cache_stats *mv_ddr_phy_cache_stats_get(void);
+void mv_ddr_phy_cache_stats_print(void);
+#endif /* MV_DDR_PHY_CACHE */
+
+#endif /* _MV_DDR_PHY_CACHE_H */
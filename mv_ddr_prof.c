@@ -0,0 +1,186 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_PROF)
+
+/* training flow profiler */
+
+#include "ddr3_init.h"
+
+struct mv_ddr_prof_stage {
+	u32 runs;
+	u32 time_us;
+	u32 cnt[MV_DDR_PROF_CNT_MAX];
+};
+
+u32 mv_ddr_prof_cnt[MV_DDR_PROF_CNT_MAX];
+
+static struct mv_ddr_prof_stage mv_ddr_prof_db[MAX_STAGE_LIMIT];
+static u32 prof_cnt_snap[MV_DDR_PROF_CNT_MAX];
+static u32 prof_stage_start;
+static u32 prof_start, prof_total_us;
+static int prof_stage = -1;
+
+static const char *const mv_ddr_prof_stage_name[MAX_STAGE_LIMIT] = {
+	[INIT_CONTROLLER] = "INIT_CONTROLLER",
+	[STATIC_LEVELING] = "STATIC_LEVELING",
+	[SET_LOW_FREQ] = "SET_LOW_FREQ",
+	[LOAD_PATTERN] = "LOAD_PATTERN",
+	[SET_MEDIUM_FREQ] = "SET_MEDIUM_FREQ",
+	[WRITE_LEVELING] = "WRITE_LEVELING",
+	[LOAD_PATTERN_2] = "LOAD_PATTERN_2",
+	[READ_LEVELING] = "READ_LEVELING",
+#if defined(CONFIG_DDR4)
+	[SW_READ_LEVELING] = "SW_READ_LEVELING",
+#endif /* CONFIG_DDR4 */
+	[WRITE_LEVELING_SUPP] = "WRITE_LEVELING_SUPP",
+	[PBS_RX] = "PBS_RX",
+	[PBS_TX] = "PBS_TX",
+	[SET_TARGET_FREQ] = "SET_TARGET_FREQ",
+	[ADJUST_DQS] = "ADJUST_DQS",
+	[WRITE_LEVELING_TF] = "WRITE_LEVELING_TF",
+	[READ_LEVELING_TF] = "READ_LEVELING_TF",
+	[WRITE_LEVELING_SUPP_TF] = "WRITE_LEVELING_SUPP_TF",
+	[DM_PBS_TX] = "DM_PBS_TX",
+	[VREF_CALIBRATION] = "VREF_CALIBRATION",
+	[CENTRALIZATION_RX] = "CENTRALIZATION_RX",
+	[CENTRALIZATION_TX] = "CENTRALIZATION_TX",
+	[TX_EMPHASIS] = "TX_EMPHASIS",
+	[LOAD_PATTERN_HIGH] = "LOAD_PATTERN_HIGH",
+	[PER_BIT_READ_LEVELING_TF] = "PER_BIT_READ_LEVELING_TF",
+#if defined(CONFIG_DDR4)
+	[RECEIVER_CALIBRATION] = "RECEIVER_CALIBRATION",
+	[WL_PHASE_CORRECTION] = "WL_PHASE_CORRECTION",
+	[DQ_VREF_CALIBRATION] = "DQ_VREF_CALIBRATION",
+	[DM_TUNING] = "DM_TUNING",
+	[DQ_MAPPING] = "DQ_MAPPING",
+#endif /* CONFIG_DDR4 */
+	[WRITE_LEVELING_LF] = "WRITE_LEVELING_LF"
+};
+
+/* charge time and accesses since the last transition to the active stage */
+static void mv_ddr_prof_stage_close(void)
+{
+	struct mv_ddr_prof_stage *db;
+	u32 now = mv_ddr_time_us();
+	int i;
+
+	if (prof_stage < 0)
+		return;
+
+	db = &mv_ddr_prof_db[prof_stage];
+	db->runs++;
+	db->time_us += now - prof_stage_start;
+	for (i = 0; i < MV_DDR_PROF_CNT_MAX; i++)
+		db->cnt[i] += mv_ddr_prof_cnt[i] - prof_cnt_snap[i];
+}
+
+static void mv_ddr_prof_stage_open(int stage)
+{
+	int i;
+
+	prof_stage = stage;
+	prof_stage_start = mv_ddr_time_us();
+	for (i = 0; i < MV_DDR_PROF_CNT_MAX; i++)
+		prof_cnt_snap[i] = mv_ddr_prof_cnt[i];
+}
+
+void mv_ddr_prof_start(void)
+{
+	memset(mv_ddr_prof_db, 0, sizeof(mv_ddr_prof_db));
+	memset(mv_ddr_prof_cnt, 0, sizeof(mv_ddr_prof_cnt));
+	prof_total_us = 0;
+	prof_start = mv_ddr_time_us();
+	mv_ddr_prof_stage_open(training_stage);
+}
+
+void mv_ddr_prof_stop(void)
+{
+	mv_ddr_prof_stage_close();
+	prof_stage = -1;
+	prof_total_us = mv_ddr_time_us() - prof_start;
+}
+
+void mv_ddr_prof_stage_set(enum auto_tune_stage stage)
+{
+	if (prof_stage < 0)
+		return;
+
+	mv_ddr_prof_stage_close();
+	mv_ddr_prof_stage_open(stage);
+}
+
+void mv_ddr_prof_print(void)
+{
+	struct mv_ddr_prof_stage *db;
+	u32 stage;
+
+	printf("mv_ddr: training profile (total %d us)\n", prof_total_us);
+	printf("%-24s %5s %10s %9s %9s %9s %9s %9s\n", "stage", "runs", "time[us]",
+	       "dunit_rd", "dunit_wr", "phy_rd", "phy_wr", "polls");
+	for (stage = 0; stage < MAX_STAGE_LIMIT; stage++) {
+		db = &mv_ddr_prof_db[stage];
+		if (db->runs == 0)
+			continue;
+		printf("%-24s %5d %10d %9d %9d %9d %9d %9d\n",
+		       mv_ddr_prof_stage_name[stage], db->runs, db->time_us,
+		       db->cnt[MV_DDR_PROF_DUNIT_RD], db->cnt[MV_DDR_PROF_DUNIT_WR],
+		       db->cnt[MV_DDR_PROF_PHY_RD], db->cnt[MV_DDR_PROF_PHY_WR],
+		       db->cnt[MV_DDR_PROF_POLL]);
+	}
+}
+
+static u8 *mv_ddr_prof_put(u8 *buf, u32 val, u32 size)
+{
+	u32 i;
+
+	for (i = 0; i < size; i++)
+		*buf++ = (val >> (8 * i)) & 0xff;
+
+	return buf;
+}
+
+/*
+ * serialize the profile into a binary record, as described in mv_ddr_prof.h;
+ * buf must hold at least MV_DDR_PROF_RECORD_MAX_SIZE bytes
+ */
+int mv_ddr_prof_record_get(u8 *buf, u32 size, u32 *len)
+{
+	struct mv_ddr_prof_stage *db;
+	const char *name;
+	u8 *ptr;
+	u32 stage, entries = 0;
+	int i;
+
+	if (buf == NULL || len == NULL || size < MV_DDR_PROF_RECORD_MAX_SIZE)
+		return MV_BAD_PARAM;
+
+	ptr = buf + MV_DDR_PROF_HDR_SIZE;
+	for (stage = 0; stage < MAX_STAGE_LIMIT; stage++) {
+		db = &mv_ddr_prof_db[stage];
+		if (db->runs == 0)
+			continue;
+		ptr = mv_ddr_prof_put(ptr, stage, 1);
+		ptr = mv_ddr_prof_put(ptr, (db->runs > 0xff) ? 0xff : db->runs, 1);
+		ptr = mv_ddr_prof_put(ptr, 0, 2);
+		ptr = mv_ddr_prof_put(ptr, db->time_us, 4);
+		for (i = 0; i < MV_DDR_PROF_CNT_MAX; i++)
+			ptr = mv_ddr_prof_put(ptr, db->cnt[i], 4);
+		name = mv_ddr_prof_stage_name[stage];
+		for (i = 0; i < MV_DDR_PROF_NAME_SIZE; i++)
+			*ptr++ = (name != NULL && i < MV_DDR_PROF_NAME_SIZE - 1 && *name) ? *name++ : 0;
+		entries++;
+	}
+
+	mv_ddr_prof_put(buf, MV_DDR_PROF_MAGIC, 4);
+	mv_ddr_prof_put(buf + 4, MV_DDR_PROF_VERSION, 2);
+	mv_ddr_prof_put(buf + 6, entries, 1);
+	mv_ddr_prof_put(buf + 7, MV_DDR_PROF_ENTRY_SIZE, 1);
+	mv_ddr_prof_put(buf + 8, prof_total_us, 4);
+
+	*len = ptr - buf;
+
+	return MV_OK;
+}
+#endif /* MV_DDR_PROF */
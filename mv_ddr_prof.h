@@ -0,0 +1,56 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_PROF_H
+#define _MV_DDR_PROF_H
+
+/*
+ * training flow profiler
+ *
+ * when built with MV_DDR_PROF, each training stage set through
+ * mv_ddr_training_stage_set() accumulates its elapsed time and the number
+ * of dunit/phy accesses and poll iterations issued while it was active
+ */
+enum mv_ddr_prof_cnt {
+	MV_DDR_PROF_DUNIT_RD,
+	MV_DDR_PROF_DUNIT_WR,
+	MV_DDR_PROF_PHY_RD,
+	MV_DDR_PROF_PHY_WR,
+	MV_DDR_PROF_POLL,
+	MV_DDR_PROF_CNT_MAX
+};
+
+/*
+ * binary record, little-endian:
+ * header: magic (4), version (2), entry count (1), entry size (1), total time in us (4)
+ * entry:  stage (1), runs (1), reserved (2), time in us (4),
+ *	   dunit rd (4), dunit wr (4), phy rd (4), phy wr (4), polls (4),
+ *	   stage name (MV_DDR_PROF_NAME_SIZE, nul padded)
+ * only stages run at least once are recorded; the stage numbers depend on
+ * the build, so entries carry the stage names. a build with
+ * MV_DDR_PROF_DUMP_ADDR writes the record there once training passed;
+ * tools/prof_decode prints it on the host.
+ */
+#define MV_DDR_PROF_MAGIC		0x5044564d /* "MVDP" */
+#define MV_DDR_PROF_VERSION		2
+#define MV_DDR_PROF_HDR_SIZE		12
+#define MV_DDR_PROF_NAME_SIZE		28
+#define MV_DDR_PROF_ENTRY_SIZE		(8 + 4 * MV_DDR_PROF_CNT_MAX + MV_DDR_PROF_NAME_SIZE)
+#define MV_DDR_PROF_RECORD_MAX_SIZE	(MV_DDR_PROF_HDR_SIZE + \
+					 MAX_STAGE_LIMIT * MV_DDR_PROF_ENTRY_SIZE)
+
+#if defined(MV_DDR_PROF)
+extern u32 mv_ddr_prof_cnt[MV_DDR_PROF_CNT_MAX];
+#define MV_DDR_PROF_CNT_INC(cnt)	(mv_ddr_prof_cnt[(cnt)]++)
+
+void mv_ddr_prof_start(void);
+void mv_ddr_prof_stop(void);
+void mv_ddr_prof_stage_set(enum auto_tune_stage stage);
+void mv_ddr_prof_print(void);
+int mv_ddr_prof_record_get(u8 *buf, u32 size, u32 *len);
+#else
+#define MV_DDR_PROF_CNT_INC(cnt)
+#endif /* MV_DDR_PROF */
+
+#endif /* _MV_DDR_PROF_H */
@@ -157,6 +157,9 @@ enum {
 	DDR4_MPR_WR
 };
 
+#define SDRAM_MODE_REG				0x141c
+#define SDRAM_EXT_MODE_REG			0x1420
+
 #define DUNIT_CTRL_HIGH_REG			0x1424
 #define CPU_INTERJECTION_ENA_OFFS		3
 #define CPU_INTERJECTION_ENA_MASK		0x1
@@ -173,6 +176,7 @@ enum {
 #define DDR_TIMING_TXPDLL_OFFS			4
 #define DDR_TIMING_TXPDLL_MASK			0x1f
 
+#define SDRAM_AUTO_PWR_SAVE_REG			0x1474
 #define DDR_ODT_TIMING_HIGH_REG			0x147c
 
 #define SDRAM_INIT_CTRL_REG			0x1480
@@ -181,6 +185,7 @@ enum {
 #define DRAM_RESET_MASK_NORMAL			0
 #define DRAM_RESET_MASK_MASKED			1
 
+#define SDRAM_ODT_CTRL_LOW_REG			0x1494
 #define SDRAM_ODT_CTRL_HIGH_REG			0x1498
 #define DUNIT_ODT_CTRL_REG			0x149c
 #define RD_BUFFER_SEL_REG			0x14a4
@@ -222,6 +227,9 @@ enum {
 #define DDR4_TWTR_L_OFFS			4
 #define DDR4_TWTR_L_MASK			0xf
 
+/* dunit address window of a cs: size, cs and enable */
+#define DUNIT_CS_WIN_CTRL_REG(cs)		(0x1504 + (cs) * 0x8)
+
 #define DDR_IO_REG				0x1524
 #define DFS_REG					0x1528
 
@@ -268,6 +276,7 @@ enum {
 #define CS_EXIST_MASK				0x1
 
 #define ZQC_CFG_REG				0x15e4
+#define ZQC_CFG_HIGH_REG			0x15e8
 #define DRAM_PHY_CFG_REG			0x15ec
 #define ODPG_CTRL_CTRL_REG			0x1600
 #define ODPG_CTRL_AUTO_REFRESH_OFFS		21
@@ -515,6 +524,15 @@ enum {
 #define PBS_RX_BCAST_PHY_BASE			0x5f
 #define PBS_RX_BCAST_PHY_REG(cs)		(PBS_RX_BCAST_PHY_BASE + (cs) * 0x10)
 
+/*
+ * per cs data phy registers holding the training results, by index:
+ * wl, ctx, rl, crx, pbs tx and pbs rx per pad, vref per pad;
+ * see mv_ddr_phy_cs_reg_get()
+ */
+#define PHY_CS_PBS_PADS				11
+#define PHY_CS_VREF_PADS			(VREF_BCAST_PHY_BASE - VREF_PHY_BASE)
+#define PHY_CS_REGS_NUM				(4 + 2 * PHY_CS_PBS_PADS + PHY_CS_VREF_PADS)
+
 #define RESULT_PHY_REG				0xc0
 #define RESULT_PHY_RX_OFFS			5
 #define RESULT_PHY_TX_OFFS			0
@@ -0,0 +1,373 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_RETRAIN)
+
+/* per byte lane verification and retraining */
+
+#include "ddr3_init.h"
+#include "mv_ddr_regs.h"
+#include "ddr_training_ip_db.h"
+
+#define RETRAIN_BIST_PATTERN	PATTERN_KILLER_DQ0
+#define RETRAIN_BIST_OFFS	32
+#define RETRAIN_VREF_RESET	63
+#define RETRAIN_BYTE_MASK	0xff
+#define RETRAIN_WORD_BYTES	4
+
+/* subphys the training stages run on, see IS_BUS_ACTIVE */
+unsigned int mv_ddr_retrain_bus_mask = 0xffffffff;
+
+/* subphys failing on any cs, per interface */
+static u32 retrain_fail_mask[MAX_INTERFACE_NUM];
+/* setup of the passing subphys, kept across the retraining */
+static u16 retrain_regs[MAX_INTERFACE_NUM][MAX_CS_NUM][PHY_CS_REGS_NUM][MAX_BUS_NUM];
+
+/* data subphys the cpu reads directly; the others (ecc) need a bist */
+static u32 mv_ddr_retrain_cpu_lanes_get(void)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+
+	if (MV_DDR_IS_64BIT_DRAM_MODE(tm->bus_act_mask))
+		return MV_DDR_64BIT_BUS_MASK;
+	if (DDR3_IS_16BIT_DRAM_MODE(tm->bus_act_mask))
+		return BUS_MASK_16BIT;
+
+	return BUS_MASK_32BIT;
+}
+
+/* subphy carrying a byte of a 32-bit word read by the cpu */
+static u32 mv_ddr_retrain_byte_lane_get(u32 word, u32 byte)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+
+	if (MV_DDR_IS_64BIT_DRAM_MODE(tm->bus_act_mask))
+		return (word % 2) * RETRAIN_WORD_BYTES + byte;
+	if (DDR3_IS_16BIT_DRAM_MODE(tm->bus_act_mask))
+		return byte % 2;
+
+	return byte;
+}
+
+static int mv_ddr_retrain_bist(u32 dev_num, u32 if_id, u32 cs, u32 *err_cnt)
+{
+	struct bist_result res;
+
+	CHECK_STATUS(ddr3_tip_bist_activate(dev_num, RETRAIN_BIST_PATTERN, ACCESS_TYPE_UNICAST,
+					    if_id, OPER_WRITE, STRESS_NONE, DURATION_SINGLE,
+					    BIST_START, RETRAIN_BIST_OFFS, cs, 15));
+	CHECK_STATUS(ddr3_tip_bist_activate(dev_num, RETRAIN_BIST_PATTERN, ACCESS_TYPE_UNICAST,
+					    if_id, OPER_READ, STRESS_NONE, DURATION_SINGLE,
+					    BIST_START, RETRAIN_BIST_OFFS, cs, 15));
+	CHECK_STATUS(ddr3_tip_bist_read_result(dev_num, if_id, &res));
+	*err_cnt = res.bist_error_cnt;
+
+	return MV_OK;
+}
+
+/*
+ * write the test pattern thru the odpg and compare it per byte lane as read
+ * by the cpu; if all cpu lanes pass but a bist fails, blame the ecc lanes
+ */
+static int mv_ddr_retrain_cs_verify(u32 dev_num, u32 cs)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	struct pattern_info *pattern_table = ddr3_tip_get_pattern_table();
+	u32 read_pattern[EXT_ACCESS_BURST_LENGTH];
+	u32 cpu_lanes = mv_ddr_retrain_cpu_lanes_get();
+	u32 ecc_lanes = tm->bus_act_mask & ~cpu_lanes;
+	u32 if_id, word, byte, diff, fail, err_cnt;
+
+	effective_cs = cs;
+	CHECK_STATUS(ddr3_tip_load_pattern_to_mem(dev_num, PATTERN_TEST));
+	CHECK_STATUS(ddr3_tip_reset_fifo_ptr(dev_num));
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		CHECK_STATUS(ddr3_tip_ext_read(dev_num, if_id,
+					       (pattern_table[PATTERN_TEST].start_addr << 3) +
+					       ((SDRAM_CS_SIZE + 1) * cs), 1, read_pattern));
+
+		fail = 0;
+		for (word = 0; word < EXT_ACCESS_BURST_LENGTH; word++) {
+			diff = read_pattern[word] ^ pattern_table_get_word(dev_num, PATTERN_TEST, (u8)word);
+			for (byte = 0; byte < RETRAIN_WORD_BYTES; byte++) {
+				if ((diff >> (byte * 8)) & RETRAIN_BYTE_MASK)
+					fail |= 1 << mv_ddr_retrain_byte_lane_get(word, byte);
+			}
+		}
+		fail &= tm->bus_act_mask;
+
+		if (ecc_lanes != 0 && fail == 0) {
+			CHECK_STATUS(mv_ddr_retrain_bist(dev_num, if_id, cs, &err_cnt));
+			if (err_cnt != 0)
+				fail |= ecc_lanes;
+		}
+
+		retrain_fail_mask[if_id] |= fail;
+	}
+
+	return MV_OK;
+}
+
+/*
+ * check the current phy setup per subphy and per cs; failing subphys are
+ * marked BYTE_NOT_DEFINED in the training ip byte status
+ */
+int mv_ddr_retrain_verify(u32 dev_num, u32 cs_num, u32 *fail_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 if_id, cs, subphy;
+	int status = MV_OK;
+
+	memset(retrain_fail_mask, 0, sizeof(retrain_fail_mask));
+	for (cs = 0; cs < cs_num && status == MV_OK; cs++)
+		status = mv_ddr_retrain_cs_verify(dev_num, cs);
+	effective_cs = 0;
+	if (status != MV_OK)
+		return status;
+
+	*fail_num = 0;
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (subphy = 0; subphy < octets_per_if_num; subphy++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy);
+			if (retrain_fail_mask[if_id] & (1 << subphy)) {
+				mv_ddr_tip_sub_phy_byte_status_set(if_id, subphy, BYTE_NOT_DEFINED);
+				DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
+						  ("%s: if %d subphy %d failed\n", __func__, if_id, subphy));
+				(*fail_num)++;
+			} else {
+				mv_ddr_tip_sub_phy_byte_status_set(if_id, subphy, BYTE_HOMOGENEOUS_LOW);
+			}
+		}
+	}
+
+	return MV_OK;
+}
+
+/* save the setup of the passing subphys; start the failing ones from reset values */
+static int mv_ddr_retrain_lanes_reset(u32 dev_num, u32 cs_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 if_id, cs, idx, subphy, data;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (subphy = 0; subphy < octets_per_if_num; subphy++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy);
+			for (cs = 0; cs < cs_num; cs++) {
+				if (!(retrain_fail_mask[if_id] & (1 << subphy))) {
+					for (idx = 0; idx < PHY_CS_REGS_NUM; idx++) {
+						CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+									       subphy, DDR_PHY_DATA,
+									       mv_ddr_phy_cs_reg_get(cs, idx),
+									       &data));
+						retrain_regs[if_id][cs][idx][subphy] = (u16)data;
+					}
+					continue;
+				}
+
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								WL_PHY_REG(cs), phy_reg0_val));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								RL_PHY_REG(cs), phy_reg2_val));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								CRX_PHY_REG(cs), phy_reg3_val));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								CTX_PHY_REG(cs), phy_reg1_val));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_TX_BCAST_PHY_REG(cs), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_RX_BCAST_PHY_REG(cs), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_TX_PHY_REG(cs, DQSP_PAD), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_RX_PHY_REG(cs, DQSP_PAD), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_TX_PHY_REG(cs, DQSN_PAD), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								PBS_RX_PHY_REG(cs, DQSN_PAD), 0));
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, subphy, DDR_PHY_DATA,
+								VREF_BCAST_PHY_REG(cs), RETRAIN_VREF_RESET));
+			}
+		}
+	}
+
+	return MV_OK;
+}
+
+/* the writes of the failing subphys go out in a phy batch */
+static int mv_ddr_retrain_lanes_prepare(u32 dev_num, u32 cs_num)
+{
+	CHECK_STATUS(mv_ddr_phy_batch_start(dev_num));
+
+	return mv_ddr_phy_batch_end(dev_num, mv_ddr_retrain_lanes_reset(dev_num, cs_num));
+}
+
+/* put back the setup saved for the passing subphys */
+static int mv_ddr_retrain_lanes_load(u32 dev_num, u32 cs_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 if_id, cs, idx, subphy;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (subphy = 0; subphy < octets_per_if_num; subphy++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy);
+			if (retrain_fail_mask[if_id] & (1 << subphy))
+				continue;
+			for (cs = 0; cs < cs_num; cs++) {
+				for (idx = 0; idx < PHY_CS_REGS_NUM; idx++)
+					CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+									ACCESS_TYPE_UNICAST, subphy,
+									DDR_PHY_DATA,
+									mv_ddr_phy_cs_reg_get(cs, idx),
+									retrain_regs[if_id][cs][idx][subphy]));
+			}
+		}
+	}
+
+	return MV_OK;
+}
+
+/* the saved setup goes back in a phy batch */
+static int mv_ddr_retrain_lanes_restore(u32 dev_num, u32 cs_num)
+{
+	CHECK_STATUS(mv_ddr_phy_batch_start(dev_num));
+
+	return mv_ddr_phy_batch_end(dev_num, mv_ddr_retrain_lanes_load(dev_num, cs_num));
+}
+
+/* the target frequency stages of the main training flow */
+static int mv_ddr_retrain_stages(u32 dev_num, u32 cs_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+
+	if (mask_tune_func & WRITE_LEVELING_TF_MASK_BIT) {
+		mv_ddr_training_stage_set(WRITE_LEVELING_TF);
+		CHECK_STATUS(ddr3_tip_dynamic_write_leveling(dev_num, 0));
+	}
+
+	if (mask_tune_func & LOAD_PATTERN_HIGH_MASK_BIT) {
+		mv_ddr_training_stage_set(LOAD_PATTERN_HIGH);
+		CHECK_STATUS(ddr3_tip_load_all_pattern_to_mem(dev_num));
+	}
+
+	if (mask_tune_func & READ_LEVELING_TF_MASK_BIT) {
+		mv_ddr_training_stage_set(READ_LEVELING_TF);
+		CHECK_STATUS(ddr3_tip_dynamic_read_leveling(dev_num,
+							    tm->interface_params[first_active_if].memory_freq));
+	}
+
+	for (effective_cs = 0; effective_cs < cs_num; effective_cs++) {
+#if !defined(CONFIG_DDR4)
+		if (mask_tune_func & PBS_RX_MASK_BIT) {
+			mv_ddr_training_stage_set(PBS_RX);
+			CHECK_STATUS(ddr3_tip_pbs_rx(dev_num));
+		}
+
+		if (mask_tune_func & PBS_TX_MASK_BIT) {
+			mv_ddr_training_stage_set(PBS_TX);
+			CHECK_STATUS(ddr3_tip_pbs_tx(dev_num));
+		}
+
+		if (mask_tune_func & CENTRALIZATION_RX_MASK_BIT) {
+			mv_ddr_training_stage_set(CENTRALIZATION_RX);
+			CHECK_STATUS(ddr3_tip_centralization_rx(dev_num));
+		}
+#endif /* CONFIG_DDR4 */
+
+		if (mask_tune_func & WRITE_LEVELING_SUPP_TF_MASK_BIT) {
+			mv_ddr_training_stage_set(WRITE_LEVELING_SUPP_TF);
+			CHECK_STATUS(ddr3_tip_dynamic_write_leveling_supp(dev_num));
+		}
+
+#if defined(CONFIG_DDR4)
+		CHECK_STATUS(mv_ddr4_training_main_flow(dev_num));
+#else /* CONFIG_DDR4 */
+		if (mask_tune_func & CENTRALIZATION_TX_MASK_BIT) {
+			mv_ddr_training_stage_set(CENTRALIZATION_TX);
+			CHECK_STATUS(ddr3_tip_centralization_tx(dev_num));
+		}
+#endif /* CONFIG_DDR4 */
+	}
+
+	return MV_OK;
+}
+
+/*
+ * verify the current phy setup and retrain the failing subphys only;
+ * returns MV_FAIL if all subphys fail or the retrained setup still fails,
+ * so the caller falls back to the full training flow
+ */
+int mv_ddr_retrain(u32 dev_num, u32 cs_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	u32 lanes_num = 0, bus_mask = 0, fail_num, retrain_num, if_id, subphy;
+	int status;
+
+	CHECK_STATUS(mv_ddr_retrain_verify(dev_num, cs_num, &fail_num));
+	if (fail_num == 0)
+		return MV_OK;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (subphy = 0; subphy < octets_per_if_num; subphy++) {
+			VALIDATE_BUS_ACTIVE(tm->bus_act_mask, subphy);
+			lanes_num++;
+		}
+	}
+
+	if (fail_num == lanes_num) {
+		printf("mv_ddr: retrain: all %d lanes failed\n", lanes_num);
+		return MV_FAIL;
+	}
+
+	retrain_num = fail_num;
+	CHECK_STATUS(mv_ddr_retrain_lanes_prepare(dev_num, cs_num));
+
+	/* the stages skip the passing subphys, so their cost follows the failing ones */
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++)
+		bus_mask |= retrain_fail_mask[if_id];
+	mv_ddr_retrain_bus_mask = bus_mask;
+	status = mv_ddr_retrain_stages(dev_num, cs_num);
+	mv_ddr_retrain_bus_mask = 0xffffffff;
+	effective_cs = 0;
+#if defined(MV_DDR_PHY_CACHE)
+	/* a multicast write reached the passing subphys behind the cache */
+	mv_ddr_phy_cache_invalidate();
+#endif /* MV_DDR_PHY_CACHE */
+	CHECK_STATUS(mv_ddr_retrain_lanes_restore(dev_num, cs_num));
+	if (status != MV_OK) {
+		printf("mv_ddr: retrain: training failed\n");
+		return MV_FAIL;
+	}
+
+	CHECK_STATUS(mv_ddr_retrain_verify(dev_num, cs_num, &fail_num));
+	if (fail_num != 0) {
+		printf("mv_ddr: retrain: %d lanes still failing\n", fail_num);
+		return MV_FAIL;
+	}
+
+	printf("mv_ddr: retrain: %d of %d lanes retrained\n", retrain_num, lanes_num);
+
+	return MV_OK;
+}
+#endif /* MV_DDR_RETRAIN */
@@ -0,0 +1,26 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_RETRAIN_H
+#define _MV_DDR_RETRAIN_H
+
+#if defined(MV_DDR_RETRAIN)
+/*
+ * per byte lane verification and retraining
+ *
+ * a phy setup that was not trained on this boot (a restored snapshot or a
+ * static configuration) is checked per subphy and per cs: the odpg writes
+ * the test pattern and the cpu reads it back and compares each byte lane;
+ * lanes not visible to the cpu (ecc) are checked with a bist. the result is
+ * kept in the training ip byte status (BYTE_NOT_DEFINED for a failing lane).
+ * if only some lanes fail, the target frequency wl, rl, pbs and
+ * centralization stages run again from reset values on the failing lanes;
+ * mv_ddr_retrain_bus_mask limits the per subphy loops of the stages to the
+ * failing lanes, and the setup of the passing lanes is put back afterwards.
+ */
+int mv_ddr_retrain_verify(u32 dev_num, u32 cs_num, u32 *fail_num);
+int mv_ddr_retrain(u32 dev_num, u32 cs_num);
+#endif /* MV_DDR_RETRAIN */
+
+#endif /* _MV_DDR_RETRAIN_H */
@@ -0,0 +1,162 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_SHADOW)
+
+/* dunit shadow register cache */
+
+#include "ddr3_init.h"
+#include "mv_ddr_regs.h"
+
+/*
+ * volatility table: registers not listed here are never cached;
+ * vol_mask holds the bits hardware may change on its own (self-clearing
+ * triggers); those are kept as zero in the shadow, never served from it
+ * and a write touching them is always sent to the bus
+ */
+struct mv_ddr_shadow_reg {
+	u32 addr;
+	u32 vol_mask;
+};
+
+static const struct mv_ddr_shadow_reg mv_ddr_shadow_tbl[] = {
+	{ODPG_WR_RD_MODE_ENA_REG, 0x0},
+	{ODPG_DATA_CTRL_REG, (ODPG_DISABLE_MASK << ODPG_DISABLE_OFFS) |
+			     (ODPG_ENABLE_MASK << ODPG_ENABLE_OFFS)},
+	{ODPG_DATA_BUFFER_OFFS_REG, 0x0},
+	{ODPG_DATA_BUFFER_SIZE_REG, 0x0},
+	{ODPG_DATA_WR_DATA_HIGH_REG, 0x0},
+	{ODPG_DATA_WR_DATA_LOW_REG, 0x0},
+	{DUAL_DUNIT_CFG_REG, 0x0}
+};
+
+#define MV_DDR_SHADOW_REG_NUM	ARRAY_SIZE(mv_ddr_shadow_tbl)
+
+static u32 shadow_val[MV_DDR_SHADOW_REG_NUM];
+static u8 shadow_valid[MV_DDR_SHADOW_REG_NUM];
+static int shadow_ena;
+static struct mv_ddr_shadow_stats shadow_stats;
+
+static int mv_ddr_shadow_idx_get(u32 reg_addr)
+{
+	int i;
+
+	for (i = 0; i < MV_DDR_SHADOW_REG_NUM; i++) {
+		if (mv_ddr_shadow_tbl[i].addr == reg_addr)
+			return i;
+	}
+
+	return -1;
+}
+
+void mv_ddr_shadow_start(void)
+{
+	mv_ddr_shadow_invalidate();
+	memset(&shadow_stats, 0, sizeof(shadow_stats));
+	shadow_ena = 1;
+}
+
+void mv_ddr_shadow_stop(void)
+{
+	shadow_ena = 0;
+	mv_ddr_shadow_invalidate();
+}
+
+/* to be called whenever cached registers may have been accessed bypassing the shadow */
+void mv_ddr_shadow_invalidate(void)
+{
+	memset(shadow_valid, 0, sizeof(shadow_valid));
+}
+
+/*
+ * serve a dunit register read from the shadow
+ * returns MV_OK when data is valid, MV_NOT_FOUND when the bus has to be accessed
+ */
+int mv_ddr_shadow_read(u32 dev_num, u32 reg_addr, u32 *data)
+{
+	int idx;
+
+	if (!shadow_ena)
+		return MV_NOT_FOUND;
+
+	idx = mv_ddr_shadow_idx_get(reg_addr);
+	if (idx < 0)
+		return MV_NOT_FOUND;
+
+	if (!shadow_valid[idx] || mv_ddr_shadow_tbl[idx].vol_mask != 0) {
+		MV_DDR_PROF_CNT_INC(MV_DDR_PROF_DUNIT_RD);
+		config_func_info[dev_num].mv_ddr_dunit_read(reg_addr, MASK_ALL_BITS, data);
+		shadow_val[idx] = *data & ~mv_ddr_shadow_tbl[idx].vol_mask;
+		shadow_valid[idx] = 1;
+		shadow_stats.rd_miss++;
+		return MV_OK;
+	}
+
+	*data = shadow_val[idx];
+	shadow_stats.rd_hit++;
+
+	return MV_OK;
+}
+
+/*
+ * merge a masked dunit register write into the shadow
+ * returns MV_NO_CHANGE when the write can be dropped; otherwise, for cached
+ * registers, data and mask are updated to a plain full register write
+ */
+int mv_ddr_shadow_write(u32 dev_num, u32 reg_addr, u32 *data, u32 *mask)
+{
+	u32 vol_mask, reg_val;
+	int idx;
+
+	if (!shadow_ena)
+		return MV_OK;
+
+	idx = mv_ddr_shadow_idx_get(reg_addr);
+	if (idx < 0)
+		return MV_OK;
+
+	vol_mask = mv_ddr_shadow_tbl[idx].vol_mask;
+	if (!shadow_valid[idx]) {
+		if (*mask != MASK_ALL_BITS) {
+			MV_DDR_PROF_CNT_INC(MV_DDR_PROF_DUNIT_RD);
+			config_func_info[dev_num].mv_ddr_dunit_read(reg_addr, MASK_ALL_BITS,
+								    &shadow_val[idx]);
+			shadow_val[idx] &= ~vol_mask;
+			shadow_valid[idx] = 1;
+		}
+	} else if (*mask != MASK_ALL_BITS) {
+		shadow_stats.rmw_saved++;
+	}
+
+	reg_val = (shadow_val[idx] & ~*mask) | (*data & *mask);
+	if (shadow_valid[idx] && (*mask & vol_mask) == 0 &&
+	    (reg_val & ~vol_mask) == shadow_val[idx]) {
+		shadow_stats.wr_skip++;
+		return MV_NO_CHANGE;
+	}
+
+	shadow_val[idx] = reg_val & ~vol_mask;
+	shadow_valid[idx] = 1;
+	shadow_stats.wr++;
+
+	*data = reg_val;
+	*mask = MASK_ALL_BITS;
+
+	return MV_OK;
+}
+
+struct mv_ddr_shadow_stats *mv_ddr_shadow_stats_get(void)
+{
+	return &shadow_stats;
+}
+
+void mv_ddr_shadow_stats_print(void)
+{
+	printf("mv_ddr: dunit shadow: %d bus accesses saved\n",
+	       shadow_stats.rd_hit + shadow_stats.wr_skip + shadow_stats.rmw_saved);
+	printf("\treads: %d hit, %d miss\n", shadow_stats.rd_hit, shadow_stats.rd_miss);
+	printf("\twrites: %d sent, %d dropped, %d rmw reads saved\n",
+	       shadow_stats.wr, shadow_stats.wr_skip, shadow_stats.rmw_saved);
+}
+#endif /* MV_DDR_SHADOW */
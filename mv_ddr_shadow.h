@@ -0,0 +1,34 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SHADOW_H
+#define _MV_DDR_SHADOW_H
+
+/*
+ * dunit shadow register cache
+ *
+ * when built with MV_DDR_SHADOW, software owned dunit registers listed in
+ * the volatility table are mirrored while the training flow runs:
+ * masked writes become plain writes, unchanged writes are dropped and
+ * reads of fully non-volatile registers are served from the shadow
+ */
+struct mv_ddr_shadow_stats {
+	u32 rd_hit;	/* reads served from the shadow */
+	u32 rd_miss;	/* reads of cached registers sent to the bus */
+	u32 wr_skip;	/* writes dropped as unchanged */
+	u32 rmw_saved;	/* read-modify-write reads saved */
+	u32 wr;		/* writes of cached registers sent to the bus */
+};
+
+#if defined(MV_DDR_SHADOW)
+void mv_ddr_shadow_start(void);
+void mv_ddr_shadow_stop(void);
+void mv_ddr_shadow_invalidate(void);
+int mv_ddr_shadow_read(u32 dev_num, u32 reg_addr, u32 *data);
+int mv_ddr_shadow_write(u32 dev_num, u32 reg_addr, u32 *data, u32 *mask);
+struct mv_ddr_shadow_stats *mv_ddr_shadow_stats_get(void);
+void mv_ddr_shadow_stats_print(void);
+#endif /* MV_DDR_SHADOW */
+
+#endif /* _MV_DDR_SHADOW_H */
@@ -0,0 +1,536 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_SNAPSHOT)
+
+/* training result snapshot and warm-boot restore */
+
+#include "ddr3_init.h"
+#include "mv_ddr_common.h"
+#include "mv_ddr_regs.h"
+#include "mv_ddr_training_db.h"
+#if defined(CONFIG_DDR4)
+#include "mv_ddr4_mpr_pda_if.h"
+#endif /* CONFIG_DDR4 */
+
+#define SNAPSHOT_CRC_OFFS	12	/* crc field offset in the header */
+#define SNAPSHOT_BIST_PATTERN	PATTERN_KILLER_DQ0
+#define SNAPSHOT_BIST_OFFS	32
+
+static u8 snapshot_buf[MV_DDR_SNAPSHOT_SIZE_MAX];
+static u32 snapshot_size;
+static const u8 *snapshot_blob;
+static u32 snapshot_blob_size;
+static u32 snapshot_board_id;
+
+/* pad and dunit setup found before a restore, put back if the snapshot is rejected */
+static u16 snapshot_undo_dpad[MAX_INTERFACE_NUM][MV_DDR_SNAPSHOT_DPAD_REGS][MAX_BUS_NUM];
+static u16 snapshot_undo_cpad[MAX_INTERFACE_NUM][MV_DDR_SNAPSHOT_CPAD_REGS][DDR_IF_CTRL_SUBPHYS_NUM];
+static u32 snapshot_undo_dunit[MAX_INTERFACE_NUM][MV_DDR_SNAPSHOT_DUNIT_REGS];
+
+/* data pad and control pad registers, not per cs */
+static const u32 snapshot_dpad_regs[MV_DDR_SNAPSHOT_DPAD_REGS] = {
+	PAD_ZRI_CAL_PHY_REG,
+	PAD_ODT_CAL_PHY_REG,
+	PAD_CFG_PHY_REG
+};
+
+static const u32 snapshot_cpad_regs[MV_DDR_SNAPSHOT_CPAD_REGS] = {
+	WL_PHY_REG(0),
+	PAD_ZRI_CAL_PHY_REG,
+	PAD_ODT_CAL_PHY_REG
+};
+
+/* read leveling results and odt timing */
+static const u32 snapshot_dunit_regs[MV_DDR_SNAPSHOT_DUNIT_REGS] = {
+	RD_DATA_SMPL_DLYS_REG,
+	RD_DATA_RDY_DLYS_REG,
+	DDR_ODT_TIMING_LOW_REG,
+	DDR_ODT_TIMING_HIGH_REG,
+	SDRAM_ODT_CTRL_HIGH_REG,
+	DUNIT_ODT_CTRL_REG,
+#if defined(CONFIG_DDR4)
+	DDR4_MR6_REG
+#else /* CONFIG_DDR4 */
+	0
+#endif /* CONFIG_DDR4 */
+};
+
+static void mv_ddr_snapshot_put16(u8 *buf, u32 *offs, u32 val)
+{
+	buf[(*offs)++] = val & 0xff;
+	buf[(*offs)++] = (val >> 8) & 0xff;
+}
+
+static void mv_ddr_snapshot_put32(u8 *buf, u32 *offs, u32 val)
+{
+	mv_ddr_snapshot_put16(buf, offs, val & 0xffff);
+	mv_ddr_snapshot_put16(buf, offs, val >> 16);
+}
+
+static u32 mv_ddr_snapshot_get16(const u8 *buf, u32 *offs)
+{
+	u32 val = buf[*offs] | (buf[*offs + 1] << 8);
+
+	*offs += 2;
+
+	return val;
+}
+
+static u32 mv_ddr_snapshot_get32(const u8 *buf, u32 *offs)
+{
+	u32 val = mv_ddr_snapshot_get16(buf, offs);
+
+	return val | (mv_ddr_snapshot_get16(buf, offs) << 16);
+}
+
+/* build the header describing the current board, dimm and frequency */
+static void mv_ddr_snapshot_hdr_init(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+
+	memset(hdr, 0, sizeof(*hdr));
+	hdr->magic = MV_DDR_SNAPSHOT_MAGIC;
+	hdr->version = MV_DDR_SNAPSHOT_VERSION;
+	hdr->hdr_size = MV_DDR_SNAPSHOT_HDR_SIZE;
+	if (tm->cfg_src == MV_DDR_CFG_SPD)
+		hdr->spd_hash = mv_ddr_crc32(0, tm->spd_data.all_bytes,
+					     sizeof(tm->spd_data.all_bytes));
+	else
+		hdr->spd_hash = mv_ddr_crc32(0, (u8 *)tm->interface_params,
+					     sizeof(tm->interface_params));
+	hdr->board_id = snapshot_board_id;
+	hdr->freq = mv_ddr_freq_get(tm->interface_params[first_active_if].memory_freq);
+	hdr->bus_act_mask = tm->bus_act_mask;
+	hdr->if_act_mask = tm->if_act_mask;
+	hdr->cs_num = mv_ddr_cs_num_get();
+	hdr->octets_per_if_num = ddr3_tip_dev_attr_get(dev_num, MV_ATTR_OCTET_PER_INTERFACE);
+	hdr->dunit_regs_num = MV_DDR_SNAPSHOT_DUNIT_REGS;
+}
+
+static void mv_ddr_snapshot_hdr_put(u8 *buf, struct mv_ddr_snapshot_hdr *hdr)
+{
+	u32 offs = 0;
+
+	mv_ddr_snapshot_put32(buf, &offs, hdr->magic);
+	mv_ddr_snapshot_put16(buf, &offs, hdr->version);
+	mv_ddr_snapshot_put16(buf, &offs, hdr->hdr_size);
+	mv_ddr_snapshot_put32(buf, &offs, hdr->size);
+	mv_ddr_snapshot_put32(buf, &offs, hdr->crc);
+	mv_ddr_snapshot_put32(buf, &offs, hdr->spd_hash);
+	mv_ddr_snapshot_put32(buf, &offs, hdr->board_id);
+	mv_ddr_snapshot_put32(buf, &offs, hdr->freq);
+	mv_ddr_snapshot_put16(buf, &offs, hdr->bus_act_mask);
+	buf[offs++] = hdr->if_act_mask;
+	buf[offs++] = hdr->cs_num;
+	buf[offs++] = hdr->octets_per_if_num;
+	buf[offs++] = hdr->dunit_regs_num;
+	mv_ddr_snapshot_put16(buf, &offs, hdr->reserved);
+}
+
+static void mv_ddr_snapshot_hdr_get(const u8 *buf, struct mv_ddr_snapshot_hdr *hdr)
+{
+	u32 offs = 0;
+
+	hdr->magic = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->version = mv_ddr_snapshot_get16(buf, &offs);
+	hdr->hdr_size = mv_ddr_snapshot_get16(buf, &offs);
+	hdr->size = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->crc = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->spd_hash = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->board_id = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->freq = mv_ddr_snapshot_get32(buf, &offs);
+	hdr->bus_act_mask = mv_ddr_snapshot_get16(buf, &offs);
+	hdr->if_act_mask = buf[offs++];
+	hdr->cs_num = buf[offs++];
+	hdr->octets_per_if_num = buf[offs++];
+	hdr->dunit_regs_num = buf[offs++];
+	hdr->reserved = mv_ddr_snapshot_get16(buf, &offs);
+}
+
+/* blob size for the layout described by a header */
+static u32 mv_ddr_snapshot_size_get(struct mv_ddr_snapshot_hdr *hdr)
+{
+	u32 if_id, phy, if_num = 0, phys_num = 0;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(hdr->if_act_mask, if_id);
+		if_num++;
+	}
+
+	for (phy = 0; phy < hdr->octets_per_if_num; phy++) {
+		VALIDATE_BUS_ACTIVE(hdr->bus_act_mask, phy);
+		phys_num++;
+	}
+
+	return MV_DDR_SNAPSHOT_HDR_SIZE + if_num *
+	       ((hdr->cs_num * PHY_CS_REGS_NUM + MV_DDR_SNAPSHOT_DPAD_REGS) * phys_num * 2 +
+		MV_DDR_SNAPSHOT_CPAD_REGS * DDR_IF_CTRL_SUBPHYS_NUM * 2 +
+		hdr->dunit_regs_num * 4);
+}
+
+static u32 mv_ddr_snapshot_blob_crc(const u8 *buf, u32 size)
+{
+	static const u8 zero[4];
+	u32 crc;
+
+	crc = mv_ddr_crc32(0, buf, SNAPSHOT_CRC_OFFS);
+	crc = mv_ddr_crc32(crc, zero, sizeof(zero));
+
+	return mv_ddr_crc32(crc, buf + SNAPSHOT_CRC_OFFS + sizeof(zero),
+			    size - SNAPSHOT_CRC_OFFS - sizeof(zero));
+}
+
+/* register the blob stored by the boot loader and the board id */
+void mv_ddr_snapshot_set(const u8 *blob, u32 size, u32 board_id)
+{
+	snapshot_blob = blob;
+	snapshot_blob_size = size;
+	snapshot_board_id = board_id;
+}
+
+/* get the blob built after the last full training */
+const u8 *mv_ddr_snapshot_get(u32 *size)
+{
+	*size = snapshot_size;
+
+	return (snapshot_size != 0) ? snapshot_buf : NULL;
+}
+
+/* serialize the trained state */
+int mv_ddr_snapshot_save(u32 dev_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	struct mv_ddr_snapshot_hdr hdr;
+	u32 if_id, cs, idx, phy, data;
+	u32 offs = MV_DDR_SNAPSHOT_HDR_SIZE;
+
+	snapshot_size = 0;
+	mv_ddr_snapshot_hdr_init(dev_num, &hdr);
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (cs = 0; cs < hdr.cs_num; cs++) {
+			for (idx = 0; idx < PHY_CS_REGS_NUM; idx++) {
+				for (phy = 0; phy < hdr.octets_per_if_num; phy++) {
+					VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+					CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+								       phy, DDR_PHY_DATA,
+								       mv_ddr_phy_cs_reg_get(cs, idx),
+								       &data));
+					mv_ddr_snapshot_put16(snapshot_buf, &offs, data);
+				}
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DPAD_REGS; idx++) {
+			for (phy = 0; phy < hdr.octets_per_if_num; phy++) {
+				VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+				CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							       phy, DDR_PHY_DATA,
+							       snapshot_dpad_regs[idx], &data));
+				mv_ddr_snapshot_put16(snapshot_buf, &offs, data);
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_CPAD_REGS; idx++) {
+			for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++) {
+				CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							       phy, DDR_PHY_CONTROL,
+							       snapshot_cpad_regs[idx], &data));
+				mv_ddr_snapshot_put16(snapshot_buf, &offs, data);
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DUNIT_REGS; idx++) {
+			data = 0;
+			if (snapshot_dunit_regs[idx] != 0)
+				CHECK_STATUS(ddr3_tip_if_read(dev_num, ACCESS_TYPE_UNICAST, if_id,
+							      snapshot_dunit_regs[idx], &data,
+							      MASK_ALL_BITS));
+			mv_ddr_snapshot_put32(snapshot_buf, &offs, data);
+		}
+	}
+
+	hdr.size = offs;
+	mv_ddr_snapshot_hdr_put(snapshot_buf, &hdr);
+	hdr.crc = mv_ddr_snapshot_blob_crc(snapshot_buf, offs);
+	mv_ddr_snapshot_hdr_put(snapshot_buf, &hdr);
+	snapshot_size = offs;
+
+	DEBUG_TRAINING_IP(DEBUG_LEVEL_INFO,
+			  ("mv_ddr: snapshot: saved %d bytes, crc 0x%x\n", offs, hdr.crc));
+
+	return MV_OK;
+}
+
+/* check the blob matches this board, dimm and frequency */
+static int mv_ddr_snapshot_validate(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	struct mv_ddr_snapshot_hdr cur;
+
+	if (snapshot_blob == NULL || snapshot_blob_size < MV_DDR_SNAPSHOT_HDR_SIZE)
+		return MV_NOT_FOUND;
+
+	mv_ddr_snapshot_hdr_get(snapshot_blob, hdr);
+	if (hdr->magic != MV_DDR_SNAPSHOT_MAGIC ||
+	    hdr->version != MV_DDR_SNAPSHOT_VERSION ||
+	    hdr->hdr_size != MV_DDR_SNAPSHOT_HDR_SIZE ||
+	    hdr->cs_num > MAX_CS_NUM || hdr->octets_per_if_num > MAX_BUS_NUM ||
+	    hdr->dunit_regs_num != MV_DDR_SNAPSHOT_DUNIT_REGS ||
+	    hdr->size != mv_ddr_snapshot_size_get(hdr) ||
+	    hdr->size > snapshot_blob_size || hdr->size > MV_DDR_SNAPSHOT_SIZE_MAX) {
+		printf("mv_ddr: snapshot: bad header\n");
+		return MV_BAD_VALUE;
+	}
+
+	if (hdr->crc != mv_ddr_snapshot_blob_crc(snapshot_blob, hdr->size)) {
+		printf("mv_ddr: snapshot: crc mismatch\n");
+		return MV_BAD_VALUE;
+	}
+
+	mv_ddr_snapshot_hdr_init(dev_num, &cur);
+	if (hdr->spd_hash != cur.spd_hash || hdr->board_id != cur.board_id ||
+	    hdr->freq != cur.freq || hdr->bus_act_mask != cur.bus_act_mask ||
+	    hdr->if_act_mask != cur.if_act_mask || hdr->cs_num != cur.cs_num ||
+	    hdr->octets_per_if_num != cur.octets_per_if_num ||
+	    hdr->dunit_regs_num != cur.dunit_regs_num) {
+		printf("mv_ddr: snapshot: board, dimm or frequency changed\n");
+		return MV_BAD_VALUE;
+	}
+
+	return MV_OK;
+}
+
+static int mv_ddr_snapshot_regs_load(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	const u8 *buf = snapshot_blob;
+	u32 if_id, cs, idx, phy, data;
+	u32 offs = MV_DDR_SNAPSHOT_HDR_SIZE;
+#if defined(CONFIG_DDR4)
+	u32 taps_num;
+#endif /* CONFIG_DDR4 */
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (cs = 0; cs < hdr->cs_num; cs++) {
+			for (idx = 0; idx < PHY_CS_REGS_NUM; idx++) {
+				for (phy = 0; phy < hdr->octets_per_if_num; phy++) {
+					VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+					data = mv_ddr_snapshot_get16(buf, &offs);
+					CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+									ACCESS_TYPE_UNICAST, phy, DDR_PHY_DATA,
+									mv_ddr_phy_cs_reg_get(cs, idx),
+									data));
+				}
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DPAD_REGS; idx++) {
+			for (phy = 0; phy < hdr->octets_per_if_num; phy++) {
+				VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+				data = mv_ddr_snapshot_get16(buf, &offs);
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, phy, DDR_PHY_DATA,
+								snapshot_dpad_regs[idx], data));
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_CPAD_REGS; idx++) {
+			for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++) {
+				data = mv_ddr_snapshot_get16(buf, &offs);
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, phy, DDR_PHY_CONTROL,
+								snapshot_cpad_regs[idx], data));
+			}
+		}
+		CHECK_STATUS(mv_ddr_phy_batch_flush(dev_num));
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DUNIT_REGS; idx++) {
+			data = mv_ddr_snapshot_get32(buf, &offs);
+			if (snapshot_dunit_regs[idx] != 0)
+				CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+							       snapshot_dunit_regs[idx], data,
+							       MASK_ALL_BITS));
+		}
+
+#if defined(CONFIG_DDR4)
+		/* program the trained dq vref into the dram; mr6 is the last dunit register */
+		taps_num = (data & 0x3f) + (((data >> 6) & 0x1) ? 0 : 23);
+		for (effective_cs = 0; effective_cs < hdr->cs_num; effective_cs++) {
+			CHECK_STATUS(mv_ddr4_vref_tap_set(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							  taps_num, MV_DDR4_VREF_TAP_START));
+			CHECK_STATUS(mv_ddr4_vref_tap_set(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							  taps_num, MV_DDR4_VREF_TAP_END));
+			CHECK_STATUS(mv_ddr4_vref_training_mode_ctrl(dev_num, if_id,
+								     ACCESS_TYPE_UNICAST, 0));
+		}
+		effective_cs = 0;
+#endif /* CONFIG_DDR4 */
+	}
+
+	return MV_OK;
+}
+
+/* the snapshot phy writes go out in a phy batch */
+static int mv_ddr_snapshot_apply(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	CHECK_STATUS(mv_ddr_phy_batch_start(dev_num));
+
+	return mv_ddr_phy_batch_end(dev_num, mv_ddr_snapshot_regs_load(dev_num, hdr));
+}
+
+/*
+ * quick write-read bist over all active interfaces and cs; odpg addresses
+ * are cs relative, so the test runs at the start of each cs
+ */
+static int mv_ddr_snapshot_bist(u32 dev_num, u32 cs_num)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	struct bist_result res;
+	u32 if_id, cs;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (cs = 0; cs < cs_num; cs++) {
+			CHECK_STATUS(ddr3_tip_bist_activate(dev_num, SNAPSHOT_BIST_PATTERN,
+							    ACCESS_TYPE_UNICAST, if_id, OPER_WRITE,
+							    STRESS_NONE, DURATION_SINGLE, BIST_START,
+							    SNAPSHOT_BIST_OFFS, cs, 15));
+			CHECK_STATUS(ddr3_tip_bist_activate(dev_num, SNAPSHOT_BIST_PATTERN,
+							    ACCESS_TYPE_UNICAST, if_id, OPER_READ,
+							    STRESS_NONE, DURATION_SINGLE, BIST_START,
+							    SNAPSHOT_BIST_OFFS, cs, 15));
+			CHECK_STATUS(ddr3_tip_bist_read_result(dev_num, if_id, &res));
+			if (res.bist_error_cnt != 0) {
+				printf("mv_ddr: snapshot: bist failed, if %d cs %d, %d errors\n",
+				       if_id, cs, res.bist_error_cnt);
+				return MV_FAIL;
+			}
+		}
+	}
+
+	return MV_OK;
+}
+
+/* keep the pad and dunit registers a snapshot overwrites */
+static int mv_ddr_snapshot_undo_save(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 if_id, idx, phy, data;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DPAD_REGS; idx++) {
+			for (phy = 0; phy < hdr->octets_per_if_num; phy++) {
+				VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+				CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							       phy, DDR_PHY_DATA,
+							       snapshot_dpad_regs[idx], &data));
+				snapshot_undo_dpad[if_id][idx][phy] = (u16)data;
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_CPAD_REGS; idx++) {
+			for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++) {
+				CHECK_STATUS(ddr3_tip_bus_read(dev_num, if_id, ACCESS_TYPE_UNICAST,
+							       phy, DDR_PHY_CONTROL,
+							       snapshot_cpad_regs[idx], &data));
+				snapshot_undo_cpad[if_id][idx][phy] = (u16)data;
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DUNIT_REGS; idx++) {
+			if (snapshot_dunit_regs[idx] == 0)
+				continue;
+			CHECK_STATUS(ddr3_tip_if_read(dev_num, ACCESS_TYPE_UNICAST, if_id,
+						      snapshot_dunit_regs[idx], &data, MASK_ALL_BITS));
+			snapshot_undo_dunit[if_id][idx] = data;
+		}
+	}
+
+	return MV_OK;
+}
+
+/*
+ * put back the pad and dunit registers kept before the restore; the dram
+ * vref a ddr4 snapshot programmed is set again by the full training
+ */
+static int mv_ddr_snapshot_undo(u32 dev_num, struct mv_ddr_snapshot_hdr *hdr)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 if_id, idx, phy;
+
+	for (if_id = 0; if_id < MAX_INTERFACE_NUM; if_id++) {
+		VALIDATE_IF_ACTIVE(tm->if_act_mask, if_id);
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DPAD_REGS; idx++) {
+			for (phy = 0; phy < hdr->octets_per_if_num; phy++) {
+				VALIDATE_BUS_ACTIVE(tm->bus_act_mask, phy);
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, phy, DDR_PHY_DATA,
+								snapshot_dpad_regs[idx],
+								snapshot_undo_dpad[if_id][idx][phy]));
+			}
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_CPAD_REGS; idx++) {
+			for (phy = 0; phy < DDR_IF_CTRL_SUBPHYS_NUM; phy++)
+				CHECK_STATUS(ddr3_tip_bus_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+								ACCESS_TYPE_UNICAST, phy, DDR_PHY_CONTROL,
+								snapshot_cpad_regs[idx],
+								snapshot_undo_cpad[if_id][idx][phy]));
+		}
+
+		for (idx = 0; idx < MV_DDR_SNAPSHOT_DUNIT_REGS; idx++) {
+			if (snapshot_dunit_regs[idx] == 0)
+				continue;
+			CHECK_STATUS(ddr3_tip_if_write(dev_num, ACCESS_TYPE_UNICAST, if_id,
+						       snapshot_dunit_regs[idx],
+						       snapshot_undo_dunit[if_id][idx], MASK_ALL_BITS));
+		}
+	}
+
+	return MV_OK;
+}
+
+/*
+ * restore the trained state from the registered blob; called with the
+ * controller initialized at the target frequency. on failure the pad and
+ * dunit registers the blob overwrote are put back, the phy training
+ * registers are reset and the caller runs the full training.
+ */
+int mv_ddr_snapshot_restore(u32 dev_num)
+{
+	struct mv_ddr_snapshot_hdr hdr;
+	int status;
+
+	status = mv_ddr_snapshot_validate(dev_num, &hdr);
+	if (status != MV_OK)
+		return status;
+
+	CHECK_STATUS(mv_ddr_snapshot_undo_save(dev_num, &hdr));
+	status = mv_ddr_snapshot_apply(dev_num, &hdr);
+#if defined(MV_DDR_RETRAIN)
+	/* retrain the byte lanes the restored setup no longer fits */
+	if (status == MV_OK)
+		status = mv_ddr_retrain(dev_num, hdr.cs_num);
+#endif /* MV_DDR_RETRAIN */
+	if (status == MV_OK)
+		status = mv_ddr_snapshot_bist(dev_num, hdr.cs_num);
+
+	if (status != MV_OK) {
+		printf("mv_ddr: snapshot: rejected, running full training\n");
+		CHECK_STATUS(mv_ddr_snapshot_undo(dev_num, &hdr));
+		for (effective_cs = 0; effective_cs < hdr.cs_num; effective_cs++)
+			CHECK_STATUS(ddr3_tip_ddr3_reset_phy_regs(dev_num));
+		effective_cs = 0;
+		return MV_FAIL;
+	}
+
+	printf("mv_ddr: snapshot: restored %d bytes\n", hdr.size);
+
+	return MV_OK;
+}
+#endif /* MV_DDR_SNAPSHOT */
@@ -0,0 +1,64 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SNAPSHOT_H
+#define _MV_DDR_SNAPSHOT_H
+
+#if defined(MV_DDR_SNAPSHOT)
+/*
+ * training result snapshot
+ *
+ * after a successful full training the trained phy and controller state
+ * is serialized into a versioned, crc protected blob that the boot loader
+ * may store; on the next boot a blob handed over thru mv_ddr_snapshot_set()
+ * is checked against the spd hash, board id and target frequency, applied
+ * directly and accepted only if a quick bist pass finds no errors,
+ * otherwise the full training flow runs.
+ *
+ * blob layout (little endian): the header below followed by
+ * - per active interface, per cs, per data register, per active data
+ *   subphy: u16 value (wl, ctx, rl, crx, pbs tx, pbs rx and vref regs)
+ * - per active interface, per data pad register, per active data subphy:
+ *   u16 value
+ * - per active interface, per control pad register, per control subphy:
+ *   u16 value
+ * - per active interface, per dunit register: u32 value
+ */
+#define MV_DDR_SNAPSHOT_MAGIC		0x5344564d	/* "MVDS" */
+#define MV_DDR_SNAPSHOT_VERSION		1
+#define MV_DDR_SNAPSHOT_HDR_SIZE	36
+
+#define MV_DDR_SNAPSHOT_DPAD_REGS	3
+#define MV_DDR_SNAPSHOT_CPAD_REGS	3
+#define MV_DDR_SNAPSHOT_DUNIT_REGS	7
+#define MV_DDR_SNAPSHOT_SIZE_MAX					\
+	(MV_DDR_SNAPSHOT_HDR_SIZE + MAX_INTERFACE_NUM *			\
+	 ((MAX_CS_NUM * PHY_CS_REGS_NUM + MV_DDR_SNAPSHOT_DPAD_REGS) * MAX_BUS_NUM * 2 + \
+	  MV_DDR_SNAPSHOT_CPAD_REGS * DDR_IF_CTRL_SUBPHYS_NUM * 2 +	\
+	  MV_DDR_SNAPSHOT_DUNIT_REGS * 4))
+
+struct mv_ddr_snapshot_hdr {
+	u32 magic;
+	u16 version;
+	u16 hdr_size;
+	u32 size;		/* blob size, header included */
+	u32 crc;		/* crc32 of the blob with this field zeroed */
+	u32 spd_hash;		/* crc32 of spd or of the topology parameters */
+	u32 board_id;
+	u32 freq;		/* target frequency [MHz] */
+	u16 bus_act_mask;
+	u8 if_act_mask;
+	u8 cs_num;
+	u8 octets_per_if_num;
+	u8 dunit_regs_num;
+	u16 reserved;
+};
+
+void mv_ddr_snapshot_set(const u8 *blob, u32 size, u32 board_id);
+const u8 *mv_ddr_snapshot_get(u32 *size);
+int mv_ddr_snapshot_save(u32 dev_num);
+int mv_ddr_snapshot_restore(u32 dev_num);
+#endif /* MV_DDR_SNAPSHOT */
+
+#endif /* _MV_DDR_SNAPSHOT_H */
@@ -224,7 +224,7 @@ unsigned int mv_ddr_cs_num_get(void)
 	unsigned int sphy_max = ddr3_tip_dev_attr_get(0, MV_ATTR_OCTET_PER_INTERFACE);
 
 	for (sphy = 0; sphy < sphy_max; sphy++) {
-		VALIDATE_BUS_ACTIVE(tm->bus_act_mask, sphy);
+		VALIDATE_ACTIVE(tm->bus_act_mask, sphy);
 		break;
 	}
 
@@ -279,7 +279,7 @@ unsigned long long mv_ddr_mem_sz_per_cs_get(void)
 
 	/* calc number of active subphys excl. ecc one */
 	for (i = 0, sphys = 0; i < sphy_max - 1; i++) {
-		VALIDATE_BUS_ACTIVE(tm->bus_act_mask, i);
+		VALIDATE_ACTIVE(tm->bus_act_mask, i);
 		sphys++;
 	}
 
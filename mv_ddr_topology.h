@@ -346,8 +346,20 @@ enum mv_ddr_die_count {
 		continue;			\
 	}
 
+#if defined(MV_DDR_RETRAIN)
+/*
+ * subphys the training stages run on; a retrain narrows it to the failing
+ * subphys (see mv_ddr_retrain.h), bus_act_mask keeps the bus width; code
+ * that follows the hardware rather than the training uses VALIDATE_ACTIVE
+ */
+extern unsigned int mv_ddr_retrain_bus_mask;
+
+#define IS_BUS_ACTIVE(if_mask , if_id) \
+	((((if_mask) & mv_ddr_retrain_bus_mask) >> (if_id)) & 1)
+#else /* MV_DDR_RETRAIN */
 #define IS_BUS_ACTIVE(if_mask , if_id) \
 	(((if_mask) >> (if_id)) & 1)
+#endif /* MV_DDR_RETRAIN */
 
 #define VALIDATE_BUS_ACTIVE(mask, id)		\
 	{					\
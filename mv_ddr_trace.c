@@ -0,0 +1,251 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_TRACE)
+
+/* register access trace */
+
+#include "ddr3_init.h"
+
+struct mv_ddr_trace_entry {
+	u32 ts;
+	u8 op;
+	u8 phy;
+	u16 arg;
+	u32 addr;
+	u32 data;
+	u32 mask;
+};
+
+/* the first entries logged, and the last ones in a ring for the failure print */
+static struct mv_ddr_trace_entry mv_ddr_trace_buf[MV_DDR_TRACE_ENTRIES];
+static struct mv_ddr_trace_entry mv_ddr_trace_tail[MV_DDR_TRACE_FAIL_PRINT];
+static u32 trace_total;		/* entries logged since the last reset */
+
+/* record played back: next entry, entries and first entry not matched */
+static struct {
+	const u8 *entry;
+	u32 entry_size;
+	u32 idx;
+	u32 count;
+	u32 diverged;
+} trace_play;
+
+static const char *const mv_ddr_trace_op_name[MV_DDR_TRACE_OP_MAX] = {
+	[MV_DDR_TRACE_DUNIT_RD] = "dunit_rd",
+	[MV_DDR_TRACE_DUNIT_WR] = "dunit_wr",
+	[MV_DDR_TRACE_PHY_RD] = "phy_rd",
+	[MV_DDR_TRACE_PHY_WR] = "phy_wr",
+	[MV_DDR_TRACE_POLL] = "poll",
+	[MV_DDR_TRACE_STAGE] = "stage"
+};
+
+static u32 mv_ddr_trace_get(const u8 *buf, u32 size)
+{
+	u32 val = 0;
+	u32 i;
+
+	for (i = 0; i < size; i++)
+		val |= buf[i] << (8 * i);
+
+	return val;
+}
+
+/*
+ * match an access of the running flow with the next entry of the played back
+ * record; returns the data of a read as recorded. playback ends at the first
+ * access that does not match, the flow then goes on with the actual values
+ */
+static u32 mv_ddr_trace_play(u32 op, u32 phy, u32 arg, u32 addr, u32 data, u32 mask)
+{
+	const u8 *ptr = trace_play.entry;
+	int is_rd = (op == MV_DDR_TRACE_DUNIT_RD || op == MV_DDR_TRACE_PHY_RD);
+
+	if (ptr[4] != op || ptr[5] != phy || mv_ddr_trace_get(ptr + 6, 2) != arg ||
+	    mv_ddr_trace_get(ptr + 8, 4) != addr || mv_ddr_trace_get(ptr + 16, 4) != mask ||
+	    (!is_rd && mv_ddr_trace_get(ptr + 12, 4) != data)) {
+		printf("mv_ddr: trace: playback diverged at entry %d: %s 0x%x, recorded %s 0x%x\n",
+		       trace_play.idx, mv_ddr_trace_op_name[op], addr,
+		       (ptr[4] < MV_DDR_TRACE_OP_MAX) ? mv_ddr_trace_op_name[ptr[4]] : "?",
+		       mv_ddr_trace_get(ptr + 8, 4));
+		trace_play.diverged = trace_play.idx;
+		trace_play.entry = NULL;
+		return data;
+	}
+
+	if (is_rd)
+		data = mv_ddr_trace_get(ptr + 12, 4);
+	trace_play.entry += trace_play.entry_size;
+	if (++trace_play.idx == trace_play.count)
+		trace_play.entry = NULL;
+
+	return data;
+}
+
+u32 mv_ddr_trace_log(u32 op, u32 phy, u32 arg, u32 addr, u32 data, u32 mask)
+{
+	struct mv_ddr_trace_entry *entry;
+
+	arg = (arg > 0xffff) ? 0xffff : arg;
+	if (trace_play.entry != NULL)
+		data = mv_ddr_trace_play(op, phy, arg, addr, data, mask);
+
+	entry = &mv_ddr_trace_tail[trace_total % MV_DDR_TRACE_FAIL_PRINT];
+	entry->ts = mv_ddr_time_ticks();
+	entry->op = op;
+	entry->phy = phy;
+	entry->arg = arg;
+	entry->addr = addr;
+	entry->data = data;
+	entry->mask = mask;
+	/* keep the head of the run: a record is replayable from reset only */
+	if (trace_total < MV_DDR_TRACE_ENTRIES)
+		mv_ddr_trace_buf[trace_total] = *entry;
+	trace_total++;
+
+	return data;
+}
+
+void mv_ddr_trace_reset(void)
+{
+	trace_total = 0;
+}
+
+static u32 mv_ddr_trace_count_get(void)
+{
+	return (trace_total < MV_DDR_TRACE_ENTRIES) ? trace_total : MV_DDR_TRACE_ENTRIES;
+}
+
+/* print the last num entries, oldest first */
+void mv_ddr_trace_print(u32 num)
+{
+	struct mv_ddr_trace_entry *entry;
+	u32 i;
+
+	if (num > MV_DDR_TRACE_FAIL_PRINT)
+		num = MV_DDR_TRACE_FAIL_PRINT;
+	if (num > trace_total)
+		num = trace_total;
+
+	printf("mv_ddr: trace: last %d of %d accesses\n", num, trace_total);
+	for (i = trace_total - num; i != trace_total; i++) {
+		entry = &mv_ddr_trace_tail[i % MV_DDR_TRACE_FAIL_PRINT];
+		printf("%10u %-8s %02x %5d 0x%08x 0x%08x 0x%08x\n", entry->ts,
+		       mv_ddr_trace_op_name[entry->op], entry->phy, entry->arg,
+		       entry->addr, entry->data, entry->mask);
+	}
+}
+
+static u8 *mv_ddr_trace_put(u8 *buf, u32 val, u32 size)
+{
+	u32 i;
+
+	for (i = 0; i < size; i++)
+		*buf++ = (val >> (8 * i)) & 0xff;
+
+	return buf;
+}
+
+/*
+ * serialize the buffer into a binary record, as described in mv_ddr_trace.h;
+ * buf must hold the header and all logged entries, MV_DDR_TRACE_RECORD_MAX_SIZE
+ * bytes at most
+ */
+int mv_ddr_trace_record_get(u8 *buf, u32 size, u32 *len)
+{
+	struct mv_ddr_trace_entry *entry;
+	u32 count = mv_ddr_trace_count_get();
+	u8 *ptr;
+	u32 i;
+
+	if (buf == NULL || len == NULL ||
+	    size < MV_DDR_TRACE_HDR_SIZE + count * MV_DDR_TRACE_ENTRY_SIZE)
+		return MV_BAD_PARAM;
+
+	ptr = mv_ddr_trace_put(buf, MV_DDR_TRACE_MAGIC, 4);
+	ptr = mv_ddr_trace_put(ptr, MV_DDR_TRACE_VERSION, 2);
+	ptr = mv_ddr_trace_put(ptr, MV_DDR_TRACE_HDR_SIZE, 1);
+	ptr = mv_ddr_trace_put(ptr, MV_DDR_TRACE_ENTRY_SIZE, 1);
+	ptr = mv_ddr_trace_put(ptr, count, 4);
+	ptr = mv_ddr_trace_put(ptr, trace_total, 4);
+	ptr = mv_ddr_trace_put(ptr, mv_ddr_time_ticks_hz(), 4);
+
+	for (i = 0; i < count; i++) {
+		entry = &mv_ddr_trace_buf[i];
+		ptr = mv_ddr_trace_put(ptr, entry->ts, 4);
+		ptr = mv_ddr_trace_put(ptr, entry->op, 1);
+		ptr = mv_ddr_trace_put(ptr, entry->phy, 1);
+		ptr = mv_ddr_trace_put(ptr, entry->arg, 2);
+		ptr = mv_ddr_trace_put(ptr, entry->addr, 4);
+		ptr = mv_ddr_trace_put(ptr, entry->data, 4);
+		ptr = mv_ddr_trace_put(ptr, entry->mask, 4);
+	}
+
+	*len = ptr - buf;
+	if (trace_total > count)
+		printf("mv_ddr: trace: last %d of %d accesses not kept, "
+		       "MV_DDR_TRACE_ENTRIES of %d would hold the run\n",
+		       trace_total - count, trace_total, trace_total);
+
+	return MV_OK;
+}
+
+/*
+ * play a record back: the following accesses of the flow are matched with the
+ * recorded ones and reads return the recorded values, until the record ends
+ * or the flow diverges from it; a wrapped ring record cannot be played back
+ */
+int mv_ddr_trace_playback_start(const u8 *buf, u32 len)
+{
+	u32 version, hdr_size, entry_size, count;
+
+	trace_play.entry = NULL;
+	if (buf == NULL || len < MV_DDR_TRACE_HDR_SIZE ||
+	    mv_ddr_trace_get(buf, 4) != MV_DDR_TRACE_MAGIC) {
+		printf("mv_ddr: trace: not a trace record\n");
+		return MV_BAD_PARAM;
+	}
+
+	version = mv_ddr_trace_get(buf + 4, 2);
+	hdr_size = buf[6];
+	entry_size = buf[7];
+	count = mv_ddr_trace_get(buf + 8, 4);
+	if (version != MV_DDR_TRACE_VERSION && version != MV_DDR_TRACE_VERSION_RING) {
+		printf("mv_ddr: trace: unsupported trace record version %d\n", version);
+		return MV_NOT_SUPPORTED;
+	}
+	if (version == MV_DDR_TRACE_VERSION_RING && mv_ddr_trace_get(buf + 12, 4) != count) {
+		printf("mv_ddr: trace: wrapped trace record, lost its first %d entries; "
+		       "it cannot be played back from reset\n", mv_ddr_trace_get(buf + 12, 4) - count);
+		return MV_NOT_SUPPORTED;
+	}
+	if (hdr_size < MV_DDR_TRACE_HDR_SIZE || entry_size < MV_DDR_TRACE_ENTRY_SIZE ||
+	    len < hdr_size + count * entry_size) {
+		printf("mv_ddr: trace: truncated trace record\n");
+		return MV_BAD_PARAM;
+	}
+
+	trace_play.entry = (count != 0) ? buf + hdr_size : NULL;
+	trace_play.entry_size = entry_size;
+	trace_play.idx = 0;
+	trace_play.count = count;
+	trace_play.diverged = count;
+
+	return MV_OK;
+}
+
+/*
+ * end the playback; played gets the number of entries matched.
+ * returns MV_FAIL if the flow diverged from the record before its end
+ */
+int mv_ddr_trace_playback_stop(u32 *played)
+{
+	if (played != NULL)
+		*played = trace_play.idx;
+	trace_play.entry = NULL;
+
+	return (trace_play.diverged == trace_play.count && trace_play.idx == trace_play.count) ?
+	       MV_OK : MV_FAIL;
+}
+#endif /* MV_DDR_TRACE */
@@ -0,0 +1,95 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_TRACE_H
+#define _MV_DDR_TRACE_H
+
+/*
+ * register access trace
+ *
+ * when built with MV_DDR_TRACE, every dunit read and write, phy register
+ * file access and poll result that reaches the bus is logged with a time
+ * base stamp into a buffer in sram. logging stops once the buffer is full,
+ * so a record always starts at ddr3_init() and can be replayed from reset;
+ * the last MV_DDR_TRACE_FAIL_PRINT entries are kept apart for the failure
+ * print. the buffer may be dumped as a binary record (e.g. to dram once
+ * training passed) and played back on the host: the training flow runs on
+ * the simulated register file and its reads return the recorded values, so
+ * a recorded failure reproduces.
+ */
+enum mv_ddr_trace_op {
+	MV_DDR_TRACE_DUNIT_RD,	/* addr, data, mask */
+	MV_DDR_TRACE_DUNIT_WR,	/* addr, data, mask */
+	MV_DDR_TRACE_PHY_RD,	/* phy type/access, subphy, addr, data */
+	MV_DDR_TRACE_PHY_WR,	/* phy type/access, subphy, addr, data */
+	MV_DDR_TRACE_POLL,	/* failed flag, tries, addr, expected data, mask */
+	MV_DDR_TRACE_STAGE,	/* training stage */
+	MV_DDR_TRACE_OP_MAX
+};
+
+/* phy field of phy accesses */
+#define MV_DDR_TRACE_PHY_CTRL		0x1	/* control phy, data phy otherwise */
+#define MV_DDR_TRACE_PHY_MCAST		0x2	/* multicast access */
+#define MV_DDR_TRACE_PHY(phy_access, phy_type)					\
+	((((phy_type) == DDR_PHY_CONTROL) ? MV_DDR_TRACE_PHY_CTRL : 0) |	\
+	 (((phy_access) == ACCESS_TYPE_MULTICAST) ? MV_DDR_TRACE_PHY_MCAST : 0))
+
+/*
+ * binary record, little-endian:
+ * header: magic (4), version (2), header size (1), entry size (1),
+ *	   entry count (4), logged total (4), time base frequency in hz (4)
+ * entry:  time base stamp (4), op (1), phy (1), arg (2), addr (4),
+ *	   data (4), mask (4)
+ * entries are the first ones logged, oldest first; logged total minus entry
+ * count is the number of entries at the end of the run that did not fit.
+ * version 1 records were kept in a ring, so they lost the oldest entries
+ * instead and cannot be played back once wrapped.
+ */
+#define MV_DDR_TRACE_MAGIC		0x5444564d /* "MVDT" */
+#define MV_DDR_TRACE_VERSION		2
+#define MV_DDR_TRACE_VERSION_RING	1
+#define MV_DDR_TRACE_HDR_SIZE		20
+#define MV_DDR_TRACE_ENTRY_SIZE		20
+
+/*
+ * buffer size in entries; override per platform to fit the sram budget.
+ * a full a70x0 ddr4 training logs about 230k entries, so a complete record
+ * needs MV_DDR_TRACE_ENTRIES of 0x40000 (5MB, as the simulator build uses);
+ * the default only holds the first stages of the run. a dump reports the
+ * entries that did not fit.
+ */
+#if !defined(MV_DDR_TRACE_ENTRIES)
+#define MV_DDR_TRACE_ENTRIES		1024
+#endif
+#define MV_DDR_TRACE_RECORD_MAX_SIZE	(MV_DDR_TRACE_HDR_SIZE + \
+					 MV_DDR_TRACE_ENTRIES * MV_DDR_TRACE_ENTRY_SIZE)
+
+/* entries printed on a training failure */
+#define MV_DDR_TRACE_FAIL_PRINT		32
+
+#if defined(MV_DDR_TRACE)
+/* platforms w/o a free running counter log zero stamps */
+#if !defined(mv_ddr_time_ticks)
+#define mv_ddr_time_ticks()		0
+#define mv_ddr_time_ticks_hz()		0
+#endif
+
+u32 mv_ddr_trace_log(u32 op, u32 phy, u32 arg, u32 addr, u32 data, u32 mask);
+#define MV_DDR_TRACE_LOG(op, phy, arg, addr, data, mask) \
+	mv_ddr_trace_log((op), (phy), (arg), (addr), (data), (mask))
+/* log a read; under playback, the read returns the recorded value */
+#define MV_DDR_TRACE_READ(op, phy, arg, addr, data, mask) \
+	(*(data) = mv_ddr_trace_log((op), (phy), (arg), (addr), *(data), (mask)))
+
+void mv_ddr_trace_reset(void);
+void mv_ddr_trace_print(u32 num);
+int mv_ddr_trace_record_get(u8 *buf, u32 size, u32 *len);
+int mv_ddr_trace_playback_start(const u8 *buf, u32 len);
+int mv_ddr_trace_playback_stop(u32 *played);
+#else
+#define MV_DDR_TRACE_LOG(op, phy, arg, addr, data, mask)
+#define MV_DDR_TRACE_READ(op, phy, arg, addr, data, mask)
+#endif /* MV_DDR_TRACE */
+
+#endif /* _MV_DDR_TRACE_H */
@@ -0,0 +1,136 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* completion-driven waits */
+
+#include "ddr3_init.h"
+
+static struct mv_ddr_wait_stats mv_ddr_wait_db[MV_DDR_WAIT_ID_MAX];
+
+static const char *const mv_ddr_wait_name[MV_DDR_WAIT_ID_MAX] = {
+	[MV_DDR_WAIT_ODPG_DONE] = "odpg done",
+	[MV_DDR_WAIT_ODPG_IDLE] = "odpg idle",
+	[MV_DDR_WAIT_DRV_RESET] = "divider reset",
+	[MV_DDR_WAIT_ADLL_RESET] = "adll reset",
+	[MV_DDR_WAIT_ADLL_LOCK] = "adll lock",
+	[MV_DDR_WAIT_PUP_RESET] = "pup reset",
+	[MV_DDR_WAIT_PAD_CAL] = "pads calibration"
+};
+
+/* w/o a time base, account for the settle guard and the poll steps */
+static void mv_ddr_wait_record(enum mv_ddr_wait_id id, u32 start, u32 settle_us,
+			       u32 polls, int timeout)
+{
+	struct mv_ddr_wait_stats *db = &mv_ddr_wait_db[id];
+	u32 elapsed = mv_ddr_time_us() - start;
+
+	if (elapsed == 0)
+		elapsed = settle_us + polls * MV_DDR_WAIT_POLL_US;
+
+	if (timeout)
+		db->timeouts++;
+	if (db->cnt == 0 || elapsed < db->min_us)
+		db->min_us = elapsed;
+	if (elapsed > db->max_us)
+		db->max_us = elapsed;
+	db->total_us += elapsed;
+	db->cnt++;
+}
+
+/*
+ * wait for (reg & mask) == exp_value after a minimum settle time;
+ * a multicast wait completes when all active interfaces match;
+ * returns MV_TIMEOUT if not reached within timeout_us
+ */
+int mv_ddr_wait_reg(u32 dev_num, enum mv_ddr_wait_id id, enum hws_access_type access_type,
+		    u32 if_id, u32 reg_addr, u32 exp_value, u32 mask, u32 settle_us, u32 timeout_us)
+{
+	struct mv_ddr_topology_map *tm = mv_ddr_topology_map_get();
+	u32 reg_data[MAX_INTERFACE_NUM];
+	u32 start = mv_ddr_time_us();
+	u32 polls, start_if, end_if, i;
+	int done;
+
+	if (access_type == ACCESS_TYPE_MULTICAST) {
+		start_if = 0;
+		end_if = MAX_INTERFACE_NUM - 1;
+	} else {
+		start_if = if_id;
+		end_if = if_id;
+	}
+
+	if (settle_us)
+		udelay(settle_us);
+
+	for (polls = 0; polls * MV_DDR_WAIT_POLL_US < timeout_us; polls++) {
+		CHECK_STATUS(ddr3_tip_if_read(dev_num, access_type, if_id,
+					      reg_addr, reg_data, mask));
+		done = 1;
+		for (i = start_if; i <= end_if; i++) {
+			VALIDATE_IF_ACTIVE(tm->if_act_mask, i);
+			if (reg_data[i] != exp_value)
+				done = 0;
+		}
+		if (done) {
+			mv_ddr_wait_record(id, start, settle_us, polls, 0);
+			return MV_OK;
+		}
+		udelay(MV_DDR_WAIT_POLL_US);
+	}
+
+	mv_ddr_wait_record(id, start, settle_us, polls, 1);
+	DEBUG_TRAINING_IP(DEBUG_LEVEL_ERROR,
+			  ("%s: %s: timeout (reg 0x%x)\n", __func__, mv_ddr_wait_name[id], reg_addr));
+
+	return MV_TIMEOUT;
+}
+
+/* wait for the odpg to complete after a minimum settle time */
+int mv_ddr_wait_odpg_done(enum mv_ddr_wait_id id, u32 settle_us)
+{
+	u32 start = mv_ddr_time_us();
+	int status;
+
+	if (settle_us)
+		udelay(settle_us);
+
+	status = mv_ddr_is_odpg_done(MAX_POLLING_ITERATIONS);
+	mv_ddr_wait_record(id, start, settle_us, 0, status != MV_OK);
+
+	return (status == MV_OK) ? MV_OK : MV_FAIL;
+}
+
+/* fixed settle time with no completion indication */
+void mv_ddr_wait_settle(enum mv_ddr_wait_id id, u32 settle_us)
+{
+	u32 start = mv_ddr_time_us();
+
+	udelay(settle_us);
+	mv_ddr_wait_record(id, start, settle_us, 0, 0);
+}
+
+struct mv_ddr_wait_stats *mv_ddr_wait_stats_get(enum mv_ddr_wait_id id)
+{
+	if (id >= MV_DDR_WAIT_ID_MAX)
+		return NULL;
+
+	return &mv_ddr_wait_db[id];
+}
+
+void mv_ddr_wait_stats_print(void)
+{
+	struct mv_ddr_wait_stats *db;
+	u32 id;
+
+	printf("mv_ddr: waits\n");
+	printf("%-18s %6s %8s %8s %8s %10s\n", "wait", "count", "timeout", "min[us]", "max[us]",
+	       "total[us]");
+	for (id = 0; id < MV_DDR_WAIT_ID_MAX; id++) {
+		db = &mv_ddr_wait_db[id];
+		if (db->cnt == 0)
+			continue;
+		printf("%-18s %6d %8d %8d %8d %10d\n", mv_ddr_wait_name[id], db->cnt,
+		       db->timeouts, db->min_us, db->max_us, db->total_us);
+	}
+}
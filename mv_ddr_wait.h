@@ -0,0 +1,54 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_WAIT_H
+#define _MV_DDR_WAIT_H
+
+/*
+ * completion-driven waits
+ *
+ * a wait applies a minimum settle guard and then polls the relevant done
+ * bit, bounded by a timeout; the elapsed time of every wait is recorded
+ * per wait point so the settle guards can be tuned from data
+ */
+enum mv_ddr_wait_id {
+	MV_DDR_WAIT_ODPG_DONE,		/* odpg pattern load done */
+	MV_DDR_WAIT_ODPG_IDLE,		/* odpg returned to default */
+	MV_DDR_WAIT_DRV_RESET,		/* divider_b reset pulse */
+	MV_DDR_WAIT_ADLL_RESET,		/* adll reset pulse */
+	MV_DDR_WAIT_ADLL_LOCK,		/* adll lock */
+	MV_DDR_WAIT_PUP_RESET,		/* data pup reset pulse */
+	MV_DDR_WAIT_PAD_CAL,		/* pads calibration done */
+	MV_DDR_WAIT_ID_MAX
+};
+
+/* settle guards and timeouts, in microseconds */
+#define MV_DDR_WAIT_POLL_US		1
+#define MV_DDR_ODPG_SETTLE_US		1
+#define MV_DDR_ODPG_IDLE_SETTLE_US	10
+/* reset pulses have no status to poll; keep their original 10ms width */
+#define MV_DDR_RESET_PULSE_US		10000
+/* the adll reset pulse keeps its original width too: 100ms, scaled by low freq / freq */
+#define MV_DDR_ADLL_RESET_US(freq, low_freq)	\
+	(100000 / (((freq) > (low_freq)) ? (freq) / (low_freq) : 1))
+/* polling calibration done alone was found insufficient; keep the 10ms guard */
+#define MV_DDR_PAD_CAL_SETTLE_US	10000
+#define MV_DDR_WAIT_TIMEOUT_US		100000
+
+struct mv_ddr_wait_stats {
+	u32 cnt;	/* waits completed */
+	u32 timeouts;	/* waits timed out */
+	u32 total_us;	/* accumulated elapsed time */
+	u32 max_us;	/* longest elapsed time */
+	u32 min_us;	/* shortest elapsed time */
+};
+
+int mv_ddr_wait_reg(u32 dev_num, enum mv_ddr_wait_id id, enum hws_access_type access_type,
+		    u32 if_id, u32 reg_addr, u32 exp_value, u32 mask, u32 settle_us, u32 timeout_us);
+int mv_ddr_wait_odpg_done(enum mv_ddr_wait_id id, u32 settle_us);
+void mv_ddr_wait_settle(enum mv_ddr_wait_id id, u32 settle_us);
+struct mv_ddr_wait_stats *mv_ddr_wait_stats_get(enum mv_ddr_wait_id id);
+void mv_ddr_wait_stats_print(void);
+
+#endif /* _MV_DDR_WAIT_H */
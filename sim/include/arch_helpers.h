@@ -0,0 +1,21 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_ARCH_HELPERS_H
+#define _MV_DDR_SIM_ARCH_HELPERS_H
+
+#include <stdint.h>
+
+/* generic timer frequency reported to the simulated code */
+#define MV_DDR_SIM_CNTFRQ	25000000
+
+/* generic timer counter, derived from the simulated time base */
+uint64_t read_cntpct_el0(void);
+
+static inline uint64_t read_cntfrq_el0(void)
+{
+	return MV_DDR_SIM_CNTFRQ;
+}
+
+#endif /* _MV_DDR_SIM_ARCH_HELPERS_H */
@@ -0,0 +1,14 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_DELAY_TIMER_H
+#define _MV_DDR_SIM_DELAY_TIMER_H
+
+#include <stdint.h>
+
+/* delays advance the simulated time base; no wall-clock time is spent */
+void mdelay(uint32_t msec);
+void udelay(uint32_t usec);
+
+#endif /* _MV_DDR_SIM_DELAY_TIMER_H */
@@ -0,0 +1,19 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_THERMAL_H
+#define _MV_DDR_SIM_THERMAL_H
+
+struct tsen_config {
+	int tsen_offset;
+	int tsen_gain;
+	int tsen_divisor;
+	int tsen_ready;
+};
+
+struct tsen_config *marvell_thermal_config_get(void);
+int marvell_thermal_init(struct tsen_config *tsen_cfg);
+int marvell_thermal_read(struct tsen_config *tsen_cfg, int *temp);
+
+#endif /* _MV_DDR_SIM_THERMAL_H */
@@ -0,0 +1,22 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_MMIO_H
+#define _MV_DDR_SIM_MMIO_H
+
+#include <stdint.h>
+
+/*
+ * host replacement of atf mmio accessors;
+ * implemented by the simulated register file in sim/mv_ddr_sim.c
+ */
+uint16_t mmio_read_16(uintptr_t addr);
+void mmio_write_16(uintptr_t addr, uint16_t value);
+uint32_t mmio_read_32(uintptr_t addr);
+void mmio_write_32(uintptr_t addr, uint32_t value);
+uint64_t mmio_read_64(uintptr_t addr);
+void mmio_write_64(uintptr_t addr, uint64_t value);
+void mmio_clrsetbits_32(uintptr_t addr, uint32_t clear, uint32_t set);
+
+#endif /* _MV_DDR_SIM_MMIO_H */
@@ -0,0 +1,17 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_UTILS_DEF_H
+#define _MV_DDR_SIM_UTILS_DEF_H
+
+#include <stdint.h>
+
+#define ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+#define BIT(nr)		(1ULL << (nr))
+
+#ifndef __aligned
+#define __aligned(x)	__attribute__((__aligned__(x)))
+#endif
+
+#endif /* _MV_DDR_SIM_UTILS_DEF_H */
@@ -0,0 +1,972 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include "ddr3_init.h"
+#include "mv_ddr_regs.h"
+#include "mv_ddr_sim.h"
+#include <drivers/marvell/thermal.h>
+
+/*
+ * host-side simulated register file
+ *
+ * all atf mmio accessors used by the apn806 platform code land here, so the
+ * dunit callbacks registered in config_func_info (dunit_read/dunit_write and
+ * prda/prfa phy access) run unmodified on a workstation. registers are kept in
+ * a sparse hash; a few of them have side effects that model the hardware state
+ * machines the training flow polls on:
+ * - phy register file, both thru direct (prda) and indirect (prfa) access;
+ * - odpg: a transaction completes immediately and sets odpg done status;
+ *   in tx mode the pattern buffer is written to memory at the buffer offset;
+ *   masked (dm) data written with a tx adll outside the edges is reported as
+ *   a per-byte lock failure when read back by the training engine (bist);
+ * - training ip engine: a trigger completes immediately with pass result and
+ *   locked edges in all result control registers; per-bit edges move with
+ *   the bit's rx and tx pbs delay, so pbs to adll ratio (tap tuning) works;
+ * - sdram commands, self-refresh entry, pads calibration and dll lock;
+ * - xor v2 dma engines: memcpy, memset, memcmp and crc32c descriptors run
+ *   on the simulated memory and complete immediately; data the engines read
+ *   thru faulty byte lanes (see mv_ddr_sim_dma_fault_set()) is corrupted;
+ * - faulty byte lanes (see mv_ddr_sim_lane_fault_set()): the tx window of
+ *   such a subphy moves by SIM_LANE_DRIFT taps, and data the odpg writes
+ *   thru it with a tx adll in the old window only is corrupted.
+ * memory is kept in sparse pages, allocated on the first non-zero write;
+ * unwritten memory reads as zero.
+ */
+
+#define SIM_REGS_HASH_BITS		20
+#define SIM_REGS_HASH_SIZE		(1 << SIM_REGS_HASH_BITS)
+
+#define SIM_DUNIT_BASE			(INTER_REGS_BASE + DUNIT_BASE_ADDR)
+#define SIM_DUNIT_SIZE			0x10000
+
+/* phy register direct access (prda) window in dunit address space */
+#define SIM_PRDA_BIT15			(1 << 15)
+#define SIM_PRDA_REG_NUM_OFFS		2
+#define SIM_PRDA_REG_NUM_MASK		0xff
+#define SIM_PRDA_PUP_NUM_OFFS		10
+#define SIM_PRDA_PUP_NUM_MASK		0x1f
+#define SIM_PRDA_PUP_CTRL_DATA_OFFS	4
+#define SIM_PRDA_PUP_DATA_BCAST		0x1d
+#define SIM_PRDA_PUP_CTRL_BCAST		0x1e
+
+#define SIM_PHY_TYPES			2
+#define SIM_PHY_SUBPHYS			16
+#define SIM_PHY_REGS			256
+
+/* sdram init control: init request bit is self-clearing */
+#define SIM_SDRAM_INIT_REQ_MASK		0x1
+/* dfs: self-refresh entry/exit acknowledge follows request */
+#define SIM_DFS_SR_REQ_OFFS		2
+#define SIM_DFS_SR_ACK_OFFS		3
+#define SIM_PHY_LOCKED			0x3ffffff
+#define SIM_EDGE_SHIFT_MAX		0xc
+#define SIM_SEARCH_H2L			(1 << 8)
+#define SIM_ODPG_BUF_LEN		64
+#define SIM_ADLL_TAP_MASK		0x3f
+#define SIM_LANE_DRIFT			0x14
+#define SIM_LANE_CORRUPT		0xa5
+/* private key space to track subphys written with an out-of-window tx adll */
+#define SIM_ODPG_FAIL_BASE		(1ULL << 40)
+#define SIM_TRAINING_RES(edge)		((1 << PUP_LOCK_RESULT_BIT) | ((edge) << 8) | (edge))
+/* pads calibration machine results: n-cal [15:10], p-cal [9:4] */
+#define SIM_CAL_N_OFFS			10
+#define SIM_CAL_P_OFFS			4
+#define SIM_CAL_MASK			0x3f
+#define SIM_CAL_SSTL_N			10
+#define SIM_CAL_SSTL_P			12
+#define SIM_CAL_POD_N			12
+#define SIM_CAL_POD_P			8
+
+/* sparse simulated memory: dram below the internal registers and above 4gb */
+#define SIM_MEM_HIGH_BASE		(1ULL << 32)
+#define SIM_MEM_PAGE_BITS		16
+#define SIM_MEM_PAGE_SIZE		(1 << SIM_MEM_PAGE_BITS)
+#define SIM_MEM_HASH_BITS		12
+#define SIM_MEM_HASH_SIZE		(1 << SIM_MEM_HASH_BITS)	/* up to 256mb resident */
+
+/* xor v2 dma engine registers */
+#define SIM_XOR_BASE			(INTER_REGS_BASE + 0x00400000)
+#define SIM_XOR_ENGINE_SIZE		0x20000
+#define SIM_XOR_ENGINE_NUM		4
+#define SIM_XOR_DESQ_BALR_OFF		0x000
+#define SIM_XOR_DESQ_BAHR_OFF		0x004
+#define SIM_XOR_DESQ_SIZE_OFF		0x008
+#define SIM_XOR_DESQ_DONE_OFF		0x00c
+#define SIM_XOR_DESQ_STOP_OFF		0x800
+#define SIM_XOR_DESQ_DEALLOC_OFF	0x804
+#define SIM_XOR_DESQ_ADD_OFF		0x808
+#define SIM_XOR_QUEUE_RESET		0x2
+#define SIM_XOR_CMP_STATUS_OK		(1 << 9)
+#define SIM_XOR_OP_MODE_OFFS		28
+#define SIM_XOR_OP_MODE_MASK		0xf
+#define SIM_XOR_OP_MEMCPY		1
+#define SIM_XOR_OP_MEMSET		2
+#define SIM_XOR_OP_MEMCMP		4
+#define SIM_XOR_OP_CRC32C		5
+#define SIM_XOR_CHUNK_SIZE		0x1000
+#define SIM_CRC32C_POLY			0x82f63b78
+
+struct sim_reg {
+	uint64_t addr;
+	u32 val;
+	u32 used;
+};
+
+/* layout of xor v2 32-byte hardware descriptor */
+struct sim_xor_desc {
+	u16 desc_id;
+	u16 flags;
+	u32 crc32_result;
+	u32 desc_ctrl;
+	u32 buff_size;
+	u32 src_lo;
+	u32 src_hi;
+	u32 dst_lo;
+	u32 dst_hi;
+};
+
+struct sim_xor_engine {
+	u32 done;	/* completed descriptors, not yet released */
+	u32 next;	/* next descriptor to process */
+};
+
+struct sim_mem_page {
+	uint64_t pfn;	/* page frame number */
+	u8 *data;	/* NULL - unused hash entry */
+};
+
+static struct sim_reg *sim_regs;
+static u16 sim_phy[SIM_PHY_TYPES][SIM_PHY_SUBPHYS][SIM_PHY_REGS];
+static struct sim_xor_engine sim_xor[SIM_XOR_ENGINE_NUM];
+static struct sim_mem_page *sim_mem;
+static u32 sim_mem_pages;
+static u32 sim_crc32c_table[256];
+static u32 sim_dma_fault;	/* byte lanes corrupted on dma engine reads */
+static u32 sim_dma_fault_descs;	/* descriptors left to corrupt; 0 - all */
+static u32 sim_odpg_buf[SIM_ODPG_BUF_LEN][2];	/* low, high data words */
+static u32 sim_odpg_len;
+static u32 sim_odpg_dm;		/* data mask bits used by the loaded pattern */
+static u32 sim_lane_fault;	/* subphys with a drifted tx window */
+static struct mv_ddr_sim_stats sim_stats;
+static struct tsen_config sim_tsen = { 0, 1, 1, 1 };
+
+static struct sim_reg *sim_reg_lookup(uint64_t addr, int create)
+{
+	u32 idx = (u32)((addr >> 2) ^ (addr >> (SIM_REGS_HASH_BITS + 2))) &
+		  (SIM_REGS_HASH_SIZE - 1);
+	u32 probe;
+
+	for (probe = 0; probe < SIM_REGS_HASH_SIZE; probe++) {
+		struct sim_reg *reg = &sim_regs[idx];
+
+		if (!reg->used) {
+			if (!create)
+				return NULL;
+			reg->used = 1;
+			reg->addr = addr;
+			reg->val = 0;
+			return reg;
+		}
+		if (reg->addr == addr)
+			return reg;
+		idx = (idx + 1) & (SIM_REGS_HASH_SIZE - 1);
+	}
+
+	printf("mv_ddr: sim: register file full\n");
+	exit(1);
+}
+
+static u32 sim_reg_get(uint64_t addr)
+{
+	struct sim_reg *reg = sim_reg_lookup(addr, 0);
+
+	return (reg != NULL) ? reg->val : 0;
+}
+
+static void sim_reg_set(uint64_t addr, u32 val)
+{
+	sim_reg_lookup(addr, 1)->val = val;
+}
+
+static int sim_mem_is(uint64_t addr)
+{
+	return addr < INTER_REGS_BASE || (addr >= SIM_MEM_HIGH_BASE && addr < SIM_ODPG_FAIL_BASE);
+}
+
+/* page holding addr; with create, allocated zeroed if missing */
+static u8 *sim_mem_page_get(uint64_t addr, int create)
+{
+	uint64_t pfn = addr >> SIM_MEM_PAGE_BITS;
+	u32 idx = (u32)(pfn ^ (pfn >> SIM_MEM_HASH_BITS)) & (SIM_MEM_HASH_SIZE - 1);
+	u32 probe;
+
+	for (probe = 0; probe < SIM_MEM_HASH_SIZE; probe++) {
+		struct sim_mem_page *page = &sim_mem[idx];
+
+		if (page->data == NULL) {
+			if (!create)
+				return NULL;
+			page->data = calloc(1, SIM_MEM_PAGE_SIZE);
+			if (page->data == NULL)
+				break;
+			page->pfn = pfn;
+			sim_mem_pages++;
+			return page->data;
+		}
+		if (page->pfn == pfn)
+			return page->data;
+		idx = (idx + 1) & (SIM_MEM_HASH_SIZE - 1);
+	}
+
+	printf("mv_ddr: sim: memory full\n");
+	exit(1);
+}
+
+static void sim_mem_free(void)
+{
+	u32 i;
+
+	for (i = 0; i < SIM_MEM_HASH_SIZE; i++)
+		free(sim_mem[i].data);
+	memset(sim_mem, 0, SIM_MEM_HASH_SIZE * sizeof(*sim_mem));
+	sim_mem_pages = 0;
+}
+
+/* bytes from addr up to the end of its page, at most len */
+static uint64_t sim_mem_span(uint64_t addr, uint64_t len)
+{
+	uint64_t left = SIM_MEM_PAGE_SIZE - (addr & (SIM_MEM_PAGE_SIZE - 1));
+
+	return (len < left) ? len : left;
+}
+
+static void sim_mem_read(uint64_t addr, u8 *buf, uint64_t len)
+{
+	uint64_t span;
+	u8 *page;
+
+	for (; len != 0; addr += span, buf += span, len -= span) {
+		span = sim_mem_span(addr, len);
+		page = sim_mem_page_get(addr, 0);
+		if (page != NULL)
+			memcpy(buf, page + (addr & (SIM_MEM_PAGE_SIZE - 1)), span);
+		else
+			memset(buf, 0, span);
+	}
+}
+
+static void sim_mem_write(uint64_t addr, const u8 *buf, uint64_t len)
+{
+	uint64_t span, i;
+	u8 *page;
+
+	for (; len != 0; addr += span, buf += span, len -= span) {
+		span = sim_mem_span(addr, len);
+		page = sim_mem_page_get(addr, 0);
+		if (page == NULL) {
+			/* zeros need no page */
+			for (i = 0; i < span && buf[i] == 0; i++)
+				;
+			if (i == span)
+				continue;
+			page = sim_mem_page_get(addr, 1);
+		}
+		memcpy(page + (addr & (SIM_MEM_PAGE_SIZE - 1)), buf, span);
+	}
+}
+
+static u32 sim_mem_read32(uint64_t addr)
+{
+	u32 val;
+
+	sim_mem_read(addr, (u8 *)&val, sizeof(val));
+
+	return val;
+}
+
+static void sim_mem_write32(uint64_t addr, u32 val)
+{
+	sim_mem_write(addr, (const u8 *)&val, sizeof(val));
+}
+
+/* fill with a 64-bit pattern aligned to 8-byte words; zero fill only clears allocated pages */
+static void sim_mem_fill(uint64_t addr, uint64_t len, uint64_t pattern)
+{
+	uint64_t end = addr + len, start, stop;
+	u8 buf[SIM_XOR_CHUNK_SIZE];
+	u32 i;
+
+	if (pattern == 0) {
+		for (i = 0; i < SIM_MEM_HASH_SIZE; i++) {
+			if (sim_mem[i].data == NULL)
+				continue;
+			start = sim_mem[i].pfn << SIM_MEM_PAGE_BITS;
+			stop = start + SIM_MEM_PAGE_SIZE;
+			start = (start > addr) ? start : addr;
+			stop = (stop < end) ? stop : end;
+			if (start < stop)
+				memset(sim_mem[i].data + (start & (SIM_MEM_PAGE_SIZE - 1)), 0,
+				       stop - start);
+		}
+		return;
+	}
+
+	for (; addr < end; addr += len) {
+		len = ((end - addr) < sizeof(buf)) ? (end - addr) : sizeof(buf);
+		for (i = 0; i < len; i++)
+			buf[i] = (u8)(pattern >> (((addr + i) % sizeof(pattern)) * 8));
+		sim_mem_write(addr, buf, len);
+	}
+}
+
+static u32 sim_phy_read(enum hws_ddr_phy phy_type, u32 subphy, u32 addr)
+{
+	sim_stats.phy_rd++;
+
+	return sim_phy[phy_type & 0x1][subphy & (SIM_PHY_SUBPHYS - 1)][addr & (SIM_PHY_REGS - 1)];
+}
+
+/* store a phy register; pbs broadcast registers update all dq pads of a cs */
+static void sim_phy_set(enum hws_ddr_phy phy_type, u32 subphy, u32 addr, u32 data)
+{
+	u16 *regs = sim_phy[phy_type & 0x1][subphy & (SIM_PHY_SUBPHYS - 1)];
+	u32 cs, bit;
+
+	addr &= SIM_PHY_REGS - 1;
+	regs[addr] = data;
+
+	if (phy_type != DDR_PHY_DATA)
+		return;
+
+	for (cs = 0; cs < MAX_CS_NUM; cs++) {
+		for (bit = 0; bit < BUS_WIDTH_IN_BITS; bit++) {
+			if (addr == PBS_RX_BCAST_PHY_REG(cs))
+				regs[PBS_RX_PHY_REG(cs, bit)] = data;
+			else if (addr == PBS_TX_BCAST_PHY_REG(cs))
+				regs[PBS_TX_PHY_REG(cs, bit)] = data;
+		}
+	}
+}
+
+static void sim_phy_write(enum hws_ddr_phy phy_type, int bcast, u32 subphy,
+			  u32 addr, u32 data)
+{
+	u32 i;
+
+	sim_stats.phy_wr++;
+
+	if (bcast) {
+		for (i = 0; i < SIM_PHY_SUBPHYS; i++)
+			sim_phy_set(phy_type, i, addr, data);
+	} else {
+		sim_phy_set(phy_type, subphy, addr, data);
+	}
+}
+
+/* decode a prda window offset to phy type, broadcast and subphy number */
+static void sim_prda_decode(u32 offs, enum hws_ddr_phy *phy_type, int *bcast,
+			    u32 *subphy, u32 *addr)
+{
+	u32 pup = (offs >> SIM_PRDA_PUP_NUM_OFFS) & SIM_PRDA_PUP_NUM_MASK;
+
+	*addr = (offs >> SIM_PRDA_REG_NUM_OFFS) & SIM_PRDA_REG_NUM_MASK;
+	*bcast = 0;
+	*subphy = pup & 0xf;
+	*phy_type = (pup >> SIM_PRDA_PUP_CTRL_DATA_OFFS) ? DDR_PHY_CONTROL : DDR_PHY_DATA;
+
+	if (pup == SIM_PRDA_PUP_DATA_BCAST) {
+		*bcast = 1;
+		*phy_type = DDR_PHY_DATA;
+	} else if (pup == SIM_PRDA_PUP_CTRL_BCAST) {
+		*bcast = 1;
+		*phy_type = DDR_PHY_CONTROL;
+	}
+}
+
+/* execute a phy register file indirect access (prfa) request */
+static u32 sim_prfa_exec(u32 val)
+{
+	enum hws_ddr_phy phy_type = (val >> PRFA_PUP_CTRL_DATA_OFFS) & PRFA_PUP_CTRL_DATA_MASK;
+	u32 bcast = (val >> PRFA_PUP_BCAST_WR_ENA_OFFS) & PRFA_PUP_BCAST_WR_ENA_MASK;
+	u32 subphy = (val >> PRFA_PUP_NUM_OFFS) & PRFA_PUP_NUM_MASK;
+	u32 addr = ((val >> PRFA_REG_NUM_OFFS) & PRFA_REG_NUM_MASK) |
+		   (((val >> PRFA_REG_NUM_HI_OFFS) & PRFA_REG_NUM_HI_MASK) << 6);
+	u32 data = (val >> PRFA_DATA_OFFS) & PRFA_DATA_MASK;
+
+	if (((val >> PRFA_TYPE_OFFS) & PRFA_TYPE_MASK) == OPERATION_WRITE) {
+		sim_phy_write(phy_type, bcast, subphy, addr, data);
+	} else {
+		val &= ~(PRFA_DATA_MASK << PRFA_DATA_OFFS);
+		val |= sim_phy_read(phy_type, subphy, addr) << PRFA_DATA_OFFS;
+	}
+
+	/* request completed */
+	return val & ~(PRFA_REQ_MASK << PRFA_REQ_OFFS);
+}
+
+/*
+ * training ip engine run: report locked edges for every subphy and bit;
+ * a low to high search finds the window start, a high to low one its end
+ */
+static void sim_training_results_set(void)
+{
+	u16 *pup_map = ddr3_tip_get_mask_results_pup_reg_map();
+	u16 *dq_map = ddr3_tip_get_mask_results_dq_reg();
+	u32 opcode = sim_reg_get(SIM_DUNIT_BASE + OPCODE_REG0_REG(1));
+	u32 edge = (opcode & SIM_SEARCH_H2L) ? MV_DDR_SIM_EDGE_2 : MV_DDR_SIM_EDGE_1;
+	u32 ctrl = sim_reg_get(SIM_DUNIT_BASE + ODPG_DATA_CTRL_REG);
+	u32 fail = 0;
+	u32 i, subphy, bit, shift;
+
+	/* read back data corrupted by an earlier odpg write */
+	if (((ctrl >> ODPG_MODE_OFFS) & ODPG_MODE_MASK) == ODPG_MODE_RX)
+		fail = sim_reg_get(SIM_ODPG_FAIL_BASE +
+				   sim_reg_get(SIM_DUNIT_BASE + ODPG_DATA_BUFFER_OFFS_REG));
+
+	for (i = 0; pup_map[i] != 0xffff; i++)
+		sim_reg_set(SIM_DUNIT_BASE + pup_map[i],
+			    (fail & (1 << i)) ? 0 : SIM_TRAINING_RES(edge));
+	for (i = 0; dq_map[i] != 0xffff; i++) {
+		subphy = i / BUS_WIDTH_IN_BITS;
+		bit = i % BUS_WIDTH_IN_BITS;
+		/* one adll tap per two pbs taps */
+		shift = (sim_phy[DDR_PHY_DATA][subphy][PBS_RX_PHY_REG(0, bit)] +
+			 sim_phy[DDR_PHY_DATA][subphy][PBS_TX_PHY_REG(0, bit)]) / 2;
+		if (shift > SIM_EDGE_SHIFT_MAX)
+			shift = SIM_EDGE_SHIFT_MAX;
+		if (sim_lane_fault & (1 << subphy))
+			shift += SIM_LANE_DRIFT;
+		sim_reg_set(SIM_DUNIT_BASE + dq_map[i], SIM_TRAINING_RES(edge + shift));
+	}
+}
+
+/* report in-range pads calibration values unless set by software */
+static u32 sim_cal_mach_read(u32 offs, u32 cal_n, u32 cal_p)
+{
+	u32 val = sim_reg_get(SIM_DUNIT_BASE + offs);
+
+	if (((val >> SIM_CAL_N_OFFS) & SIM_CAL_MASK) == 0)
+		val |= cal_n << SIM_CAL_N_OFFS;
+	if (((val >> SIM_CAL_P_OFFS) & SIM_CAL_MASK) == 0)
+		val |= cal_p << SIM_CAL_P_OFFS;
+
+	return val | (CAL_MACH_RDY << CAL_MACH_STATUS_OFFS);
+}
+
+/* subphys whose tx adll is outside the simulated valid window */
+static u32 sim_tx_fail_mask_get(void)
+{
+	u32 subphy, tap, drift, mask = 0;
+
+	for (subphy = 0; subphy < SIM_PHY_SUBPHYS; subphy++) {
+		tap = sim_phy[DDR_PHY_DATA][subphy][CTX_PHY_REG(0)] & SIM_ADLL_TAP_MASK;
+		drift = (sim_lane_fault & (1 << subphy)) ? SIM_LANE_DRIFT : 0;
+		if (tap < MV_DDR_SIM_EDGE_1 + drift || tap > MV_DDR_SIM_EDGE_2 + drift)
+			mask |= 1 << subphy;
+	}
+
+	return mask;
+}
+
+/* faulty subphys still set to a tx adll that was valid before the drift */
+static u32 sim_lane_stale_mask_get(void)
+{
+	u32 subphy, tap, mask = 0;
+
+	for (subphy = 0; subphy < SIM_PHY_SUBPHYS; subphy++) {
+		if (!(sim_lane_fault & (1 << subphy)))
+			continue;
+		tap = sim_phy[DDR_PHY_DATA][subphy][CTX_PHY_REG(0)] & SIM_ADLL_TAP_MASK;
+		if (tap >= MV_DDR_SIM_EDGE_1 && tap < MV_DDR_SIM_EDGE_1 + SIM_LANE_DRIFT)
+			mask |= 1 << subphy;
+	}
+
+	return mask;
+}
+
+/* corrupt the bytes of a 32-bit bus data word carried by stale subphys */
+static u32 sim_lane_corrupt(u32 data, u32 stale)
+{
+	u32 subphy;
+
+	for (subphy = 0; subphy < sizeof(u32); subphy++) {
+		if (stale & (1 << subphy))
+			data ^= SIM_LANE_CORRUPT << (subphy * 8);
+	}
+
+	return data;
+}
+
+/* odpg tx: write the loaded pattern to memory; the odpg scales the offset by 8 */
+static void sim_odpg_store(void)
+{
+	u32 offs = sim_reg_get(SIM_DUNIT_BASE + ODPG_DATA_BUFFER_OFFS_REG);
+	uint64_t addr = (uint64_t)offs << 3;
+	u32 stale = sim_lane_stale_mask_get();
+	u32 i;
+
+	for (i = 0; i < sim_odpg_len; i++, addr += 2 * sizeof(u32)) {
+		sim_mem_write32(addr, sim_lane_corrupt(sim_odpg_buf[i][0], stale));
+		sim_mem_write32(addr + sizeof(u32), sim_lane_corrupt(sim_odpg_buf[i][1], stale));
+	}
+
+	/* only masked writes depend on the dm being sampled in the window */
+	sim_reg_set(SIM_ODPG_FAIL_BASE + offs, sim_odpg_dm ? sim_tx_fail_mask_get() : 0);
+}
+
+static u32 sim_dunit_read(u32 offs)
+{
+	enum hws_ddr_phy phy_type;
+	u32 subphy, addr;
+	int bcast;
+
+	sim_stats.dunit_rd++;
+	sim_stats.time_ns += MV_DDR_SIM_DUNIT_ACCESS_NS;
+
+	if (offs & SIM_PRDA_BIT15) {
+		sim_prda_decode(offs, &phy_type, &bcast, &subphy, &addr);
+		return sim_phy_read(phy_type, subphy, addr);
+	}
+
+	switch (offs) {
+	case PHY_LOCK_STATUS_REG:
+		return SIM_PHY_LOCKED;
+	case MAIN_PADS_CAL_MACH_CTRL_REG:
+	case HORZ_SSTL_CAL_MACH_CTRL_REG:
+	case VERT_SSTL_CAL_MACH_CTRL_REG:
+		return sim_cal_mach_read(offs, SIM_CAL_SSTL_N, SIM_CAL_SSTL_P);
+	case HORZ_POD_CAL_MACH_CTRL_REG:
+	case VERT_POD_CAL_MACH_CTRL_REG:
+		return sim_cal_mach_read(offs, SIM_CAL_POD_N, SIM_CAL_POD_P);
+	default:
+		return sim_reg_get(SIM_DUNIT_BASE + offs);
+	}
+}
+
+static void sim_dunit_write(u32 offs, u32 val)
+{
+	enum hws_ddr_phy phy_type;
+	u32 subphy, addr, idx;
+	int bcast;
+
+	sim_stats.dunit_wr++;
+	sim_stats.time_ns += MV_DDR_SIM_DUNIT_ACCESS_NS;
+
+	if (offs & SIM_PRDA_BIT15) {
+		sim_prda_decode(offs, &phy_type, &bcast, &subphy, &addr);
+		sim_phy_write(phy_type, bcast, subphy, addr, val & 0xffff);
+		return;
+	}
+
+	switch (offs) {
+	case PHY_REG_FILE_ACCESS_REG:
+		if ((val >> PRFA_REQ_OFFS) & PRFA_REQ_MASK)
+			val = sim_prfa_exec(val);
+		break;
+	case GLOB_CTRL_STATUS_REG:
+		if ((val >> TRAINING_TRIGGER_OFFS) & TRAINING_TRIGGER_MASK) {
+			sim_stats.training_runs++;
+			sim_training_results_set();
+			val &= ~(TRAINING_TRIGGER_MASK << TRAINING_TRIGGER_OFFS);
+			val &= ~(TRAINING_RESULT_MASK << TRAINING_RESULT_OFFS);
+			val |= (TRAINING_DONE_DONE << TRAINING_DONE_OFFS) |
+			       (TRAINING_RESULT_PASS << TRAINING_RESULT_OFFS);
+		}
+		break;
+	case ODPG_DATA_WR_ADDR_REG:
+		idx = (val >> ODPG_DATA_WR_ACK_OFFS) & ODPG_DATA_WR_ACK_MASK;
+		if (idx < SIM_ODPG_BUF_LEN) {
+			/* a new pattern load starts at index 0 */
+			if (idx == 0)
+				sim_odpg_dm = 0;
+			sim_odpg_buf[idx][0] = sim_reg_get(SIM_DUNIT_BASE + ODPG_DATA_WR_DATA_LOW_REG);
+			sim_odpg_buf[idx][1] = sim_reg_get(SIM_DUNIT_BASE + ODPG_DATA_WR_DATA_HIGH_REG);
+			sim_odpg_dm |= (val >> ODPG_DATA_WR_DATA_OFFS) & ODPG_DATA_WR_DATA_MASK;
+			sim_odpg_len = idx + 1;
+		}
+		break;
+	case ODPG_DATA_CTRL_REG:
+		if ((val >> ODPG_ENABLE_OFFS) & ODPG_ENABLE_MASK) {
+			sim_stats.odpg_runs++;
+			if (((val >> ODPG_MODE_OFFS) & ODPG_MODE_MASK) == ODPG_MODE_TX)
+				sim_odpg_store();
+			sim_reg_set(SIM_DUNIT_BASE + ODPG_DONE_STATUS_REG,
+				    ODPG_DONE_STATUS_BIT_SET << ODPG_DONE_STATUS_BIT_OFFS);
+			val &= ~(ODPG_ENABLE_MASK << ODPG_ENABLE_OFFS);
+		}
+		break;
+	case SDRAM_OP_REG:
+		val &= ~(SDRAM_OP_CMD_MASK << SDRAM_OP_CMD_OFFS);
+		break;
+	case SDRAM_INIT_CTRL_REG:
+		val &= ~SIM_SDRAM_INIT_REQ_MASK;
+		break;
+	case DFS_REG:
+		val &= ~(1 << SIM_DFS_SR_ACK_OFFS);
+		val |= ((val >> SIM_DFS_SR_REQ_OFFS) & 0x1) << SIM_DFS_SR_ACK_OFFS;
+		break;
+	default:
+		break;
+	}
+
+	sim_reg_set(SIM_DUNIT_BASE + offs, val);
+}
+
+static struct sim_xor_desc *sim_xor_qmem_get(u32 xor_id)
+{
+	uint64_t base = SIM_XOR_BASE + xor_id * SIM_XOR_ENGINE_SIZE;
+	uint64_t qmem = ((uint64_t)sim_reg_get(base + SIM_XOR_DESQ_BAHR_OFF) << 32) |
+			sim_reg_get(base + SIM_XOR_DESQ_BALR_OFF);
+
+	return (struct sim_xor_desc *)(uintptr_t)qmem;
+}
+
+static void sim_crc32c_init(void)
+{
+	u32 i, bit, crc;
+
+	for (i = 0; i < 256; i++) {
+		crc = i;
+		for (bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (SIM_CRC32C_POLY & (0 - (crc & 0x1)));
+		sim_crc32c_table[i] = crc;
+	}
+}
+
+/* raw crc32c update, without the initial and final inversion */
+static u32 sim_crc32c(u32 crc, const u8 *buf, uint64_t len)
+{
+	while (len--)
+		crc = (crc >> 8) ^ sim_crc32c_table[(crc ^ *buf++) & 0xff];
+
+	return crc;
+}
+
+/* memory read by a dma engine; bytes carried by faulty lanes are corrupted */
+static void sim_xor_mem_read(uint64_t addr, u8 *buf, uint64_t len, u32 fault)
+{
+	u32 bus_bytes = mv_ddr_if_bus_width_get() / 8;
+	uint64_t i;
+
+	sim_mem_read(addr, buf, len);
+	if (fault == 0 || bus_bytes == 0)
+		return;
+
+	/* byte n of a bus width word is on byte lane n */
+	for (i = 0; i < len; i++)
+		if (fault & (1 << ((addr + i) % bus_bytes)))
+			buf[i] ^= SIM_LANE_CORRUPT;
+}
+
+/* run a descriptor on the simulated memory */
+static void sim_xor_exec(struct sim_xor_desc *desc)
+{
+	u32 op = (desc->desc_ctrl >> SIM_XOR_OP_MODE_OFFS) & SIM_XOR_OP_MODE_MASK;
+	uint64_t src = ((uint64_t)desc->src_hi << 32) | desc->src_lo;
+	uint64_t dst = ((uint64_t)desc->dst_hi << 32) | desc->dst_lo;
+	uint64_t offs, len;
+	u8 buf[SIM_XOR_CHUNK_SIZE], ref[SIM_XOR_CHUNK_SIZE];
+	u32 fault = sim_dma_fault, crc = 0xffffffff;
+	int equal = 1;
+
+	if (fault != 0 && sim_dma_fault_descs != 0 && --sim_dma_fault_descs == 0)
+		sim_dma_fault = 0;
+
+	switch (op) {
+	case SIM_XOR_OP_MEMSET:
+		/* the fill pattern is held by the source address fields */
+		sim_mem_fill(dst, desc->buff_size, src);
+		return;
+	case SIM_XOR_OP_MEMCPY:
+	case SIM_XOR_OP_MEMCMP:
+	case SIM_XOR_OP_CRC32C:
+		break;
+	default:
+		return;
+	}
+
+	for (offs = 0; offs < desc->buff_size; offs += len) {
+		len = desc->buff_size - offs;
+		len = (len < sizeof(buf)) ? len : sizeof(buf);
+		sim_xor_mem_read(src + offs, buf, len, fault);
+		if (op == SIM_XOR_OP_MEMCPY) {
+			sim_mem_write(dst + offs, buf, len);
+		} else if (op == SIM_XOR_OP_MEMCMP) {
+			sim_xor_mem_read(dst + offs, ref, len, fault);
+			if (memcmp(buf, ref, len)) {
+				equal = 0;
+				break;
+			}
+		} else {
+			crc = sim_crc32c(crc, buf, len);
+		}
+	}
+
+	if (op == SIM_XOR_OP_MEMCMP && equal)
+		desc->flags |= SIM_XOR_CMP_STATUS_OK;
+	else if (op == SIM_XOR_OP_MEMCMP)
+		sim_stats.dma_miscompares++;
+	else if (op == SIM_XOR_OP_CRC32C)
+		desc->crc32_result = ~crc;
+}
+
+/* process newly added dma descriptors; every operation completes at once */
+static void sim_xor_add(u32 xor_id, u32 desc_num)
+{
+	struct sim_xor_engine *eng = &sim_xor[xor_id];
+	struct sim_xor_desc *qmem = sim_xor_qmem_get(xor_id);
+	u32 qsize = sim_reg_get(SIM_XOR_BASE + xor_id * SIM_XOR_ENGINE_SIZE +
+				SIM_XOR_DESQ_SIZE_OFF);
+
+	while (desc_num--) {
+		if (qmem != NULL && qsize != 0) {
+			sim_xor_exec(&qmem[eng->next]);
+			eng->next = (eng->next + 1) % qsize;
+		}
+		eng->done++;
+		sim_stats.dma_descs++;
+	}
+}
+
+static int sim_xor_read(uint64_t addr, u32 *val)
+{
+	uint64_t offs = addr - SIM_XOR_BASE;
+	u32 xor_id = offs / SIM_XOR_ENGINE_SIZE;
+
+	if (addr < SIM_XOR_BASE || xor_id >= SIM_XOR_ENGINE_NUM)
+		return 0;
+
+	if ((offs % SIM_XOR_ENGINE_SIZE) != SIM_XOR_DESQ_DONE_OFF)
+		return 0;
+
+	*val = sim_xor[xor_id].done;
+
+	return 1;
+}
+
+static int sim_xor_write(uint64_t addr, u32 val)
+{
+	uint64_t offs = addr - SIM_XOR_BASE;
+	u32 xor_id = offs / SIM_XOR_ENGINE_SIZE;
+
+	if (addr < SIM_XOR_BASE || xor_id >= SIM_XOR_ENGINE_NUM)
+		return 0;
+
+	switch (offs % SIM_XOR_ENGINE_SIZE) {
+	case SIM_XOR_DESQ_ADD_OFF:
+		sim_xor_add(xor_id, val);
+		return 1;
+	case SIM_XOR_DESQ_DEALLOC_OFF:
+		sim_xor[xor_id].done -= (val < sim_xor[xor_id].done) ? val : sim_xor[xor_id].done;
+		return 1;
+	case SIM_XOR_DESQ_STOP_OFF:
+		if (val & SIM_XOR_QUEUE_RESET) {
+			sim_xor[xor_id].done = 0;
+			sim_xor[xor_id].next = 0;
+		}
+		return 0;
+	default:
+		return 0;
+	}
+}
+
+uint32_t mmio_read_32(uintptr_t addr)
+{
+	u32 val;
+
+	sim_stats.mmio_rd++;
+
+	if (addr >= SIM_DUNIT_BASE && addr < SIM_DUNIT_BASE + SIM_DUNIT_SIZE)
+		return sim_dunit_read(addr - SIM_DUNIT_BASE);
+
+	sim_stats.time_ns += MV_DDR_SIM_MMIO_ACCESS_NS;
+
+	if (sim_mem_is(addr))
+		return sim_mem_read32(addr);
+
+	if (sim_xor_read(addr, &val))
+		return val;
+
+	return sim_reg_get(addr);
+}
+
+void mmio_write_32(uintptr_t addr, uint32_t value)
+{
+	sim_stats.mmio_wr++;
+
+	if (addr >= SIM_DUNIT_BASE && addr < SIM_DUNIT_BASE + SIM_DUNIT_SIZE) {
+		sim_dunit_write(addr - SIM_DUNIT_BASE, value);
+		return;
+	}
+
+	sim_stats.time_ns += MV_DDR_SIM_MMIO_ACCESS_NS;
+
+	if (sim_mem_is(addr)) {
+		sim_mem_write32(addr, value);
+		return;
+	}
+
+	if (sim_xor_write(addr, value))
+		return;
+
+	sim_reg_set(addr, value);
+}
+
+uint16_t mmio_read_16(uintptr_t addr)
+{
+	return (mmio_read_32(addr & ~0x3) >> ((addr & 0x2) * 8)) & 0xffff;
+}
+
+void mmio_write_16(uintptr_t addr, uint16_t value)
+{
+	u32 shift = (addr & 0x2) * 8;
+
+	mmio_clrsetbits_32(addr & ~0x3, 0xffff << shift, (u32)value << shift);
+}
+
+uint64_t mmio_read_64(uintptr_t addr)
+{
+	return mmio_read_32(addr) | ((uint64_t)mmio_read_32(addr + 4) << 32);
+}
+
+void mmio_write_64(uintptr_t addr, uint64_t value)
+{
+	mmio_write_32(addr, (u32)value);
+	mmio_write_32(addr + 4, (u32)(value >> 32));
+}
+
+void mmio_clrsetbits_32(uintptr_t addr, uint32_t clear, uint32_t set)
+{
+	mmio_write_32(addr, (mmio_read_32(addr) & ~clear) | set);
+}
+
+void mdelay(uint32_t msec)
+{
+	sim_stats.delay_ns += (uint64_t)msec * 1000000;
+	sim_stats.time_ns += (uint64_t)msec * 1000000;
+}
+
+void udelay(uint32_t usec)
+{
+	sim_stats.delay_ns += (uint64_t)usec * 1000;
+	sim_stats.time_ns += (uint64_t)usec * 1000;
+}
+
+uint64_t read_cntpct_el0(void)
+{
+	return sim_stats.time_ns / (1000000000 / MV_DDR_SIM_CNTFRQ);
+}
+
+struct tsen_config *marvell_thermal_config_get(void)
+{
+	return &sim_tsen;
+}
+
+int marvell_thermal_init(struct tsen_config *tsen_cfg)
+{
+	return 0;
+}
+
+int marvell_thermal_read(struct tsen_config *tsen_cfg, int *temp)
+{
+	*temp = 45;
+
+	return 0;
+}
+
+u16 mv_ddr_sim_phy_peek(enum hws_ddr_phy phy_type, u32 subphy, u32 addr)
+{
+	return sim_phy[phy_type & 0x1][subphy & (SIM_PHY_SUBPHYS - 1)][addr & (SIM_PHY_REGS - 1)];
+}
+
+int mv_ddr_sim_init(u32 sar, u32 dev_id)
+{
+	if (sim_regs == NULL) {
+		sim_regs = calloc(SIM_REGS_HASH_SIZE, sizeof(*sim_regs));
+		if (sim_regs == NULL) {
+			printf("mv_ddr: sim: out of memory\n");
+			return -1;
+		}
+	} else {
+		memset(sim_regs, 0, SIM_REGS_HASH_SIZE * sizeof(*sim_regs));
+	}
+
+	/* memory contents do not survive a reset */
+	if (sim_mem == NULL) {
+		sim_mem = calloc(SIM_MEM_HASH_SIZE, sizeof(*sim_mem));
+		if (sim_mem == NULL) {
+			printf("mv_ddr: sim: out of memory\n");
+			return -1;
+		}
+	} else {
+		sim_mem_free();
+	}
+	sim_crc32c_init();
+
+	memset(sim_phy, 0, sizeof(sim_phy));
+	memset(sim_xor, 0, sizeof(sim_xor));
+	memset(sim_odpg_buf, 0, sizeof(sim_odpg_buf));
+	sim_odpg_len = 0;
+	sim_odpg_dm = 0;
+	sim_lane_fault = 0;
+	sim_dma_fault = 0;
+	sim_dma_fault_descs = 0;
+	memset(&sim_stats, 0, sizeof(sim_stats));
+
+	/* reset values the platform code depends on */
+	sim_reg_set(INTER_REGS_BASE + SAR_REG_ADDR, sar << RST2_CLOCK_FREQ_MODE_OFFS);
+	sim_reg_set(INTER_REGS_BASE + CP_DEV_ID_STATUS_REG, dev_id << SW_REV_STATUS_OFFSET);
+
+	return 0;
+}
+
+void mv_ddr_sim_lane_fault_set(u32 subphy_mask)
+{
+	sim_lane_fault = subphy_mask;
+}
+
+void mv_ddr_sim_dma_fault_set(u32 lane_mask, u32 desc_num)
+{
+	sim_dma_fault = lane_mask;
+	sim_dma_fault_descs = desc_num;
+}
+
+void mv_ddr_sim_release(void)
+{
+	free(sim_regs);
+	sim_regs = NULL;
+	if (sim_mem != NULL) {
+		sim_mem_free();
+		free(sim_mem);
+		sim_mem = NULL;
+	}
+}
+
+struct mv_ddr_sim_stats *mv_ddr_sim_stats_get(void)
+{
+	return &sim_stats;
+}
+
+void mv_ddr_sim_stats_print(void)
+{
+	printf("mv_ddr: sim: mmio reads %llu, writes %llu\n",
+	       (unsigned long long)sim_stats.mmio_rd,
+	       (unsigned long long)sim_stats.mmio_wr);
+	printf("mv_ddr: sim: dunit reads %llu, writes %llu\n",
+	       (unsigned long long)sim_stats.dunit_rd,
+	       (unsigned long long)sim_stats.dunit_wr);
+	printf("mv_ddr: sim: phy reads %llu, writes %llu\n",
+	       (unsigned long long)sim_stats.phy_rd,
+	       (unsigned long long)sim_stats.phy_wr);
+	printf("mv_ddr: sim: odpg runs %llu, training runs %llu, dma descriptors %llu\n",
+	       (unsigned long long)sim_stats.odpg_runs,
+	       (unsigned long long)sim_stats.training_runs,
+	       (unsigned long long)sim_stats.dma_descs);
+	printf("mv_ddr: sim: dma miscompares %llu, memory pages %d\n",
+	       (unsigned long long)sim_stats.dma_miscompares, sim_mem_pages);
+	printf("mv_ddr: sim: delays %llu us, total time %llu us\n",
+	       (unsigned long long)(sim_stats.delay_ns / 1000),
+	       (unsigned long long)(sim_stats.time_ns / 1000));
+}
@@ -0,0 +1,103 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _MV_DDR_SIM_H
+#define _MV_DDR_SIM_H
+
+/* simulated access cost, in nanoseconds */
+#define MV_DDR_SIM_DUNIT_ACCESS_NS	100
+#define MV_DDR_SIM_MMIO_ACCESS_NS	50
+
+/* default sample-at-reset ddr clock mode: cpu 1600, ddr 800 */
+#define MV_DDR_SIM_SAR_DEFAULT		0x4
+/* default device id: apn806 b0 (no avs fixup) */
+#define MV_DDR_SIM_DEV_ID_DEFAULT	0x7045
+
+/* training engine results reported by the simulated phy */
+#define MV_DDR_SIM_EDGE_1		0x10
+#define MV_DDR_SIM_EDGE_2		0x30
+
+struct mv_ddr_sim_stats {
+	uint64_t mmio_rd;	/* any register or memory read */
+	uint64_t mmio_wr;	/* any register or memory write */
+	uint64_t dunit_rd;	/* dunit register reads */
+	uint64_t dunit_wr;	/* dunit register writes */
+	uint64_t phy_rd;	/* phy register file reads */
+	uint64_t phy_wr;	/* phy register file writes (broadcast counts once) */
+	uint64_t odpg_runs;	/* odpg transactions started */
+	uint64_t training_runs;	/* training ip engine triggers */
+	uint64_t dma_descs;	/* xor v2 descriptors processed */
+	uint64_t dma_miscompares;	/* xor v2 memcmp descriptors failed */
+	uint64_t delay_ns;	/* time spent in mdelay/udelay */
+	uint64_t time_ns;	/* total simulated time */
+};
+
+/**
+ * reset the simulated register file, phy and state machines
+ *
+ * @param    sar	sample-at-reset ddr clock mode
+ * @param    dev_id	device id reported by the chip id register
+ *
+ * @retval 0 success
+ */
+int mv_ddr_sim_init(u32 sar, u32 dev_id);
+
+/**
+ * make byte lanes faulty: their tx valid window moves, so trained results
+ * restored from an earlier boot no longer pass
+ *
+ * @param    subphy_mask	data subphys to drift
+ */
+void mv_ddr_sim_lane_fault_set(u32 subphy_mask);
+
+/**
+ * make byte lanes faulty for the dma engines: data they read thru these
+ * lanes is corrupted, so copies, compares and crc32c checks fail
+ *
+ * @param    lane_mask	byte lanes of the bus to corrupt; 0 - no fault
+ * @param    desc_num	descriptors to corrupt, from the next one; 0 - all
+ */
+void mv_ddr_sim_dma_fault_set(u32 lane_mask, u32 desc_num);
+
+/**
+ * release the simulated register file and memory
+ */
+void mv_ddr_sim_release(void);
+
+/**
+ * get accumulated simulator statistics
+ *
+ * @retval pointer to the statistics
+ */
+struct mv_ddr_sim_stats *mv_ddr_sim_stats_get(void);
+
+/**
+ * print accumulated simulator statistics
+ */
+void mv_ddr_sim_stats_print(void);
+
+/**
+ * read a simulated phy register directly, without counting an access
+ *
+ * @param    phy_type	data or control phy
+ * @param    subphy	subphy number
+ * @param    addr	phy register address
+ *
+ * @retval phy register value
+ */
+u16 mv_ddr_sim_phy_peek(enum hws_ddr_phy phy_type, u32 subphy, u32 addr);
+
+/**
+ * play a register access trace record back: ddr3_init() runs on the
+ * simulated register file and its traced reads return the recorded values,
+ * so the recorded run, failures included, reproduces
+ *
+ * @param    buf	trace record, as returned by mv_ddr_trace_record_get()
+ * @param    len	record length in bytes
+ *
+ * @retval MV_OK the flow followed the whole record
+ */
+int mv_ddr_sim_replay(const u8 *buf, u32 len);
+
+#endif /* _MV_DDR_SIM_H */
@@ -0,0 +1,293 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdlib.h>
+#include "ddr3_init.h"
+#include "mv_ddr_sim.h"
+
+/*
+ * simulated board: a70x0 with a single-rank 32-bit ddr4 interface
+ * and ecc on subphy 8
+ */
+static struct mv_ddr_topology_map board_topology_map = {
+	DEBUG_LEVEL_ERROR,
+	0x1, /* active interfaces */
+	/* cs_mask, mirror, dqs_swap, ck_swap X subphys */
+	{ { { {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0},
+	      {0x1, 0x0, 0, 0} },
+	    SPEED_BIN_DDR_2400T,	/* speed_bin */
+	    MV_DDR_DEV_WIDTH_8BIT,	/* sdram device width */
+	    MV_DDR_DIE_CAP_8GBIT,	/* die capacity */
+	    MV_DDR_FREQ_SAR,		/* frequency */
+	    0, 0,			/* cas_l, cas_wl */
+	    MV_DDR_TEMP_LOW} },		/* temperature */
+	BUS_MASK_32BIT,			/* subphys mask */
+	MV_DDR_CFG_DEFAULT,		/* ddr configuration data source */
+	NOT_COMBINED,			/* ddr twin-die combined */
+	{ {0} },			/* raw spd data */
+	{0},				/* timing parameters */
+	{				/* electrical configuration */
+		{			/* memory electrical configuration */
+			MV_DDR_RTT_NOM_PARK_RZQ_DISABLE,	/* rtt_nom */
+			{
+				MV_DDR_RTT_NOM_PARK_RZQ_DIV4,	/* rtt_park 1cs */
+				MV_DDR_RTT_NOM_PARK_RZQ_DIV1	/* rtt_park 2cs */
+			},
+			{
+				MV_DDR_RTT_WR_DYN_ODT_OFF,	/* rtt_wr 1cs */
+				MV_DDR_RTT_WR_RZQ_DIV2		/* rtt_wr 2cs */
+			},
+			MV_DDR_DIC_RZQ_DIV7	/* dic */
+		},
+		{			/* phy electrical configuration */
+			MV_DDR_OHM_30,	/* data_drv_p */
+			MV_DDR_OHM_30,	/* data_drv_n */
+			MV_DDR_OHM_30,	/* ctrl_drv_p */
+			MV_DDR_OHM_30,	/* ctrl_drv_n */
+			{
+				MV_DDR_OHM_60,	/* odt_p 1cs */
+				MV_DDR_OHM_120	/* odt_p 2cs */
+			},
+			{
+				MV_DDR_OHM_60,	/* odt_n 1cs */
+				MV_DDR_OHM_120	/* odt_n 2cs */
+			},
+		},
+		{			/* mac electrical configuration */
+			MV_DDR_ODT_CFG_NORMAL,		/* odt_cfg_pat */
+			MV_DDR_ODT_CFG_ALWAYS_ON,	/* odt_cfg_wr */
+			MV_DDR_ODT_CFG_NORMAL,		/* odt_cfg_rd */
+		},
+	},
+};
+
+struct mv_ddr_topology_map *mv_ddr_topology_map_get(void)
+{
+	/* Return the board topology as defined in the board code */
+	return &board_topology_map;
+}
+
+static void usage(const char *name)
+{
+	printf("usage: %s [-s sar_clk_mode] [-d dev_id] [-f lane_mask] [-w] [-l subphy_mask]\n"
+	       "\t[-t trace_file] [-r trace_file] [-p prof_file]\n", name);
+	printf("\t-s\tsample-at-reset ddr clock mode (default 0x%x)\n", MV_DDR_SIM_SAR_DEFAULT);
+	printf("\t-d\tdevice id (default 0x%x)\n", MV_DDR_SIM_DEV_ID_DEFAULT);
+	printf("\t-f\tcorrupt the data the dma engines read thru these byte lanes\n");
+#if defined(MV_DDR_SNAPSHOT)
+	printf("\t-w\twarm boot: re-init from the snapshot of a first full training\n");
+#endif /* MV_DDR_SNAPSHOT */
+#if defined(MV_DDR_RETRAIN)
+	printf("\t-l\tdrift the tx window of these subphys before the warm boot\n");
+#endif /* MV_DDR_RETRAIN */
+#if defined(MV_DDR_TRACE)
+	printf("\t-t\tsave the register access trace of the last ddr3_init\n");
+	printf("\t-r\tplay a saved register access trace back thru ddr3_init\n");
+#endif /* MV_DDR_TRACE */
+#if defined(MV_DDR_PROF)
+	printf("\t-p\tsave the training profile record of the last ddr3_init\n");
+#endif /* MV_DDR_PROF */
+}
+
+#if defined(MV_DDR_SNAPSHOT)
+/* reset the register file and run ddr3_init again with the last snapshot */
+static int warm_boot(u32 sar, u32 dev_id, u32 dma_fault, u32 lane_fault)
+{
+	const u8 *blob;
+	u8 *copy;
+	u32 size;
+	int ret;
+
+	blob = mv_ddr_snapshot_get(&size);
+	if (blob == NULL) {
+		printf("mv_ddr: sim: no snapshot\n");
+		return MV_FAIL;
+	}
+
+	copy = malloc(size);
+	if (copy == NULL)
+		return MV_FAIL;
+	memcpy(copy, blob, size);
+
+	mv_ddr_sim_stats_print();
+	printf("mv_ddr: sim: warm boot with a %d-byte snapshot\n", size);
+	if (mv_ddr_sim_init(sar, dev_id) != 0) {
+		free(copy);
+		return MV_FAIL;
+	}
+	mv_ddr_sim_dma_fault_set(dma_fault, 0);
+#if defined(MV_DDR_RETRAIN)
+	mv_ddr_sim_lane_fault_set(lane_fault);
+#endif /* MV_DDR_RETRAIN */
+
+	mv_ddr_snapshot_set(copy, size, 0);
+	ret = ddr3_init();
+	mv_ddr_snapshot_set(NULL, 0, 0);
+	free(copy);
+
+	return ret;
+}
+#endif /* MV_DDR_SNAPSHOT */
+
+#if defined(MV_DDR_TRACE)
+static int trace_save(const char *path)
+{
+	FILE *fp;
+	u8 *buf;
+	u32 len;
+	int ret;
+
+	buf = malloc(MV_DDR_TRACE_RECORD_MAX_SIZE);
+	if (buf == NULL)
+		return MV_FAIL;
+
+	ret = mv_ddr_trace_record_get(buf, MV_DDR_TRACE_RECORD_MAX_SIZE, &len);
+	fp = fopen(path, "wb");
+	if (ret != MV_OK || fp == NULL || fwrite(buf, 1, len, fp) != len) {
+		printf("mv_ddr: sim: failed to save the trace to %s\n", path);
+		ret = MV_FAIL;
+	} else {
+		printf("mv_ddr: sim: saved a %d-byte trace to %s\n", len, path);
+	}
+
+	if (fp != NULL)
+		fclose(fp);
+	free(buf);
+
+	return ret;
+}
+
+static int trace_replay(const char *path)
+{
+	FILE *fp;
+	u8 *buf;
+	long len;
+	int ret = MV_FAIL;
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) {
+		printf("mv_ddr: sim: cannot open %s\n", path);
+		return MV_FAIL;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	len = ftell(fp);
+	rewind(fp);
+	buf = (len > 0) ? malloc(len) : NULL;
+	if (buf != NULL && fread(buf, 1, len, fp) == (size_t)len)
+		ret = mv_ddr_sim_replay(buf, len);
+
+	free(buf);
+	fclose(fp);
+
+	return ret;
+}
+#endif /* MV_DDR_TRACE */
+
+#if defined(MV_DDR_PROF)
+static int prof_save(const char *path)
+{
+	u8 buf[MV_DDR_PROF_RECORD_MAX_SIZE];
+	FILE *fp;
+	u32 len;
+	int ret;
+
+	ret = mv_ddr_prof_record_get(buf, sizeof(buf), &len);
+	fp = fopen(path, "wb");
+	if (ret != MV_OK || fp == NULL || fwrite(buf, 1, len, fp) != len) {
+		printf("mv_ddr: sim: failed to save the profile to %s\n", path);
+		ret = MV_FAIL;
+	} else {
+		printf("mv_ddr: sim: saved a %d-byte profile to %s\n", len, path);
+	}
+
+	if (fp != NULL)
+		fclose(fp);
+
+	return ret;
+}
+#endif /* MV_DDR_PROF */
+
+int main(int argc, char *argv[])
+{
+	u32 sar = MV_DDR_SIM_SAR_DEFAULT;
+	u32 dev_id = MV_DDR_SIM_DEV_ID_DEFAULT;
+	u32 dma_fault = 0, lane_fault = 0;
+	int i, ret, warm = 0;
+	const char *trace_out = NULL, *trace_in = NULL, *prof_out = NULL;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+			sar = strtoul(argv[++i], NULL, 0);
+		} else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+			dev_id = strtoul(argv[++i], NULL, 0);
+		} else if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+			dma_fault = strtoul(argv[++i], NULL, 0);
+#if defined(MV_DDR_SNAPSHOT)
+		} else if (!strcmp(argv[i], "-w")) {
+			warm = 1;
+#endif /* MV_DDR_SNAPSHOT */
+#if defined(MV_DDR_RETRAIN)
+		} else if (!strcmp(argv[i], "-l") && i + 1 < argc) {
+			lane_fault = strtoul(argv[++i], NULL, 0);
+#endif /* MV_DDR_RETRAIN */
+#if defined(MV_DDR_TRACE)
+		} else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+			trace_out = argv[++i];
+		} else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+			trace_in = argv[++i];
+#endif /* MV_DDR_TRACE */
+#if defined(MV_DDR_PROF)
+		} else if (!strcmp(argv[i], "-p") && i + 1 < argc) {
+			prof_out = argv[++i];
+#endif /* MV_DDR_PROF */
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (mv_ddr_sim_init(sar, dev_id) != 0)
+		return 1;
+	mv_ddr_sim_dma_fault_set(dma_fault, 0);
+
+#if defined(MV_DDR_TRACE)
+	if (trace_in != NULL) {
+		ret = trace_replay(trace_in);
+		mv_ddr_sim_stats_print();
+		mv_ddr_sim_release();
+		printf("mv_ddr: sim: replay %s\n", (ret == MV_OK) ? "passed" : "failed");
+
+		return (ret == MV_OK) ? 0 : 1;
+	}
+#endif /* MV_DDR_TRACE */
+
+	ret = ddr3_init();
+#if defined(MV_DDR_SNAPSHOT)
+	if (ret == MV_OK && warm)
+		ret = warm_boot(sar, dev_id, dma_fault, lane_fault);
+#endif /* MV_DDR_SNAPSHOT */
+#if defined(MV_DDR_TRACE)
+	if (trace_out != NULL && trace_save(trace_out) != MV_OK)
+		ret = MV_FAIL;
+#endif /* MV_DDR_TRACE */
+#if defined(MV_DDR_PROF)
+	if (prof_out != NULL && prof_save(prof_out) != MV_OK)
+		ret = MV_FAIL;
+#endif /* MV_DDR_PROF */
+
+	mv_ddr_sim_stats_print();
+	mv_ddr_sim_release();
+
+	printf("mv_ddr: sim: ddr3_init %s\n", (ret == MV_OK) ? "passed" : "failed");
+
+	return (ret == MV_OK) ? 0 : 1;
+}
@@ -0,0 +1,45 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#if defined(MV_DDR_TRACE)
+
+/* playback of a register access trace on the simulated register file */
+
+#include "ddr3_init.h"
+#include "mv_ddr_sim.h"
+
+static u32 sim_replay_get(const u8 *buf, u32 size)
+{
+	u32 val = 0;
+	u32 i;
+
+	for (i = 0; i < size; i++)
+		val |= buf[i] << (8 * i);
+
+	return val;
+}
+
+int mv_ddr_sim_replay(const u8 *buf, u32 len)
+{
+	u32 count, total, played;
+	int ret, status;
+
+	if (mv_ddr_trace_playback_start(buf, len) != MV_OK)
+		return MV_FAIL;
+
+	count = sim_replay_get(buf + 8, 4);
+	total = sim_replay_get(buf + 12, 4);
+	if (total != count)
+		printf("mv_ddr: sim: replay: the record holds the first %d of %d accesses, "
+		       "the rest runs on the simulated register file\n", count, total);
+
+	status = ddr3_init();
+	ret = mv_ddr_trace_playback_stop(&played);
+
+	printf("mv_ddr: sim: replay: %d of %d entries played back, ddr3_init %s\n",
+	       played, count, (status == MV_OK) ? "passed" : "failed");
+
+	return ret;
+}
+#endif /* MV_DDR_TRACE */
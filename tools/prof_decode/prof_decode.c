@@ -0,0 +1,112 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * training profile record decoder
+ *
+ * prints the binary record of a MV_DDR_PROF build (see mv_ddr_prof.h) in
+ * the mv_ddr_prof_print() format. the record is either fetched from
+ * MV_DDR_PROF_DUMP_ADDR after boot or saved by the simulator (-p).
+ *
+ * build and run:
+ *	make TOOL=prof_decode
+ *	./prof_decode prof.bin
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/* profile record, as in mv_ddr_prof.h */
+#define PROF_MAGIC		0x5044564d /* "MVDP" */
+#define PROF_VERSION		2
+#define PROF_HDR_SIZE		12
+#define PROF_CNT_MAX		5
+#define PROF_NAME_SIZE		28
+#define PROF_ENTRY_MIN_SIZE	(8 + 4 * PROF_CNT_MAX + PROF_NAME_SIZE)
+
+static uint32_t get(const uint8_t *buf, unsigned int size)
+{
+	uint32_t val = 0;
+	unsigned int i;
+
+	for (i = 0; i < size; i++)
+		val |= (uint32_t)buf[i] << (8 * i);
+
+	return val;
+}
+
+static int prof_print(const uint8_t *buf, long len)
+{
+	unsigned int count, entry_size, idx, i;
+	const uint8_t *ptr;
+	char name[PROF_NAME_SIZE + 1];
+
+	if (len < PROF_HDR_SIZE || get(buf, 4) != PROF_MAGIC) {
+		fprintf(stderr, "not a profile record\n");
+		return 1;
+	}
+	if (get(buf + 4, 2) != PROF_VERSION) {
+		fprintf(stderr, "unsupported profile record version %d\n", get(buf + 4, 2));
+		return 1;
+	}
+
+	count = buf[6];
+	entry_size = buf[7];
+	if (entry_size < PROF_ENTRY_MIN_SIZE || len < PROF_HDR_SIZE + (long)count * entry_size) {
+		fprintf(stderr, "truncated profile record\n");
+		return 1;
+	}
+
+	printf("mv_ddr: training profile (total %d us)\n", get(buf + 8, 4));
+	printf("%-24s %5s %10s %9s %9s %9s %9s %9s\n", "stage", "runs", "time[us]",
+	       "dunit_rd", "dunit_wr", "phy_rd", "phy_wr", "polls");
+	for (idx = 0, ptr = buf + PROF_HDR_SIZE; idx < count; idx++, ptr += entry_size) {
+		for (i = 0; i < PROF_NAME_SIZE; i++)
+			name[i] = ptr[8 + 4 * PROF_CNT_MAX + i];
+		name[PROF_NAME_SIZE] = '\0';
+		if (name[0] == '\0')
+			snprintf(name, sizeof(name), "stage %d", ptr[0]);
+		/* runs saturate at 255 in the record */
+		printf("%-24s %5d %10d", name, ptr[1], get(ptr + 4, 4));
+		for (i = 0; i < PROF_CNT_MAX; i++)
+			printf(" %9d", get(ptr + 8 + 4 * i, 4));
+		printf("\n");
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *fp;
+	uint8_t *buf;
+	long len;
+	int ret = 1;
+
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s prof_record\n", argv[0]);
+		return 1;
+	}
+
+	fp = fopen(argv[1], "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "cannot open %s\n", argv[1]);
+		return 1;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	len = ftell(fp);
+	rewind(fp);
+	buf = (len > 0) ? malloc(len) : NULL;
+	if (buf != NULL && fread(buf, 1, len, fp) == (size_t)len)
+		ret = prof_print(buf, len);
+	else
+		fprintf(stderr, "cannot read %s\n", argv[1]);
+
+	free(buf);
+	fclose(fp);
+
+	return ret;
+}
@@ -0,0 +1,255 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * snps binary mail box log decoder
+ *
+ * decodes the mail box log dumped by a build with SNPS_MAIL_BOX_BIN
+ * (see drivers/snps/snps_mailbox_bin.h) out of a console capture, using
+ * the full 1D/2D message dictionaries that aren't compiled into the target.
+ *
+ * build and run:
+ *	make TOOL=snps_mb_decode
+ *	./snps_mb_decode [-l log_level] console.log
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../../drivers/snps/snps_mailbox_bin.h"
+
+/* definitions the dictionaries need, as in drivers/snps/snps.h */
+typedef unsigned short u16;
+
+#define MAILBOX_MSG_ARGUMENT_MAX_COUNT	36
+
+struct mail_box_stream_message {
+	u16 message_id;
+	u16 argument_count;
+	u16 log_level;
+	const char *string[(MAILBOX_MSG_ARGUMENT_MAX_COUNT * 2) + 1];
+};
+
+enum snps_log_level {
+	LOG_LEVEL_10 = 0,
+	LOG_LEVEL_20,
+	LOG_LEVEL_30,
+	LOG_LEVEL_40,
+	LOG_LEVEL_50
+};
+
+#define FULL_MAIL_BOX_1D
+#define FULL_MAIL_BOX_2D
+#include "../../drivers/snps/snps_mailbox_stream.h"
+
+#define ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+
+static const struct {
+	int message_id;
+	const char *string;
+} major_messages[] = {
+	{0x00, "End of initialization"},
+	{0x01, "End of fine write leveling"},
+	{0x02, "End of read enable training"},
+	{0x03, "End of read delay center optimization"},
+	{0x04, "End of write delay center optimization"},
+	{0x05, "End of 2D read delay/voltage center optimization"},
+	{0x06, "End of 2D write delay /voltage center optimization"},
+	{0x07, "Training has run successfully (firmware complete)"},
+	{0x08, "Steam message"},
+	{0x09, "End of max read latency training"},
+	{0x0a, "End of read dq deskew training"},
+	{0x0b, "End of LCDL offset calibration"},
+	{0x0c, "End of LRDIMM Specific training (DWL, MREP, MRD and MWD)"},
+	{0x0d, "End of CA training"},
+	{0xfd, "End of MPR read delay center optimization / write leveling coarse delay"},
+	{0xff, "Training has failed (firmware complete)"}
+};
+
+static const char *const state_names[] = {"PHY", "1D", "2D", "PIE"};
+
+/* dictionary index, sorted by message id */
+struct dict {
+	const struct mail_box_stream_message **msgs;
+	int count;
+};
+
+static int dict_cmp(const void *a, const void *b)
+{
+	const struct mail_box_stream_message *const *x = a, *const *y = b;
+
+	return (int)(*x)->message_id - (int)(*y)->message_id;
+}
+
+static void dict_init(struct dict *dict, const struct mail_box_stream_message *msgs, int count)
+{
+	int i;
+
+	dict->msgs = malloc(count * sizeof(*dict->msgs));
+	if (dict->msgs == NULL)
+		exit(1);
+	for (i = 0; i < count; i++)
+		dict->msgs[i] = &msgs[i];
+	dict->count = count;
+	qsort(dict->msgs, count, sizeof(*dict->msgs), dict_cmp);
+}
+
+static const struct mail_box_stream_message *dict_find(const struct dict *dict, int message_id)
+{
+	struct mail_box_stream_message key;
+	const struct mail_box_stream_message *pkey = &key, **found;
+
+	key.message_id = message_id;
+	found = bsearch(&pkey, dict->msgs, dict->count, sizeof(*dict->msgs), dict_cmp);
+
+	return found ? *found : NULL;
+}
+
+static void major_print(int message_id)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(major_messages); i++)
+		if (major_messages[i].message_id == message_id) {
+			printf("%s\n", major_messages[i].string);
+			return;
+		}
+
+	printf("unknown major message 0x%x\n", message_id);
+}
+
+static void stream_print(const struct mail_box_stream_message *msg, const uint32_t *args, int argc)
+{
+	int i, arg = 0;
+
+	for (i = 0; i < (int)ARRAY_SIZE(msg->string) && msg->string[i] != NULL; i++) {
+		if (strcmp(msg->string[i], "INT") == 0)
+			printf("%d", (arg < argc) ? (int)args[arg++] : 0);
+		else if (strcmp(msg->string[i], "HEX") == 0)
+			printf("0x%x", (arg < argc) ? args[arg++] : 0);
+		else
+			fputs(msg->string[i], stdout);
+	}
+	if (argc != msg->argument_count)
+		printf("(warning: %d arguments logged, %d expected)\n", argc, msg->argument_count);
+}
+
+/* decode a record stream; returns the number of records */
+static int records_decode(const uint32_t *words, int count, const struct dict *dicts, int log_level)
+{
+	const struct mail_box_stream_message *msg;
+	int i, argc, id, state, records = 0;
+
+	for (i = 0; i < count; i += 1 + argc, records++) {
+		id = (words[i] >> SNPS_MB_REC_ID_OFFS) & SNPS_MB_REC_ID_MASK;
+		argc = (words[i] >> SNPS_MB_REC_ARGC_OFFS) & SNPS_MB_REC_ARGC_MASK;
+		state = (words[i] >> SNPS_MB_REC_STATE_OFFS) & SNPS_MB_REC_STATE_MASK;
+		if (i + 1 + argc > count) {
+			printf("truncated record at word %d\n", i);
+			break;
+		}
+
+		if (!(words[i] & SNPS_MB_REC_STREAM)) {
+			printf("[%s] ", state_names[state]);
+			major_print(id);
+			continue;
+		}
+
+		/* 2D has its own dictionary; other stages use the 1D one */
+		msg = dict_find(&dicts[state == 2], id);
+		if (msg == NULL) {
+			printf("[%s] unknown stream message 0x%x\n", state_names[state], id);
+			continue;
+		}
+		if (msg->log_level < log_level)
+			continue;
+		printf("[%s] ", state_names[state]);
+		stream_print(msg, &words[i + 1], argc);
+	}
+
+	return records;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *input = NULL;
+	struct dict dicts[2];
+	int i, log_level = LOG_LEVEL_10, count = 0, size = 0, lost = 0;
+	uint32_t *words = NULL;
+	char line[1024], *pos, *end;
+	unsigned long word;
+	FILE *fp;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-l") && i + 1 < argc)
+			log_level = strtoul(argv[++i], NULL, 0);
+		else if (argv[i][0] != '-' && input == NULL)
+			input = argv[i];
+		else
+			input = NULL, i = argc;
+	}
+
+	if (input == NULL) {
+		fprintf(stderr, "usage: %s [-l log_level] console.log\n", argv[0]);
+		fprintf(stderr, "\t-l\tskip stream messages below log level (0-4)\n");
+		return 1;
+	}
+
+	fp = fopen(input, "r");
+	if (fp == NULL) {
+		perror(input);
+		return 1;
+	}
+
+	dict_init(&dicts[0], one_d_messages, ARRAY_SIZE(one_d_messages));
+	dict_init(&dicts[1], two_d_messages, ARRAY_SIZE(two_d_messages));
+
+	/* collect the words of the last dump in the capture */
+	while (fgets(line, sizeof(line), fp)) {
+		pos = strstr(line, SNPS_MB_BIN_TAG);
+		if (pos == NULL)
+			continue;
+		pos += strlen(SNPS_MB_BIN_TAG);
+
+		if (sscanf(pos, " begin %d %d", &size, &lost) == 2) {
+			free(words);
+			words = malloc((size + 1) * sizeof(*words));
+			if (words == NULL)
+				return 1;
+			count = 0;
+			continue;
+		}
+		if (words == NULL || strstr(pos, "end"))
+			continue;
+
+		for (;;) {
+			word = strtoul(pos, &end, 16);
+			if (end == pos)
+				break;
+			if (count < size)
+				words[count++] = word;
+			pos = end;
+		}
+	}
+	fclose(fp);
+
+	if (words == NULL) {
+		fprintf(stderr, "%s: no '%s' dump found\n", input, SNPS_MB_BIN_TAG);
+		return 1;
+	}
+	if (count != size)
+		printf("warning: %d of %d words found\n", count, size);
+	if (lost)
+		printf("%d oldest records were dropped on the target\n", lost);
+
+	printf("%d records decoded\n", records_decode(words, count, dicts, log_level));
+
+	free(words);
+	free(dicts[0].msgs);
+	free(dicts[1].msgs);
+
+	return 0;
+}
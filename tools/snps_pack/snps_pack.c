@@ -0,0 +1,344 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * snps firmware section packer
+ *
+ * reads the prebuilt drivers/snps/fw/snps_static.o (aarch64 elf object) and
+ * emits a c file with the same sections, where the sequential imem/dmem
+ * images are packed as described in drivers/snps/snps_pack.h: rle for the
+ * zero-heavy dmem and lz for imem. the random sections are kept as is.
+ * the size saved per section is reported on stderr.
+ *
+ * build and run (the atf build does it with SNPS_PACKED=y):
+ *	make TOOL=snps_pack
+ *	./snps_pack [-w window] drivers/snps/fw/snps_static.o > snps_static_packed.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../../drivers/snps/snps_pack.h"
+
+#define SHT_SYMTAB	2
+#define SHT_RELA	4
+#define R_AARCH64_ABS64	257
+
+#define TOKEN_MAX	(SNPS_PACK_REP - 1)	/* largest token count field */
+
+struct seq_section {
+	const char *sym;
+	const char *packed;
+	const char *name;
+	int codec;
+};
+
+static const struct seq_section seq_sections[] = {
+	{"one_d_imem_static", "one_d_imem_packed", "1D IMEM", SNPS_PACK_LZ},
+	{"one_d_dmem_static", "one_d_dmem_packed", "1D DMEM", SNPS_PACK_RLE},
+	{"two_d_imem_static", "two_d_imem_packed", "2D IMEM", SNPS_PACK_LZ},
+	{"two_d_dmem_static", "two_d_dmem_packed", "2D DMEM", SNPS_PACK_RLE}
+};
+
+static const char *const random_sections[] = {"init_phy_static", "pie_static"};
+
+static uint8_t *elf;
+static long elf_len;
+
+static uint64_t get_le(const uint8_t *buf, unsigned int size)
+{
+	uint64_t val = 0;
+	unsigned int i;
+
+	for (i = 0; i < size; i++)
+		val |= (uint64_t)buf[i] << (8 * i);
+
+	return val;
+}
+
+static const uint8_t *shdr(unsigned int idx)
+{
+	return elf + get_le(elf + 0x28, 8) + idx * get_le(elf + 0x3a, 2);
+}
+
+static const uint8_t *section_data(unsigned int idx)
+{
+	return elf + get_le(shdr(idx) + 0x18, 8);
+}
+
+/* find a symbol; returns its section index, value and size */
+static int sym_find(const char *name, unsigned int *shndx, uint64_t *value, uint64_t *size)
+{
+	unsigned int i, j, num = get_le(elf + 0x3c, 2);
+	const uint8_t *sh, *sym;
+	const char *strtab;
+
+	for (i = 0; i < num; i++) {
+		sh = shdr(i);
+		if (get_le(sh + 0x4, 4) != SHT_SYMTAB)
+			continue;
+		strtab = (const char *)section_data(get_le(sh + 0x28, 4));
+		for (j = 0; j < get_le(sh + 0x20, 8) / 24; j++) {
+			sym = section_data(i) + j * 24;
+			if (strcmp(strtab + get_le(sym, 4), name))
+				continue;
+			*shndx = get_le(sym + 6, 2);
+			*value = get_le(sym + 8, 8);
+			*size = get_le(sym + 16, 8);
+			return 0;
+		}
+	}
+
+	fprintf(stderr, "snps_pack: symbol %s not found\n", name);
+	return -1;
+}
+
+/* resolve an abs64 pointer at offset of section shndx; returns target section and offset */
+static int reloc_find(unsigned int shndx, uint64_t offset, unsigned int *target, uint64_t *addend)
+{
+	unsigned int i, j, num = get_le(elf + 0x3c, 2);
+	const uint8_t *sh, *rela, *symtab;
+
+	for (i = 0; i < num; i++) {
+		sh = shdr(i);
+		if (get_le(sh + 0x4, 4) != SHT_RELA || get_le(sh + 0x2c, 4) != shndx)
+			continue;
+		symtab = section_data(get_le(sh + 0x28, 4));
+		for (j = 0; j < get_le(sh + 0x20, 8) / 24; j++) {
+			rela = section_data(i) + j * 24;
+			if (get_le(rela, 8) != offset ||
+			    (get_le(rela + 8, 8) & 0xffffffff) != R_AARCH64_ABS64)
+				continue;
+			*target = get_le(symtab + (get_le(rela + 8, 8) >> 32) * 24 + 6, 2);
+			*addend = get_le(symtab + (get_le(rela + 8, 8) >> 32) * 24 + 8, 8) +
+				  get_le(rela + 16, 8);
+			return 0;
+		}
+	}
+
+	fprintf(stderr, "snps_pack: no relocation at 0x%llx\n", (unsigned long long)offset);
+	return -1;
+}
+
+static void put_word(uint8_t *out, int *len, uint16_t word)
+{
+	out[(*len)++] = word & 0xff;
+	out[(*len)++] = word >> 8;
+}
+
+/* flush pending literal words */
+static void put_literals(uint8_t *out, int *len, const uint16_t *lit, int *lit_num)
+{
+	int i, cnt;
+
+	while (*lit_num > 0) {
+		cnt = (*lit_num > TOKEN_MAX + 1) ? TOKEN_MAX + 1 : *lit_num;
+		out[(*len)++] = cnt - 1;
+		for (i = 0; i < cnt; i++)
+			put_word(out, len, lit[i]);
+		lit += cnt;
+		*lit_num -= cnt;
+	}
+}
+
+static int rle_pack(const uint16_t *in, int num, uint8_t *out)
+{
+	int i = 0, run, len = 0, lit_num = 0;
+
+	while (i < num) {
+		for (run = 1; i + run < num && in[i + run] == in[i] &&
+		     run < TOKEN_MAX + SNPS_PACK_RLE_MIN; run++)
+			;
+		if (run < SNPS_PACK_RLE_MIN) {
+			if (lit_num == TOKEN_MAX + 1)
+				put_literals(out, &len, in + i - lit_num, &lit_num);
+			lit_num++;
+			i++;
+			continue;
+		}
+		put_literals(out, &len, in + i - lit_num, &lit_num);
+		out[len++] = SNPS_PACK_REP + run - SNPS_PACK_RLE_MIN;
+		put_word(out, &len, in[i]);
+		i += run;
+	}
+	put_literals(out, &len, in + i - lit_num, &lit_num);
+
+	return len;
+}
+
+static int lz_pack(const uint16_t *in, int num, uint8_t *out, int window)
+{
+	int i = 0, j, k, len = 0, lit_num = 0, best, best_dist;
+
+	while (i < num) {
+		best = 0;
+		best_dist = 0;
+		for (j = (i > window) ? i - window : 0; j < i; j++) {
+			for (k = 0; i + k < num && in[j + k] == in[i + k] &&
+			     k < TOKEN_MAX + SNPS_PACK_LZ_MIN; k++)
+				;
+			if (k >= best) {
+				/* prefer the nearest match */
+				best = k;
+				best_dist = i - j;
+			}
+		}
+		/* a match costs a token and a distance, literals a word each */
+		if (best < SNPS_PACK_LZ_MIN) {
+			if (lit_num == TOKEN_MAX + 1)
+				put_literals(out, &len, in + i - lit_num, &lit_num);
+			lit_num++;
+			i++;
+			continue;
+		}
+		put_literals(out, &len, in + i - lit_num, &lit_num);
+		out[len++] = SNPS_PACK_REP + best - SNPS_PACK_LZ_MIN;
+		put_word(out, &len, best_dist);
+		i += best;
+	}
+	put_literals(out, &len, in + i - lit_num, &lit_num);
+
+	return len;
+}
+
+static void bytes_print(const uint8_t *buf, int len)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		printf("%s0x%02x,%s", (i % 12) ? " " : "\t", buf[i],
+		       ((i % 12) == 11 || i == len - 1) ? "\n" : "");
+}
+
+static int seq_section_print(const struct seq_section *sec, int window)
+{
+	unsigned int shndx, data_shndx;
+	uint64_t value, size, data_off;
+	const uint8_t *seq;
+	uint16_t *words;
+	uint8_t *packed;
+	int start, end, count, i, len;
+
+	if (sym_find(sec->sym, &shndx, &value, &size) ||
+	    reloc_find(shndx, value + 16, &data_shndx, &data_off))
+		return -1;
+
+	seq = section_data(shndx) + value;
+	start = (int)get_le(seq, 4);
+	end = (int)get_le(seq + 4, 4);
+	count = (int)get_le(seq + 8, 4);
+
+	words = malloc(count * sizeof(*words));
+	packed = malloc(count * 3 + 16);	/* literal runs, worst case */
+	if (words == NULL || packed == NULL)
+		return -1;
+	for (i = 0; i < count; i++)
+		words[i] = get_le(section_data(data_shndx) + data_off + 2 * i, 2);
+
+	if (sec->codec == SNPS_PACK_LZ)
+		len = lz_pack(words, count, packed, window);
+	else
+		len = rle_pack(words, count, packed);
+
+	printf("static const unsigned char %s_data[] = {\n", sec->packed);
+	bytes_print(packed, len);
+	printf("};\n\n");
+	printf("const struct snps_seq_packed %s = {\n", sec->packed);
+	printf("\t.start_addr = 0x%x,\n\t.end_addr = 0x%x,\n\t.data_count = %d,\n",
+	       start, end, count);
+	printf("\t.codec = %s,\n\t.window = %d,\n\t.size = %d,\n",
+	       (sec->codec == SNPS_PACK_LZ) ? "SNPS_PACK_LZ" : "SNPS_PACK_RLE",
+	       (sec->codec == SNPS_PACK_LZ) ? window : 0, len);
+	printf("\t.data = %s_data\n};\n\n", sec->packed);
+
+	fprintf(stderr, "snps_pack: %-8s %6d -> %6d bytes (%s), saved %d bytes\n",
+		sec->name, 2 * count, len, (sec->codec == SNPS_PACK_LZ) ? "lz" : "rle",
+		2 * count - len);
+
+	free(words);
+	free(packed);
+
+	return 2 * count - len;
+}
+
+static int random_section_print(const char *sym)
+{
+	unsigned int shndx;
+	uint64_t value, size, i;
+	const uint8_t *entry;
+
+	if (sym_find(sym, &shndx, &value, &size))
+		return -1;
+
+	/* struct snps_address_data: int addr, u16 data, padded to 8 bytes */
+	printf("struct snps_address_data %s[] = {\n", sym);
+	for (i = 0; i < size / 8; i++) {
+		entry = section_data(shndx) + value + i * 8;
+		printf("\t{%d, 0x%x},\n", (int)get_le(entry, 4), (unsigned int)get_le(entry + 4, 2));
+	}
+	printf("};\n\n");
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *input = NULL;
+	int window = SNPS_PACK_WINDOW_MAX;
+	int i, saved, total = 0;
+	FILE *fp;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-w") && i + 1 < argc)
+			window = strtoul(argv[++i], NULL, 0);
+		else if (argv[i][0] != '-' && input == NULL)
+			input = argv[i];
+		else
+			input = NULL, i = argc;
+	}
+
+	if (input == NULL || window <= 0 || window > SNPS_PACK_WINDOW_MAX) {
+		fprintf(stderr, "usage: %s [-w window] snps_static.o\n", argv[0]);
+		fprintf(stderr, "\t-w\tlz window in words, up to %d (default)\n",
+			SNPS_PACK_WINDOW_MAX);
+		return 1;
+	}
+
+	fp = fopen(input, "rb");
+	if (fp == NULL) {
+		perror(input);
+		return 1;
+	}
+	fseek(fp, 0, SEEK_END);
+	elf_len = ftell(fp);
+	rewind(fp);
+	elf = malloc(elf_len);
+	if (elf == NULL || fread(elf, 1, elf_len, fp) != (size_t)elf_len ||
+	    memcmp(elf, "\177ELF\2\1", 6)) {
+		fprintf(stderr, "snps_pack: %s: not a 64-bit little-endian elf object\n", input);
+		return 1;
+	}
+	fclose(fp);
+
+	printf("/* generated by snps_pack from %s, do not edit */\n\n", input);
+	printf("#include \"snps_static.h\"\n#include \"snps_pack.h\"\n\n");
+
+	for (i = 0; i < (int)(sizeof(random_sections) / sizeof(random_sections[0])); i++)
+		if (random_section_print(random_sections[i]))
+			return 1;
+
+	for (i = 0; i < (int)(sizeof(seq_sections) / sizeof(seq_sections[0])); i++) {
+		saved = seq_section_print(&seq_sections[i], window);
+		if (saved < 0)
+			return 1;
+		total += saved;
+	}
+	fprintf(stderr, "snps_pack: total saved %d bytes\n", total);
+
+	free(elf);
+
+	return 0;
+}
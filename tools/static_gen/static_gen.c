@@ -0,0 +1,353 @@
+/* Copyright (C) 2016 Marvell.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * static configuration table generator
+ *
+ * rebuilds the final dunit and phy register state of a successful training
+ * run and emits it as a38x CONFIG_MC_STATIC / CONFIG_PHY_STATIC register
+ * images in the a38x/mv_ddr_static.c format. the input is either:
+ * - a register access trace record (MV_DDR_TRACE, see mv_ddr_trace.h), or
+ * - a text dump, e.g. a boot log of a CONFIG_MC_STATIC_PRINT /
+ *   CONFIG_PHY_STATIC_PRINT build; lines other than
+ *	"dunit <addr> <value>"
+ *	"phy data|ctrl <subphy> <addr> <value>"
+ *   are ignored.
+ * a trace only holds the registers training accessed, while a dump covers
+ * the whole phy register file, so prefer the dump for a complete image.
+ *
+ * build and run:
+ *	make TOOL=static_gen
+ *	./static_gen -n a38x -f 800 boot.log > images.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../../a38x/mv_ddr_static_regs.h"
+
+/* trace record, as in mv_ddr_trace.h */
+#define TRACE_MAGIC		0x5444564d /* "MVDT" */
+#define TRACE_VERSION		2
+#define TRACE_VERSION_RING	1	/* lost the oldest entries on wrap */
+#define TRACE_HDR_MIN_SIZE	20
+#define TRACE_ENTRY_MIN_SIZE	20
+#define TRACE_DUNIT_RD		0
+#define TRACE_DUNIT_WR		1
+#define TRACE_PHY_RD		2
+#define TRACE_PHY_WR		3
+#define TRACE_PHY_CTRL		0x1
+#define TRACE_PHY_MCAST		0x2
+
+#define PHY_DATA		0
+#define PHY_CTRL		1
+#define PHY_TYPES		2
+#define PHY_REGS		0x100
+#define SUBPHYS_MAX		9
+#define DUNIT_REGS_SIZE		0x2000	/* dunit register window */
+#define SDRAM_OP_REG		0x1418
+
+/* static register image, as in a38x/mv_ddr_static.c */
+#define IMG_ABS			0x7f	/* largest delta is IMG_ABS - 1 */
+
+/* a38x mc static register set */
+static const uint32_t mc_regs[] = {
+	MV_DDR_STATIC_MC_REGS
+};
+
+static uint32_t dunit_val[DUNIT_REGS_SIZE / 4];
+static uint32_t dunit_known[DUNIT_REGS_SIZE / 4];	/* bits with a known value */
+static uint16_t phy_val[PHY_TYPES][SUBPHYS_MAX][PHY_REGS];
+static uint8_t phy_known[PHY_TYPES][SUBPHYS_MAX][PHY_REGS];
+static unsigned int subphys_num[PHY_TYPES] = {4, 3};
+
+static void dunit_set(uint32_t addr, uint32_t val, uint32_t mask)
+{
+	uint32_t idx = (addr & (DUNIT_REGS_SIZE - 1)) / 4;
+
+	dunit_val[idx] = (dunit_val[idx] & ~mask) | (val & mask);
+	dunit_known[idx] |= mask;
+}
+
+static void phy_set(unsigned int type, int mcast, unsigned int subphy, uint32_t addr,
+		    uint32_t val)
+{
+	unsigned int i;
+
+	if (addr >= PHY_REGS)
+		return;
+
+	for (i = 0; i < SUBPHYS_MAX; i++) {
+		if (!mcast && i != subphy)
+			continue;
+		phy_val[type][i][addr] = val;
+		phy_known[type][i][addr] = 1;
+	}
+}
+
+static uint32_t get_le(const uint8_t *buf, unsigned int size)
+{
+	uint32_t val = 0;
+	unsigned int i;
+
+	for (i = 0; i < size; i++)
+		val |= (uint32_t)buf[i] << (8 * i);
+
+	return val;
+}
+
+static int trace_load(const uint8_t *buf, long len)
+{
+	uint32_t version, count, total, hdr_size, entry_size, i;
+	uint32_t addr, data, mask;
+	const uint8_t *entry;
+	unsigned int type;
+	int mcast;
+
+	version = get_le(buf + 4, 2);
+	if (version != TRACE_VERSION && version != TRACE_VERSION_RING) {
+		fprintf(stderr, "unsupported trace version %d\n", version);
+		return -1;
+	}
+
+	hdr_size = buf[6];
+	entry_size = buf[7];
+	count = get_le(buf + 8, 4);
+	total = get_le(buf + 12, 4);
+	if (hdr_size < TRACE_HDR_MIN_SIZE || entry_size < TRACE_ENTRY_MIN_SIZE ||
+	    len < hdr_size + (long)count * entry_size) {
+		fprintf(stderr, "truncated trace record\n");
+		return -1;
+	}
+
+	if (total != count && version == TRACE_VERSION_RING)
+		fprintf(stderr, "warning: %d oldest accesses lost to ring wrap, "
+			"registers only set by them are missing\n", total - count);
+	else if (total != count)
+		fprintf(stderr, "warning: last %d accesses not kept, "
+			"the final register values are missing\n", total - count);
+
+	for (i = 0, entry = buf + hdr_size; i < count; i++, entry += entry_size) {
+		addr = get_le(entry + 8, 4);
+		data = get_le(entry + 12, 4);
+		mask = get_le(entry + 16, 4);
+		type = (entry[5] & TRACE_PHY_CTRL) ? PHY_CTRL : PHY_DATA;
+		mcast = !!(entry[5] & TRACE_PHY_MCAST);
+
+		switch (entry[4]) {
+		case TRACE_DUNIT_RD:
+		case TRACE_DUNIT_WR:
+			dunit_set(addr, data, mask);
+			break;
+		case TRACE_PHY_RD:
+			/* a multicast read returns the first subphy only */
+			phy_set(type, 0, get_le(entry + 6, 2), addr, data);
+			break;
+		case TRACE_PHY_WR:
+			phy_set(type, mcast, get_le(entry + 6, 2), addr, data);
+			break;
+		default:
+			break;
+		}
+	}
+
+	return 0;
+}
+
+static int dump_load(FILE *fp)
+{
+	char line[256], type[8];
+	unsigned int subphy, addr, val;
+	int lines = 0;
+
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		if (sscanf(line, " dunit %x %x", &addr, &val) == 2) {
+			dunit_set(addr, val, 0xffffffff);
+			lines++;
+		} else if (sscanf(line, " phy %7s %u %x %x", type, &subphy, &addr, &val) == 4 &&
+			   subphy < SUBPHYS_MAX) {
+			if (!strcmp(type, "data"))
+				phy_set(PHY_DATA, 0, subphy, addr, val);
+			else if (!strcmp(type, "ctrl"))
+				phy_set(PHY_CTRL, 0, subphy, addr, val);
+			else
+				continue;
+			lines++;
+		}
+	}
+
+	if (lines == 0) {
+		fprintf(stderr, "no register dump lines found\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int input_load(const char *path)
+{
+	uint8_t *buf;
+	FILE *fp;
+	long len;
+	int ret;
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) {
+		perror(path);
+		return -1;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	len = ftell(fp);
+	rewind(fp);
+
+	buf = (len >= TRACE_HDR_MIN_SIZE) ? malloc(len) : NULL;
+	if (buf != NULL && fread(buf, 1, len, fp) == (size_t)len &&
+	    get_le(buf, 4) == TRACE_MAGIC) {
+		ret = trace_load(buf, len);
+	} else {
+		rewind(fp);
+		ret = dump_load(fp);
+	}
+
+	free(buf);
+	fclose(fp);
+
+	return ret;
+}
+
+/* record header w/ address delta to the previous record, or an absolute address */
+static void img_hdr_print(const char *flag, uint32_t addr, uint32_t prev, int is_first,
+			  uint32_t step, unsigned int addr_size)
+{
+	if (is_first || addr <= prev || (addr - prev) / step >= IMG_ABS)
+		printf((addr_size == 4) ? "\t%sSTATIC_IMG_ABS, STATIC_IMG_U32(0x%x)" :
+		       "\t%sSTATIC_IMG_ABS, 0x%x", flag, addr);
+	else
+		printf("\t%s%d", flag, (addr - prev) / step);
+}
+
+static void mc_img_print(const char *name, const char *freq)
+{
+	uint32_t idx, val, mask, prev = 0;
+	unsigned int i, cnt = 0;
+
+	printf("#ifdef CONFIG_MC_STATIC\n");
+	printf("static const u8 %s_mc_%s[] = {\n", name, freq);
+	for (i = 0; i < sizeof(mc_regs) / sizeof(mc_regs[0]); i++) {
+		idx = mc_regs[i] / 4;
+		val = dunit_val[idx];
+		mask = dunit_known[idx];
+		if (mc_regs[i] == SDRAM_OP_REG) {
+			/* never replay the last dram command, keep normal operation */
+			val = 0;
+			mask = 0xffffffff;
+		}
+		if (mask == 0) {
+			fprintf(stderr, "warning: dunit reg 0x%x not accessed, left at its reset value\n",
+				mc_regs[i]);
+			continue;
+		}
+		img_hdr_print((mask != 0xffffffff) ? "STATIC_IMG_MASKED | " : "", mc_regs[i], prev,
+			      cnt == 0, 4, 4);
+		printf(", STATIC_IMG_U32(0x%08x)", val);
+		if (mask != 0xffffffff)
+			printf(", STATIC_IMG_U32(0x%x)", mask);
+		printf(",\t/* 0x%x */\n", mc_regs[i]);
+		prev = mc_regs[i];
+		cnt++;
+	}
+	printf("\tSTATIC_IMG_END\n};\n");
+	printf("#endif /* CONFIG_MC_STATIC */\n\n");
+}
+
+static void phy_img_print(const char *name, const char *freq, unsigned int type)
+{
+	unsigned int addr, subphy, known, bcast, prev = 0, cnt = 0;
+	uint16_t *val;
+
+	printf("static const u8 %s_%s_phy_%s[] = {\n",
+	       name, (type == PHY_CTRL) ? "ctrl" : "data", freq);
+	printf("\t%d,\t/* subphys */\n", subphys_num[type]);
+	for (addr = 0; addr < PHY_REGS; addr++) {
+		known = 0;
+		bcast = 1;
+		for (subphy = 0; subphy < subphys_num[type]; subphy++) {
+			known += phy_known[type][subphy][addr];
+			if (phy_val[type][subphy][addr] != phy_val[type][0][addr])
+				bcast = 0;
+		}
+		/* registers never touched stay at their reset value */
+		if (known == 0)
+			continue;
+		if (known != subphys_num[type])
+			fprintf(stderr, "warning: %s phy reg 0x%x not accessed on all subphys, "
+				"assuming zero reset value\n", (type == PHY_CTRL) ? "ctrl" : "data", addr);
+		img_hdr_print(bcast ? "STATIC_IMG_BCAST | " : "", addr, prev, cnt == 0, 1, 1);
+		val = &phy_val[type][0][addr];
+		for (subphy = 0; subphy < (bcast ? 1 : subphys_num[type]); subphy++)
+			printf(", STATIC_IMG_U16(0x%x)", val[subphy * PHY_REGS]);
+		printf(",\t/* 0x%x */\n", addr);
+		prev = addr;
+		cnt++;
+	}
+	printf("\tSTATIC_IMG_END\n};\n\n");
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-n name] [-f freq] [-d data_subphys] [-c ctrl_subphys] input\n",
+		prog);
+	fprintf(stderr, "\t-n\ttable name prefix (default a38x)\n");
+	fprintf(stderr, "\t-f\tddr frequency in MHz, table name suffix (default 800)\n");
+	fprintf(stderr, "\t-d\tdata subphys per image record (default 4)\n");
+	fprintf(stderr, "\t-c\tcontrol subphys per image record (default 3)\n");
+	fprintf(stderr, "\tinput\ttrace record or register dump\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = "a38x", *freq = "800", *input = NULL;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+			name = argv[++i];
+		} else if (!strcmp(argv[i], "-f") && i + 1 < argc) {
+			freq = argv[++i];
+		} else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+			subphys_num[PHY_DATA] = strtoul(argv[++i], NULL, 0);
+		} else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+			subphys_num[PHY_CTRL] = strtoul(argv[++i], NULL, 0);
+		} else if (argv[i][0] != '-' && input == NULL) {
+			input = argv[i];
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (input == NULL || subphys_num[PHY_DATA] == 0 || subphys_num[PHY_DATA] > SUBPHYS_MAX ||
+	    subphys_num[PHY_CTRL] == 0 || subphys_num[PHY_CTRL] > SUBPHYS_MAX) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (input_load(input) != 0)
+		return 1;
+
+	printf("/* generated by static_gen from %s */\n\n", input);
+	mc_img_print(name, freq);
+	printf("#ifdef CONFIG_PHY_STATIC\n");
+	phy_img_print(name, freq, PHY_CTRL);
+	phy_img_print(name, freq, PHY_DATA);
+	printf("#endif /* CONFIG_PHY_STATIC */\n\n");
+	printf("/* ddr_modes[] entry:\n");
+	printf("\t{\"%s_%s\", MV_DDR_FREQ_%s, %s_mc_%s, %s_ctrl_phy_%s, %s_data_phy_%s},\n */\n",
+	       name, freq, freq, name, freq, name, freq, name, freq);
+
+	return 0;
+}
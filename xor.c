@@ -13,16 +13,34 @@
 #define DB(x)
 #endif
 
-static u32 ui_xor_regs_ctrl_backup;
+static u32 ui_xor_regs_ctrl_backup[MV_XOR_MAX_CHAN];
 static u32 ui_xor_regs_base_backup[MAX_CS_NUM + 1];
 static u32 ui_xor_regs_mask_backup[MAX_CS_NUM + 1];
 
+/*
+ * number of xor channels with registers of their own;
+ * channels of units that aren't mapped by MV_XOR_REGS_BASE alias unit 0 ones
+ */
+static u32 mv_xor_chan_num_get(void)
+{
+	u32 chan;
+
+	for (chan = 1; chan < MV_XOR_MAX_CHAN; chan++)
+		if (XOR_CONFIG_REG(XOR_UNIT(chan), XOR_CHAN(chan)) == XOR_CONFIG_REG(0, 0))
+			break;
+
+	return chan;
+}
+
 void mv_sys_xor_init(u32 num_of_cs, u32 cs_ena, uint64_t cs_size, u32 base_delta)
 {
-	u32 reg, ui, cs_count;
+	u32 reg, ui, cs_count, chan;
+	u32 chan_num = mv_xor_chan_num_get();
 	uint64_t base, size_mask;
 
-	ui_xor_regs_ctrl_backup = reg_read(XOR_WINDOW_CTRL_REG(0, 0));
+	for (chan = 0; chan < chan_num; chan++)
+		ui_xor_regs_ctrl_backup[chan] =
+			reg_read(XOR_WINDOW_CTRL_REG(XOR_UNIT(chan), XOR_CHAN(chan)));
 	for (ui = 0; ui < MAX_CS_NUM + 1; ui++)
 		ui_xor_regs_base_backup[ui] =
 			reg_read(XOR_BASE_ADDR_REG(0, ui));
@@ -42,7 +60,9 @@ void mv_sys_xor_init(u32 num_of_cs, u32 cs_ena, uint64_t cs_size, u32 base_delta
 		}
 	}
 
-	reg_write(XOR_WINDOW_CTRL_REG(0, 0), reg);
+	/* same windows for all channels */
+	for (chan = 0; chan < chan_num; chan++)
+		reg_write(XOR_WINDOW_CTRL_REG(XOR_UNIT(chan), XOR_CHAN(chan)), reg);
 
 	cs_count = 0;
 	for (ui = 0, cs_count = 0;
@@ -85,16 +105,19 @@ void mv_sys_xor_init(u32 num_of_cs, u32 cs_ena, uint64_t cs_size, u32 base_delta
 		}
 	}
 
-	mv_xor_hal_init(1);
+	mv_xor_hal_init(chan_num);
 
 	return;
 }
 
 void mv_sys_xor_finish(void)
 {
-	u32 ui;
+	u32 ui, chan;
+	u32 chan_num = mv_xor_chan_num_get();
 
-	reg_write(XOR_WINDOW_CTRL_REG(0, 0), ui_xor_regs_ctrl_backup);
+	for (chan = 0; chan < chan_num; chan++)
+		reg_write(XOR_WINDOW_CTRL_REG(XOR_UNIT(chan), XOR_CHAN(chan)),
+			  ui_xor_regs_ctrl_backup[chan]);
 	for (ui = 0; ui < MAX_CS_NUM + 1; ui++)
 		reg_write(XOR_BASE_ADDR_REG(0, ui),
 			  ui_xor_regs_base_backup[ui]);
@@ -335,11 +358,22 @@ int mv_xor_command_set(u32 chan, enum mv_command command)
 	return MV_BAD_PARAM;
 }
 
-void ddr3_new_tip_ecc_scrub(void)
+/* ecc scrub partitions, one per xor channel, in address order */
+static u32 scrub_chan_num;
+static uint64_t scrub_part_end[MV_XOR_MAX_CHAN];
+
+/*
+ * start scrubbing memory on all xor channels; returns w/o waiting for completion;
+ * if a channel fails to start, the rest of memory is scrubbed on channel 0;
+ * the channels share the memory bandwidth, so this overlaps scrubbing with the
+ * rest of boot rather than making low memory available early
+ */
+int ddr3_new_tip_ecc_scrub_start(void)
 {
-	u32 cs_c, max_cs;
+	u32 cs_c, max_cs, chan, chan_num;
 	u32 cs_ena = 0;
 	uint64_t total_mem_size, cs_mem_size_mb = 0, cs_mem_size = 0;
+	uint64_t part_size, part_start = 0, size;
 
 	printf("DDR Training Sequence - Start scrubbing\n");
 	max_cs = mv_ddr_cs_num_get();
@@ -353,16 +387,93 @@ void ddr3_new_tip_ecc_scrub(void)
 	cs_mem_size = cs_mem_size_mb * _1M;
 	mv_sys_xor_init(max_cs, cs_ena, cs_mem_size, 0);
 	total_mem_size = max_cs * cs_mem_size;
-	mv_xor_mem_init(0, 0, total_mem_size, 0xdeadbeef, 0xdeadbeef);
-	/* wait for previous transfer completion */
-	while (mv_xor_state_get(0) != MV_IDLE)
-		;
+
+	/*
+	 * partition memory over all xor channels, aligned to xor window size;
+	 * the last partition takes the remainder, and the _4G block size
+	 * limit is applied per partition by mv_xor_mem_init()
+	 */
+	chan_num = mv_xor_chan_num_get();
+	part_size = (total_mem_size / chan_num) & ~((uint64_t)XOR_WIN_SIZE_ALIGN - 1);
+	if (part_size == 0)
+		chan_num = 1;
+	for (chan = 0; chan < chan_num; chan++) {
+		size = (chan == chan_num - 1) ? total_mem_size - part_start : part_size;
+		if (mv_xor_mem_init(chan, (u32)part_start, size, 0xdeadbeef, 0xdeadbeef) != MV_OK)
+			break;
+		part_start += size;
+		scrub_part_end[chan] = part_start;
+	}
+	scrub_chan_num = chan;
+	if (part_start == total_mem_size)
+		return MV_OK;
+
+	/* wait for the started channels, then scrub the rest as one partition on channel 0 */
+	for (chan = 0; chan < scrub_chan_num; chan++)
+		while (mv_xor_state_get(chan) != MV_IDLE)
+			;
+	scrub_chan_num = 0;
+	if (mv_xor_mem_init(0, (u32)part_start, total_mem_size - part_start,
+			    0xdeadbeef, 0xdeadbeef) != MV_OK) {
+		printf("mv_ddr: error: failed to start scrubbing at 0x%x\n", (u32)part_start);
+		mv_sys_xor_finish();
+		return MV_FAIL;
+	}
+	scrub_part_end[0] = total_mem_size;
+	scrub_chan_num = 1;
+
+	return MV_OK;
+}
+
+/*
+ * check whether a memory range is scrubbed; a partition is done once its
+ * channel and the channels of the lower partitions are idle; all channels
+ * scrub at once at about the same rate, so in practice low memory is done
+ * only shortly before high memory, and this mostly tells when all is done
+ */
+int ddr3_new_tip_ecc_scrub_is_done(uint64_t addr, uint64_t size)
+{
+	u32 chan;
+
+	for (chan = 0; chan < scrub_chan_num; chan++) {
+		if (mv_xor_state_get(chan) != MV_IDLE)
+			return 0;
+		if (addr + size <= scrub_part_end[chan])
+			return 1;
+	}
+
+	/* all partitions are done, or no scrubbing in flight */
+	return 1;
+}
+
+/* wait for scrubbing completion on all xor channels and release them */
+void ddr3_new_tip_ecc_scrub_wait(void)
+{
+	u32 chan;
+
+	if (scrub_chan_num == 0)
+		return;
+
+	/* wait for transfer completion on all channels */
+	for (chan = 0; chan < scrub_chan_num; chan++)
+		while (mv_xor_state_get(chan) != MV_IDLE)
+			;
+	scrub_chan_num = 0;
+
 	/* Return XOR State */
 	mv_sys_xor_finish();
 
 	printf("DDR3 Training Sequence - End scrubbing\n");
 }
 
+void ddr3_new_tip_ecc_scrub(void)
+{
+	if (ddr3_new_tip_ecc_scrub_start() != MV_OK)
+		return;
+
+	ddr3_new_tip_ecc_scrub_wait();
+}
+
 /*
 * mv_xor_transfer - Transfer data from source to destination in one of
 *		    three modes: XOR, CRC32 or DMA